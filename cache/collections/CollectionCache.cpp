@@ -0,0 +1,61 @@
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "CollectionCache.h"
+#include "LoggerManager.h"
+#include "FileLogger.h"
+
+CollectionCache::CollectionCache(size_t max_size) : max_size_(max_size)
+{
+    std::ostringstream oss;
+    oss << "cache_" << std::this_thread::get_id() << ".log";
+
+    file_logger_ = std::make_shared<FileLogger>(oss.str());
+    file_logger_->setLogLevel(ILogger::LogLevel::DEBUG);
+
+    // Register the file logger with the LoggerManager to handle logging
+    LoggerManager::getInstance().addLogger(file_logger_);
+}
+
+CollectionCache::~CollectionCache()
+{
+    file_logger_->info("Cache destroyed");
+    std::cout << "Cache destroyed" << std::endl;
+}
+
+void CollectionCache::CheckCapacity() const
+{
+    if (hashes_.size() + lists_.size() + sorted_sets_.size() >= max_size_)
+    {
+        throw std::length_error("the collection cache holds its maximum of " + std::to_string(max_size_) +
+                                " collections");
+    }
+}
+
+bool CollectionCache::ClampRange(long long start, long long stop, size_t size, size_t &first, size_t &last)
+{
+    long long length = static_cast<long long>(size);
+    if (start < 0)
+    {
+        start = std::max(start + length, 0LL);
+    }
+    if (stop < 0)
+    {
+        stop += length;
+    }
+    if (stop >= length)
+    {
+        stop = length - 1;
+    }
+    if (start > stop || start >= length)
+    {
+        return false;
+    }
+
+    first = static_cast<size_t>(start);
+    last = static_cast<size_t>(stop);
+    return true;
+}
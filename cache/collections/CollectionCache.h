@@ -0,0 +1,159 @@
+#ifndef COLLECTION_CACHE_H
+#define COLLECTION_CACHE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ICollectionCache.h"
+#include "HashValue.h"
+#include "ListValue.h"
+#include "SortedSetValue.h"
+#include "LoggerManager.h"
+#include "FileLogger.h"
+#include "TimedMutex.h"
+
+/**
+ * @class CollectionCache
+ * @brief A cache of hashes, lists and sorted sets.
+ *
+ * Collections are updated in place, so changing one field or element costs time in proportion to that element
+ * rather than to the whole collection. Small collections are stored compactly in a listpack and convert to a hash
+ * table, deque or skip list as they grow; see `HashValue`, `ListValue` and `SortedSetValue`.
+ */
+class CollectionCache : public ICollectionCache
+{
+public:
+    /**
+     * @brief Constructs a CollectionCache object with a specified maximum size.
+     *
+     * @param max_size The maximum number of collections, of all types, the cache can hold.
+     */
+    explicit CollectionCache(size_t max_size = 10000);
+
+    /**
+     * @brief Destructor for the CollectionCache class.
+     */
+    ~CollectionCache() override;
+
+    /**
+     * @brief Sets fields of a hash, creating it if needed.
+     *
+     * @param key The hash's key.
+     * @param fields The fields and their values.
+     * @return The number of fields that were new.
+     * @throws std::length_error If the hash does not exist and the cache is full.
+     */
+    size_t HashSet(const std::string &key, const std::vector<std::pair<std::string, std::string>> &fields) override;
+
+    /**
+     * @brief Looks up a field of a hash.
+     *
+     * @param key The hash's key.
+     * @param field The field.
+     * @param value Receives the field's value.
+     * @return `false` if the hash or the field does not exist.
+     */
+    bool HashGet(const std::string &key, const std::string &field, std::string &value) override;
+
+    /**
+     * @brief Erases fields of a hash, removing the hash once it is empty.
+     *
+     * @param key The hash's key.
+     * @param fields The fields.
+     * @return The number of fields that existed.
+     */
+    size_t HashDelete(const std::string &key, const std::vector<std::string> &fields) override;
+
+    /**
+     * @brief Pushes elements one by one to the front or the back of a list, creating it if needed.
+     *
+     * @param key The list's key.
+     * @param elements The elements.
+     * @param front `true` to push to the front, so that the last element ends up first.
+     * @return The length of the list after the push.
+     * @throws std::length_error If the list does not exist and the cache is full.
+     */
+    size_t ListPush(const std::string &key, const std::vector<std::string> &elements, bool front) override;
+
+    /**
+     * @brief Removes elements from the front or the back of a list, removing the list once it is empty.
+     *
+     * @param key The list's key.
+     * @param count The most elements to remove.
+     * @param front `true` to pop from the front.
+     * @return The removed elements, in the order they were removed.
+     */
+    std::vector<std::string> ListPop(const std::string &key, size_t count, bool front) override;
+
+    /**
+     * @brief Returns the elements of a list between two indexes, inclusive.
+     *
+     * @param key The list's key.
+     * @param start The index of the first element; negative indexes count from the end.
+     * @param stop The index of the last element; negative indexes count from the end.
+     * @return The elements; empty if the list does not exist.
+     */
+    std::vector<std::string> ListRange(const std::string &key, long long start, long long stop) override;
+
+    /**
+     * @brief Adds members to a sorted set or updates their scores, creating it if needed.
+     *
+     * @param key The set's key.
+     * @param members The scores and members.
+     * @return The number of members that were new.
+     * @throws std::invalid_argument If a score is NaN.
+     * @throws std::length_error If the set does not exist and the cache is full.
+     */
+    size_t SortedSetAdd(const std::string &key, const std::vector<std::pair<double, std::string>> &members) override;
+
+    /**
+     * @brief Removes members from a sorted set, removing the set once it is empty.
+     *
+     * @param key The set's key.
+     * @param members The members.
+     * @return The number of members that were in the set.
+     */
+    size_t SortedSetRemove(const std::string &key, const std::vector<std::string> &members) override;
+
+    /**
+     * @brief Returns the members of a sorted set between two ranks, inclusive, with their scores.
+     *
+     * @param key The set's key.
+     * @param start The rank of the first member; negative ranks count from the end.
+     * @param stop The rank of the last member; negative ranks count from the end.
+     * @return The members and scores; empty if the set does not exist.
+     */
+    std::vector<std::pair<std::string, double>> SortedSetRange(const std::string &key,
+                                                               long long start,
+                                                               long long stop) override;
+
+private:
+    size_t max_size_; ///< The maximum number of collections.
+    std::unordered_map<std::string, HashValue> hashes_;          ///< Hashes by key.
+    std::unordered_map<std::string, ListValue> lists_;           ///< Lists by key.
+    std::unordered_map<std::string, SortedSetValue> sorted_sets_; ///< Sorted sets by key.
+    TimedMutex mutex_; ///< A mutex to ensure thread-safe operations on the cache.
+    std::shared_ptr<FileLogger> file_logger_;
+
+    /**
+     * @brief Refuses to create a collection once the cache holds `max_size_` of them.
+     *
+     * @throws std::length_error If the cache is full.
+     */
+    void CheckCapacity() const;
+
+    /**
+     * @brief Resolves negative indexes and clamps an inclusive range to a collection's size.
+     *
+     * @param first Receives the first index.
+     * @param last Receives the last index.
+     * @return `false` if the range is empty.
+     */
+    static bool ClampRange(long long start, long long stop, size_t size, size_t &first, size_t &last);
+};
+
+#endif // COLLECTION_CACHE_H
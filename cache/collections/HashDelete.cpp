@@ -0,0 +1,34 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Erases fields of a hash, removing the hash once it is empty.
+ *
+ * @param key The hash's key.
+ * @param fields The fields.
+ * @return The number of fields that existed.
+ */
+size_t CollectionCache::HashDelete(const std::string &key, const std::vector<std::string> &fields)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = hashes_.find(key);
+    if (it == hashes_.end())
+    {
+        return 0;
+    }
+
+    size_t erased = 0;
+    for (const auto &field : fields)
+    {
+        if (it->second.Erase(field))
+        {
+            ++erased;
+        }
+    }
+
+    if (it->second.Size() == 0)
+    {
+        hashes_.erase(it);
+    }
+    return erased;
+}
@@ -0,0 +1,17 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Looks up a field of a hash.
+ *
+ * @param key The hash's key.
+ * @param field The field.
+ * @param value Receives the field's value.
+ * @return `false` if the hash or the field does not exist.
+ */
+bool CollectionCache::HashGet(const std::string &key, const std::string &field, std::string &value)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = hashes_.find(key);
+    return it != hashes_.end() && it->second.Get(field, value);
+}
@@ -0,0 +1,31 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Sets fields of a hash, creating it if needed.
+ *
+ * @param key The hash's key.
+ * @param fields The fields and their values.
+ * @return The number of fields that were new.
+ * @throws std::length_error If the hash does not exist and the cache is full.
+ */
+size_t CollectionCache::HashSet(const std::string &key, const std::vector<std::pair<std::string, std::string>> &fields)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = hashes_.find(key);
+    if (it == hashes_.end())
+    {
+        CheckCapacity();
+        it = hashes_.emplace(key, HashValue()).first;
+    }
+
+    size_t added = 0;
+    for (const auto &field : fields)
+    {
+        if (it->second.Set(field.first, field.second))
+        {
+            ++added;
+        }
+    }
+    return added;
+}
@@ -0,0 +1,80 @@
+#include "HashValue.h"
+
+bool HashValue::Set(std::string_view field, std::string_view value)
+{
+    if (!table_)
+    {
+        size_t offset = listpack_.Find(field, 2);
+        if (offset != Listpack::npos)
+        {
+            if (value.size() <= Listpack::kMaxValueBytes)
+            {
+                listpack_.Replace(listpack_.Next(offset), value);
+                return false;
+            }
+        }
+        else if (listpack_.Size() / 2 < Listpack::kMaxEntries && field.size() <= Listpack::kMaxValueBytes &&
+                 value.size() <= Listpack::kMaxValueBytes)
+        {
+            listpack_.PushBack(field);
+            listpack_.PushBack(value);
+            return true;
+        }
+        Convert();
+    }
+
+    auto result = table_->insert_or_assign(std::string(field), std::string(value));
+    return result.second;
+}
+
+bool HashValue::Get(std::string_view field, std::string &value) const
+{
+    if (table_)
+    {
+        auto it = table_->find(std::string(field));
+        if (it == table_->end())
+        {
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+
+    size_t offset = listpack_.Find(field, 2);
+    if (offset == Listpack::npos)
+    {
+        return false;
+    }
+    value.assign(listpack_.Get(listpack_.Next(offset)));
+    return true;
+}
+
+bool HashValue::Erase(std::string_view field)
+{
+    if (table_)
+    {
+        return table_->erase(std::string(field)) > 0;
+    }
+
+    size_t offset = listpack_.Find(field, 2);
+    if (offset == Listpack::npos)
+    {
+        return false;
+    }
+    listpack_.Erase(offset, 2);
+    return true;
+}
+
+void HashValue::Convert()
+{
+    auto table = std::make_unique<std::unordered_map<std::string, std::string>>();
+    table->reserve(listpack_.Size());
+    for (size_t offset = listpack_.First(); offset != Listpack::npos;)
+    {
+        size_t value = listpack_.Next(offset);
+        table->emplace(listpack_.Get(offset), listpack_.Get(value));
+        offset = listpack_.Next(value);
+    }
+    table_ = std::move(table);
+    listpack_ = Listpack();
+}
@@ -0,0 +1,59 @@
+#ifndef HASH_VALUE_H
+#define HASH_VALUE_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Listpack.h"
+
+/**
+ * @class HashValue
+ * @brief A map from fields to values.
+ *
+ * Small hashes are a listpack of alternating fields and values, looked up by a linear scan. The hash converts to a
+ * hash table once it holds more than `Listpack::kMaxEntries` fields or any field or value longer than
+ * `Listpack::kMaxValueBytes`, and never converts back. Either way, setting or erasing one field leaves the others
+ * untouched.
+ */
+class HashValue
+{
+public:
+    /**
+     * @brief Sets a field's value.
+     *
+     * @return `true` if the field is new.
+     */
+    bool Set(std::string_view field, std::string_view value);
+
+    /**
+     * @brief Looks up a field's value.
+     *
+     * @return `false` if the field does not exist.
+     */
+    bool Get(std::string_view field, std::string &value) const;
+
+    /**
+     * @brief Erases a field.
+     *
+     * @return `false` if the field does not exist.
+     */
+    bool Erase(std::string_view field);
+
+    /**
+     * @brief Returns the number of fields.
+     */
+    size_t Size() const { return table_ ? table_->size() : listpack_.Size() / 2; }
+
+private:
+    Listpack listpack_; ///< Fields and values, while the hash is small.
+    std::unique_ptr<std::unordered_map<std::string, std::string>> table_; ///< The fields once the hash has grown.
+
+    /**
+     * @brief Moves the fields from the listpack into a hash table.
+     */
+    void Convert();
+};
+
+#endif // HASH_VALUE_H
@@ -0,0 +1,114 @@
+#ifndef ICOLLECTION_CACHE_H
+#define ICOLLECTION_CACHE_H
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @class ICollectionCache
+ * @brief An interface for a cache of collections: hashes, lists and sorted sets, each stored under its own key.
+ *
+ * Each collection type has its own key space, so a hash and a list may share a name. A collection is created by the
+ * first write to its key and removed when its last element is.
+ */
+class ICollectionCache
+{
+public:
+    virtual ~ICollectionCache() = default;
+
+    /**
+     * @brief Sets fields of a hash, creating it if needed.
+     *
+     * @param key The hash's key.
+     * @param fields The fields and their values.
+     * @return The number of fields that were new.
+     */
+    virtual size_t HashSet(const std::string &key, const std::vector<std::pair<std::string, std::string>> &fields) = 0;
+
+    /**
+     * @brief Looks up a field of a hash.
+     *
+     * @param key The hash's key.
+     * @param field The field.
+     * @param value Receives the field's value.
+     * @return `false` if the hash or the field does not exist.
+     */
+    virtual bool HashGet(const std::string &key, const std::string &field, std::string &value) = 0;
+
+    /**
+     * @brief Erases fields of a hash.
+     *
+     * @param key The hash's key.
+     * @param fields The fields.
+     * @return The number of fields that existed.
+     */
+    virtual size_t HashDelete(const std::string &key, const std::vector<std::string> &fields) = 0;
+
+    /**
+     * @brief Pushes elements one by one to the front or the back of a list, creating it if needed.
+     *
+     * @param key The list's key.
+     * @param elements The elements.
+     * @param front `true` to push to the front, so that the last element ends up first.
+     * @return The length of the list after the push.
+     */
+    virtual size_t ListPush(const std::string &key, const std::vector<std::string> &elements, bool front) = 0;
+
+    /**
+     * @brief Removes elements from the front or the back of a list.
+     *
+     * @param key The list's key.
+     * @param count The most elements to remove.
+     * @param front `true` to pop from the front.
+     * @return The removed elements, in the order they were removed.
+     */
+    virtual std::vector<std::string> ListPop(const std::string &key, size_t count, bool front) = 0;
+
+    /**
+     * @brief Returns the elements of a list between two indexes, inclusive.
+     *
+     * Negative indexes count from the end, -1 being the last element; out-of-range indexes are clamped.
+     *
+     * @param key The list's key.
+     * @param start The index of the first element.
+     * @param stop The index of the last element.
+     * @return The elements; empty if the list does not exist.
+     */
+    virtual std::vector<std::string> ListRange(const std::string &key, long long start, long long stop) = 0;
+
+    /**
+     * @brief Adds members to a sorted set or updates their scores, creating it if needed.
+     *
+     * @param key The set's key.
+     * @param members The scores and members.
+     * @return The number of members that were new.
+     */
+    virtual size_t SortedSetAdd(const std::string &key, const std::vector<std::pair<double, std::string>> &members) = 0;
+
+    /**
+     * @brief Removes members from a sorted set.
+     *
+     * @param key The set's key.
+     * @param members The members.
+     * @return The number of members that were in the set.
+     */
+    virtual size_t SortedSetRemove(const std::string &key, const std::vector<std::string> &members) = 0;
+
+    /**
+     * @brief Returns the members of a sorted set between two ranks, inclusive, with their scores.
+     *
+     * Ranks count from 0 in increasing score order; negative ranks count from the end, as for `ListRange`.
+     *
+     * @param key The set's key.
+     * @param start The rank of the first member.
+     * @param stop The rank of the last member.
+     * @return The members and scores; empty if the set does not exist.
+     */
+    virtual std::vector<std::pair<std::string, double>> SortedSetRange(const std::string &key,
+                                                                       long long start,
+                                                                       long long stop) = 0;
+};
+
+#endif // ICOLLECTION_CACHE_H
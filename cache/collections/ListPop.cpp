@@ -0,0 +1,29 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Removes elements from the front or the back of a list, removing the list once it is empty.
+ *
+ * @param key The list's key.
+ * @param count The most elements to remove.
+ * @param front `true` to pop from the front.
+ * @return The removed elements, in the order they were removed.
+ */
+std::vector<std::string> CollectionCache::ListPop(const std::string &key, size_t count, bool front)
+{
+    std::vector<std::string> elements;
+
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = lists_.find(key);
+    if (it == lists_.end())
+    {
+        return elements;
+    }
+
+    it->second.Pop(count, front, elements);
+    if (it->second.Size() == 0)
+    {
+        lists_.erase(it);
+    }
+    return elements;
+}
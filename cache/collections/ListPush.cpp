@@ -0,0 +1,28 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Pushes elements one by one to the front or the back of a list, creating it if needed.
+ *
+ * @param key The list's key.
+ * @param elements The elements.
+ * @param front `true` to push to the front, so that the last element ends up first.
+ * @return The length of the list after the push.
+ * @throws std::length_error If the list does not exist and the cache is full.
+ */
+size_t CollectionCache::ListPush(const std::string &key, const std::vector<std::string> &elements, bool front)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = lists_.find(key);
+    if (it == lists_.end())
+    {
+        CheckCapacity();
+        it = lists_.emplace(key, ListValue()).first;
+    }
+
+    for (const auto &element : elements)
+    {
+        it->second.Push(element, front);
+    }
+    return it->second.Size();
+}
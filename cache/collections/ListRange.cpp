@@ -0,0 +1,24 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Returns the elements of a list between two indexes, inclusive.
+ *
+ * @param key The list's key.
+ * @param start The index of the first element; negative indexes count from the end.
+ * @param stop The index of the last element; negative indexes count from the end.
+ * @return The elements; empty if the list does not exist.
+ */
+std::vector<std::string> CollectionCache::ListRange(const std::string &key, long long start, long long stop)
+{
+    std::vector<std::string> elements;
+
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = lists_.find(key);
+    size_t first, last;
+    if (it != lists_.end() && ClampRange(start, stop, it->second.Size(), first, last))
+    {
+        it->second.Range(first, last, elements);
+    }
+    return elements;
+}
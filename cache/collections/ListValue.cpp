@@ -0,0 +1,92 @@
+#include "ListValue.h"
+
+#include <algorithm>
+
+void ListValue::Push(std::string_view element, bool front)
+{
+    if (!deque_)
+    {
+        if (listpack_.Size() < Listpack::kMaxEntries && element.size() <= Listpack::kMaxValueBytes)
+        {
+            front ? listpack_.PushFront(element) : listpack_.PushBack(element);
+            return;
+        }
+        Convert();
+    }
+
+    front ? deque_->emplace_front(element) : deque_->emplace_back(element);
+}
+
+void ListValue::Pop(size_t count, bool front, std::vector<std::string> &elements)
+{
+    count = std::min(count, Size());
+    elements.reserve(elements.size() + count);
+
+    if (deque_)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (front)
+            {
+                elements.push_back(std::move(deque_->front()));
+                deque_->pop_front();
+            }
+            else
+            {
+                elements.push_back(std::move(deque_->back()));
+                deque_->pop_back();
+            }
+        }
+        return;
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Collect the popped run, then erase it with a single move of the remaining bytes
+    size_t offset = front ? listpack_.First() : listpack_.Last();
+    for (size_t i = 0; i < count; ++i)
+    {
+        elements.emplace_back(listpack_.Get(offset));
+        if (i + 1 < count)
+        {
+            offset = front ? listpack_.Next(offset) : listpack_.Prev(offset);
+        }
+    }
+    listpack_.Erase(front ? listpack_.First() : offset, count);
+}
+
+void ListValue::Range(size_t first, size_t last, std::vector<std::string> &elements) const
+{
+    elements.reserve(elements.size() + last - first + 1);
+
+    if (deque_)
+    {
+        elements.insert(elements.end(), deque_->begin() + first, deque_->begin() + last + 1);
+        return;
+    }
+
+    size_t offset = listpack_.First();
+    for (size_t i = 0; i < first; ++i)
+    {
+        offset = listpack_.Next(offset);
+    }
+    for (size_t i = first; i <= last; ++i)
+    {
+        elements.emplace_back(listpack_.Get(offset));
+        offset = listpack_.Next(offset);
+    }
+}
+
+void ListValue::Convert()
+{
+    auto deque = std::make_unique<std::deque<std::string>>();
+    for (size_t offset = listpack_.First(); offset != Listpack::npos; offset = listpack_.Next(offset))
+    {
+        deque->emplace_back(listpack_.Get(offset));
+    }
+    deque_ = std::move(deque);
+    listpack_ = Listpack();
+}
@@ -0,0 +1,55 @@
+#ifndef LIST_VALUE_H
+#define LIST_VALUE_H
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Listpack.h"
+
+/**
+ * @class ListValue
+ * @brief A sequence of strings pushed and popped at either end.
+ *
+ * Small lists are a listpack. The list converts to a deque once it holds more than `Listpack::kMaxEntries`
+ * elements or any element longer than `Listpack::kMaxValueBytes`, and never converts back; pushes and pops then
+ * cost O(element) however long the list is.
+ */
+class ListValue
+{
+public:
+    /**
+     * @brief Adds an element at the front or the back.
+     */
+    void Push(std::string_view element, bool front);
+
+    /**
+     * @brief Removes up to `count` elements from the front or the back.
+     *
+     * @param elements Receives the removed elements, in the order they were removed.
+     */
+    void Pop(size_t count, bool front, std::vector<std::string> &elements);
+
+    /**
+     * @brief Copies the elements with indexes `first` to `last` inclusive, which must be in range.
+     */
+    void Range(size_t first, size_t last, std::vector<std::string> &elements) const;
+
+    /**
+     * @brief Returns the number of elements.
+     */
+    size_t Size() const { return deque_ ? deque_->size() : listpack_.Size(); }
+
+private:
+    Listpack listpack_; ///< The elements, while the list is small.
+    std::unique_ptr<std::deque<std::string>> deque_; ///< The elements once the list has grown.
+
+    /**
+     * @brief Moves the elements from the listpack into a deque.
+     */
+    void Convert();
+};
+
+#endif // LIST_VALUE_H
@@ -0,0 +1,45 @@
+#include <cmath>
+#include <stdexcept>
+
+#include "CollectionCache.h"
+
+/**
+ * @brief Adds members to a sorted set or updates their scores, creating it if needed.
+ *
+ * The scores are checked before anything is added, so that a bad score leaves the set unchanged.
+ *
+ * @param key The set's key.
+ * @param members The scores and members.
+ * @return The number of members that were new.
+ * @throws std::invalid_argument If a score is NaN.
+ * @throws std::length_error If the set does not exist and the cache is full.
+ */
+size_t CollectionCache::SortedSetAdd(const std::string &key, const std::vector<std::pair<double, std::string>> &members)
+{
+    for (const auto &member : members)
+    {
+        if (std::isnan(member.first))
+        {
+            throw std::invalid_argument("score is not a number");
+        }
+    }
+
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = sorted_sets_.find(key);
+    if (it == sorted_sets_.end())
+    {
+        CheckCapacity();
+        it = sorted_sets_.emplace(key, SortedSetValue()).first;
+    }
+
+    size_t added = 0;
+    for (const auto &member : members)
+    {
+        if (it->second.Add(member.second, member.first))
+        {
+            ++added;
+        }
+    }
+    return added;
+}
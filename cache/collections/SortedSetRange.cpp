@@ -0,0 +1,26 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Returns the members of a sorted set between two ranks, inclusive, with their scores.
+ *
+ * @param key The set's key.
+ * @param start The rank of the first member; negative ranks count from the end.
+ * @param stop The rank of the last member; negative ranks count from the end.
+ * @return The members and scores; empty if the set does not exist.
+ */
+std::vector<std::pair<std::string, double>> CollectionCache::SortedSetRange(const std::string &key,
+                                                                            long long start,
+                                                                            long long stop)
+{
+    std::vector<std::pair<std::string, double>> members;
+
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = sorted_sets_.find(key);
+    size_t first, last;
+    if (it != sorted_sets_.end() && ClampRange(start, stop, it->second.Size(), first, last))
+    {
+        it->second.Range(first, last, members);
+    }
+    return members;
+}
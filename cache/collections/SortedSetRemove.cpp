@@ -0,0 +1,34 @@
+#include "CollectionCache.h"
+
+/**
+ * @brief Removes members from a sorted set, removing the set once it is empty.
+ *
+ * @param key The set's key.
+ * @param members The members.
+ * @return The number of members that were in the set.
+ */
+size_t CollectionCache::SortedSetRemove(const std::string &key, const std::vector<std::string> &members)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = sorted_sets_.find(key);
+    if (it == sorted_sets_.end())
+    {
+        return 0;
+    }
+
+    size_t removed = 0;
+    for (const auto &member : members)
+    {
+        if (it->second.Erase(member))
+        {
+            ++removed;
+        }
+    }
+
+    if (it->second.Size() == 0)
+    {
+        sorted_sets_.erase(it);
+    }
+    return removed;
+}
@@ -0,0 +1,145 @@
+#include "SortedSetValue.h"
+
+#include <cstring>
+
+double SortedSetValue::DecodeScore(std::string_view bytes)
+{
+    double score;
+    std::memcpy(&score, bytes.data(), sizeof(score));
+    return score;
+}
+
+void SortedSetValue::InsertSorted(std::string_view member, double score)
+{
+    size_t offset = listpack_.First();
+    while (offset != Listpack::npos)
+    {
+        size_t score_offset = listpack_.Next(offset);
+        double other = DecodeScore(listpack_.Get(score_offset));
+        if (score < other || (score == other && member < listpack_.Get(offset)))
+        {
+            break;
+        }
+        offset = listpack_.Next(score_offset);
+    }
+    if (offset == Listpack::npos)
+    {
+        offset = listpack_.Bytes();
+    }
+
+    // Insert the score first so that the member lands in front of it
+    char bytes[sizeof(score)];
+    std::memcpy(bytes, &score, sizeof(score));
+    listpack_.Insert(offset, std::string_view(bytes, sizeof(bytes)));
+    listpack_.Insert(offset, member);
+}
+
+bool SortedSetValue::Add(std::string_view member, double score)
+{
+    if (!scores_)
+    {
+        size_t offset = listpack_.Find(member, 2);
+        if (offset != Listpack::npos)
+        {
+            if (DecodeScore(listpack_.Get(listpack_.Next(offset))) != score)
+            {
+                listpack_.Erase(offset, 2);
+                InsertSorted(member, score);
+            }
+            return false;
+        }
+        if (listpack_.Size() / 2 < Listpack::kMaxEntries && member.size() <= Listpack::kMaxValueBytes)
+        {
+            InsertSorted(member, score);
+            return true;
+        }
+        Convert();
+    }
+
+    auto result = scores_->emplace(member, score);
+    if (result.second)
+    {
+        list_->Insert(std::string(member), score);
+        return true;
+    }
+
+    double &current = result.first->second;
+    if (current != score)
+    {
+        list_->Erase(member, current);
+        list_->Insert(std::string(member), score);
+        current = score;
+    }
+    return false;
+}
+
+bool SortedSetValue::Erase(std::string_view member)
+{
+    if (scores_)
+    {
+        auto it = scores_->find(std::string(member));
+        if (it == scores_->end())
+        {
+            return false;
+        }
+        list_->Erase(member, it->second);
+        scores_->erase(it);
+        return true;
+    }
+
+    size_t offset = listpack_.Find(member, 2);
+    if (offset == Listpack::npos)
+    {
+        return false;
+    }
+    listpack_.Erase(offset, 2);
+    return true;
+}
+
+void SortedSetValue::Range(size_t first, size_t last, std::vector<std::pair<std::string, double>> &members) const
+{
+    members.reserve(members.size() + last - first + 1);
+
+    if (list_)
+    {
+        // One O(log n) descent to the first rank, then a walk along the bottom level
+        const SkipList::Node *node = list_->ByRank(first);
+        for (size_t i = first; i <= last; ++i)
+        {
+            members.emplace_back(node->member, node->score);
+            node = node->Next();
+        }
+        return;
+    }
+
+    size_t offset = listpack_.First();
+    for (size_t i = 0; i < first; ++i)
+    {
+        offset = listpack_.Next(listpack_.Next(offset));
+    }
+    for (size_t i = first; i <= last; ++i)
+    {
+        size_t score_offset = listpack_.Next(offset);
+        members.emplace_back(std::string(listpack_.Get(offset)), DecodeScore(listpack_.Get(score_offset)));
+        offset = listpack_.Next(score_offset);
+    }
+}
+
+void SortedSetValue::Convert()
+{
+    auto list = std::make_unique<SkipList>();
+    auto scores = std::make_unique<std::unordered_map<std::string, double>>();
+    scores->reserve(listpack_.Size());
+    for (size_t offset = listpack_.First(); offset != Listpack::npos;)
+    {
+        size_t score_offset = listpack_.Next(offset);
+        std::string member(listpack_.Get(offset));
+        double score = DecodeScore(listpack_.Get(score_offset));
+        scores->emplace(member, score);
+        list->Insert(std::move(member), score);
+        offset = listpack_.Next(score_offset);
+    }
+    list_ = std::move(list);
+    scores_ = std::move(scores);
+    listpack_ = Listpack();
+}
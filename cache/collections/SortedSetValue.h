@@ -0,0 +1,71 @@
+#ifndef SORTED_SET_VALUE_H
+#define SORTED_SET_VALUE_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Listpack.h"
+#include "SkipList.h"
+
+/**
+ * @class SortedSetValue
+ * @brief A set of unique members, each with a score, ordered by score and then by member.
+ *
+ * Small sets are a listpack of alternating members and scores kept in order, with each score stored as the 8 bytes
+ * of its `double`. The set converts to a skip list, for order and ranks, plus a hash table from members to scores,
+ * for lookups, once it holds more than `Listpack::kMaxEntries` members or any member longer than
+ * `Listpack::kMaxValueBytes`; it never converts back.
+ */
+class SortedSetValue
+{
+public:
+    /**
+     * @brief Adds a member, or updates its score if it is already in the set.
+     *
+     * @return `true` if the member is new.
+     */
+    bool Add(std::string_view member, double score);
+
+    /**
+     * @brief Erases a member.
+     *
+     * @return `false` if the member is not in the set.
+     */
+    bool Erase(std::string_view member);
+
+    /**
+     * @brief Copies the members with ranks `first` to `last` inclusive, which must be in range, with their scores.
+     */
+    void Range(size_t first, size_t last, std::vector<std::pair<std::string, double>> &members) const;
+
+    /**
+     * @brief Returns the number of members.
+     */
+    size_t Size() const { return scores_ ? scores_->size() : listpack_.Size() / 2; }
+
+private:
+    Listpack listpack_; ///< Members and scores in order, while the set is small.
+    std::unique_ptr<SkipList> list_; ///< The members in order once the set has grown.
+    std::unique_ptr<std::unordered_map<std::string, double>> scores_; ///< The members' scores once the set has grown.
+
+    /**
+     * @brief Decodes a score stored in the listpack.
+     */
+    static double DecodeScore(std::string_view bytes);
+
+    /**
+     * @brief Inserts a member into the listpack before the first member that sorts after it.
+     */
+    void InsertSorted(std::string_view member, double score);
+
+    /**
+     * @brief Moves the members from the listpack into the skip list and hash table.
+     */
+    void Convert();
+};
+
+#endif // SORTED_SET_VALUE_H
@@ -0,0 +1,142 @@
+#include "Listpack.h"
+
+size_t Listpack::VarintBytes(size_t length)
+{
+    size_t bytes = 1;
+    while (length >= 0x80)
+    {
+        length >>= 7;
+        ++bytes;
+    }
+    return bytes;
+}
+
+/**
+ * @brief The back length covers the length header and the bytes, and is written with its lowest seven bits last,
+ *        so that a reader coming from the right decodes it in the same order as a forward reader decodes the length.
+ */
+void Listpack::Encode(std::string_view value, std::string &out)
+{
+    size_t length = value.size();
+    while (length >= 0x80)
+    {
+        out.push_back(static_cast<char>((length & 0x7f) | 0x80));
+        length >>= 7;
+    }
+    out.push_back(static_cast<char>(length));
+
+    out.append(value.data(), value.size());
+
+    size_t back = VarintBytes(value.size()) + value.size();
+    char reversed[10];
+    size_t n = 0;
+    while (back >= 0x80)
+    {
+        reversed[n++] = static_cast<char>((back & 0x7f) | 0x80);
+        back >>= 7;
+    }
+    reversed[n++] = static_cast<char>(back);
+    while (n > 0)
+    {
+        out.push_back(reversed[--n]);
+    }
+}
+
+size_t Listpack::DecodeLength(size_t offset, size_t &header) const
+{
+    size_t length = 0;
+    unsigned shift = 0;
+    header = 0;
+    unsigned char byte;
+    do
+    {
+        byte = static_cast<unsigned char>(buffer_[offset + header++]);
+        length |= static_cast<size_t>(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return length;
+}
+
+size_t Listpack::EntryBytes(size_t offset) const
+{
+    size_t header;
+    size_t length = DecodeLength(offset, header);
+    return header + length + VarintBytes(header + length);
+}
+
+size_t Listpack::Next(size_t offset) const
+{
+    size_t next = offset + EntryBytes(offset);
+    return next < buffer_.size() ? next : npos;
+}
+
+size_t Listpack::Prev(size_t offset) const
+{
+    if (offset == 0)
+    {
+        return npos;
+    }
+
+    // Read the back length of the previous entry from right to left
+    size_t back = 0;
+    unsigned shift = 0;
+    size_t end = offset;
+    unsigned char byte;
+    do
+    {
+        byte = static_cast<unsigned char>(buffer_[--end]);
+        back |= static_cast<size_t>(byte & 0x7f) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return end - back;
+}
+
+std::string_view Listpack::Get(size_t offset) const
+{
+    size_t header;
+    size_t length = DecodeLength(offset, header);
+    return std::string_view(buffer_.data() + offset + header, length);
+}
+
+size_t Listpack::Find(std::string_view value, size_t stride) const
+{
+    size_t index = 0;
+    for (size_t offset = First(); offset != npos; offset = Next(offset), ++index)
+    {
+        if (index % stride == 0 && Get(offset) == value)
+        {
+            return offset;
+        }
+    }
+    return npos;
+}
+
+size_t Listpack::Insert(size_t offset, std::string_view value)
+{
+    std::string entry;
+    entry.reserve(value.size() + 2 * VarintBytes(value.size() + 10));
+    Encode(value, entry);
+    buffer_.insert(offset, entry);
+    ++count_;
+    return offset;
+}
+
+void Listpack::Replace(size_t offset, std::string_view value)
+{
+    std::string entry;
+    entry.reserve(value.size() + 2 * VarintBytes(value.size() + 10));
+    Encode(value, entry);
+    buffer_.replace(offset, EntryBytes(offset), entry);
+}
+
+size_t Listpack::Erase(size_t offset, size_t count)
+{
+    size_t end = offset;
+    for (size_t i = 0; i < count; ++i)
+    {
+        end += EntryBytes(end);
+    }
+    buffer_.erase(offset, end - offset);
+    count_ -= count;
+    return offset < buffer_.size() ? offset : npos;
+}
@@ -0,0 +1,136 @@
+#ifndef LISTPACK_H
+#define LISTPACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @class Listpack
+ * @brief A sequence of strings packed back to back in a single buffer.
+ *
+ * Each entry is its length as a little-endian base-128 varint, its bytes, and the size of the two again written
+ * backwards, so that the buffer can be walked in both directions:
+ *
+ *     [len][bytes][backlen] [len][bytes][backlen] ...
+ *
+ * Entries are addressed by their byte offset in the buffer. A small collection stored this way costs one or two
+ * bytes of overhead per entry instead of a node allocation, and scanning it touches consecutive cache lines; in
+ * exchange, inserting or erasing moves every byte after the position, so collections only keep this encoding while
+ * they hold at most `kMaxEntries` entries of at most `kMaxValueBytes` bytes.
+ *
+ * @note The listpack is not synchronized.
+ */
+class Listpack
+{
+public:
+    static constexpr size_t kMaxEntries = 128;   ///< Collections with more entries convert to a larger encoding.
+    static constexpr size_t kMaxValueBytes = 64; ///< Collections with a longer entry convert to a larger encoding.
+    static constexpr size_t npos = SIZE_MAX;     ///< The offset returned past either end.
+
+    /**
+     * @brief Returns the number of entries.
+     */
+    size_t Size() const { return count_; }
+
+    /**
+     * @brief Returns the size of the buffer in bytes.
+     */
+    size_t Bytes() const { return buffer_.size(); }
+
+    /**
+     * @brief Returns the offset of the first entry, or `npos` if the listpack is empty.
+     */
+    size_t First() const { return buffer_.empty() ? npos : 0; }
+
+    /**
+     * @brief Returns the offset of the last entry, or `npos` if the listpack is empty.
+     */
+    size_t Last() const { return buffer_.empty() ? npos : Prev(buffer_.size()); }
+
+    /**
+     * @brief Returns the offset of the entry after the one at `offset`, or `npos` after the last one.
+     */
+    size_t Next(size_t offset) const;
+
+    /**
+     * @brief Returns the offset of the entry before the one at `offset`, or `npos` before the first one.
+     *
+     * @param offset The offset of an entry, or `Bytes()` for the last entry.
+     */
+    size_t Prev(size_t offset) const;
+
+    /**
+     * @brief Returns the bytes of the entry at `offset`. Invalidated by any change to the listpack.
+     */
+    std::string_view Get(size_t offset) const;
+
+    /**
+     * @brief Finds the first entry equal to `value` among every `stride`-th entry.
+     *
+     * @param value The bytes to look for.
+     * @param stride 1 to compare every entry, 2 to compare only the keys of key/value pairs, and so on.
+     * @return The offset of the entry, or `npos` if none matches.
+     */
+    size_t Find(std::string_view value, size_t stride = 1) const;
+
+    /**
+     * @brief Inserts an entry before the one at `offset`.
+     *
+     * @param offset The offset of an entry, or `Bytes()` to append.
+     * @param value The entry's bytes.
+     * @return The offset of the new entry, which is `offset`.
+     */
+    size_t Insert(size_t offset, std::string_view value);
+
+    /**
+     * @brief Replaces the bytes of the entry at `offset`.
+     */
+    void Replace(size_t offset, std::string_view value);
+
+    /**
+     * @brief Erases `count` consecutive entries starting at `offset`.
+     *
+     * @return The offset of the entry that followed them, or `npos` if they were the last ones.
+     */
+    size_t Erase(size_t offset, size_t count = 1);
+
+    /**
+     * @brief Appends an entry.
+     */
+    void PushBack(std::string_view value) { Insert(buffer_.size(), value); }
+
+    /**
+     * @brief Prepends an entry.
+     */
+    void PushFront(std::string_view value) { Insert(0, value); }
+
+private:
+    std::string buffer_; ///< The encoded entries.
+    size_t count_ = 0;   ///< The number of entries.
+
+    /**
+     * @brief Returns the number of bytes the varint encoding of `length` takes.
+     */
+    static size_t VarintBytes(size_t length);
+
+    /**
+     * @brief Encodes an entry, with its length and back length, into `out`.
+     */
+    static void Encode(std::string_view value, std::string &out);
+
+    /**
+     * @brief Decodes the length of the entry at `offset`.
+     *
+     * @param header Receives the number of bytes of the length itself.
+     */
+    size_t DecodeLength(size_t offset, size_t &header) const;
+
+    /**
+     * @brief Returns the total encoded size of the entry at `offset`.
+     */
+    size_t EntryBytes(size_t offset) const;
+};
+
+#endif // LISTPACK_H
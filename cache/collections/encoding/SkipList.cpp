@@ -0,0 +1,144 @@
+#include "SkipList.h"
+
+SkipList::SkipList() : head_(new Node(std::string(), 0.0, kMaxLevel))
+{
+}
+
+SkipList::~SkipList()
+{
+    Node *node = head_;
+    while (node != nullptr)
+    {
+        Node *next = node->levels[0].forward;
+        delete node;
+        node = next;
+    }
+}
+
+bool SkipList::Before(const Node *node, double score, std::string_view member)
+{
+    return node->score < score || (node->score == score && std::string_view(node->member) < member);
+}
+
+size_t SkipList::RandomLevel()
+{
+    size_t level = 1;
+    while (level < kMaxLevel && (rng_() & 3) == 0)
+    {
+        ++level;
+    }
+    return level;
+}
+
+/**
+ * @brief Records, on each level, the last node before the new one and its rank, so that the spans of the links
+ *        that now pass over the new node can be split around it.
+ */
+void SkipList::Insert(std::string member, double score)
+{
+    Node *update[kMaxLevel];
+    size_t rank[kMaxLevel];
+
+    Node *node = head_;
+    for (size_t i = level_; i-- > 0;)
+    {
+        rank[i] = i == level_ - 1 ? 0 : rank[i + 1];
+        while (node->levels[i].forward != nullptr && Before(node->levels[i].forward, score, member))
+        {
+            rank[i] += node->levels[i].span;
+            node = node->levels[i].forward;
+        }
+        update[i] = node;
+    }
+
+    size_t height = RandomLevel();
+    if (height > level_)
+    {
+        for (size_t i = level_; i < height; ++i)
+        {
+            rank[i] = 0;
+            update[i] = head_;
+            head_->levels[i].span = size_;
+        }
+        level_ = height;
+    }
+
+    node = new Node(std::move(member), score, height);
+    for (size_t i = 0; i < height; ++i)
+    {
+        node->levels[i].forward = update[i]->levels[i].forward;
+        update[i]->levels[i].forward = node;
+        node->levels[i].span = update[i]->levels[i].span - (rank[0] - rank[i]);
+        update[i]->levels[i].span = rank[0] - rank[i] + 1;
+    }
+
+    // Links above the new node's height now pass over one more node
+    for (size_t i = height; i < level_; ++i)
+    {
+        ++update[i]->levels[i].span;
+    }
+    ++size_;
+}
+
+bool SkipList::Erase(std::string_view member, double score)
+{
+    Node *update[kMaxLevel];
+
+    Node *node = head_;
+    for (size_t i = level_; i-- > 0;)
+    {
+        while (node->levels[i].forward != nullptr && Before(node->levels[i].forward, score, member))
+        {
+            node = node->levels[i].forward;
+        }
+        update[i] = node;
+    }
+
+    node = node->levels[0].forward;
+    if (node == nullptr || node->score != score || node->member != member)
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < level_; ++i)
+    {
+        if (update[i]->levels[i].forward == node)
+        {
+            update[i]->levels[i].span += node->levels[i].span - 1;
+            update[i]->levels[i].forward = node->levels[i].forward;
+        }
+        else
+        {
+            --update[i]->levels[i].span;
+        }
+    }
+
+    while (level_ > 1 && head_->levels[level_ - 1].forward == nullptr)
+    {
+        --level_;
+    }
+    delete node;
+    --size_;
+    return true;
+}
+
+const SkipList::Node *SkipList::ByRank(size_t rank) const
+{
+    // Ranks count from 1 along the spans, the head being rank 0
+    size_t target = rank + 1;
+    size_t traversed = 0;
+    const Node *node = head_;
+    for (size_t i = level_; i-- > 0;)
+    {
+        while (node->levels[i].forward != nullptr && traversed + node->levels[i].span <= target)
+        {
+            traversed += node->levels[i].span;
+            node = node->levels[i].forward;
+        }
+        if (traversed == target)
+        {
+            return node;
+        }
+    }
+    return nullptr;
+}
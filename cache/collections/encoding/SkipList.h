@@ -0,0 +1,100 @@
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class SkipList
+ * @brief Members ordered by score, then by member, with O(log n) insert, erase and access by rank.
+ *
+ * Every link records how many nodes it skips, so that the rank of a node is the sum of the spans followed to reach
+ * it; this is what lets a range by rank start without walking the nodes before it. A node gets each extra level
+ * with probability 1/4.
+ *
+ * The list only orders members; looking one up by name is the job of a hash table kept beside it.
+ *
+ * @note The list is not synchronized.
+ */
+class SkipList
+{
+public:
+    /**
+     * @brief A member and its score.
+     */
+    struct Node
+    {
+        /**
+         * @brief A link to the next node on one level.
+         */
+        struct Level
+        {
+            Node *forward = nullptr; ///< The next node on this level.
+            size_t span = 0;         ///< The number of nodes the link moves forward by.
+        };
+
+        std::string member;
+        double score;
+        std::vector<Level> levels;
+
+        Node(std::string m, double s, size_t height) : member(std::move(m)), score(s), levels(height) {}
+
+        /**
+         * @brief Returns the node with the next rank, or nullptr after the last one.
+         */
+        const Node *Next() const { return levels[0].forward; }
+    };
+
+    SkipList();
+    ~SkipList();
+
+    SkipList(const SkipList &) = delete;
+    SkipList &operator=(const SkipList &) = delete;
+
+    /**
+     * @brief Inserts a member. It must not be in the list already.
+     */
+    void Insert(std::string member, double score);
+
+    /**
+     * @brief Erases a member.
+     *
+     * @param member The member.
+     * @param score The member's current score, which locates it.
+     * @return `false` if the member was not found under that score.
+     */
+    bool Erase(std::string_view member, double score);
+
+    /**
+     * @brief Returns the node with the given 0-based rank, or nullptr if the rank is out of range.
+     */
+    const Node *ByRank(size_t rank) const;
+
+    /**
+     * @brief Returns the number of members.
+     */
+    size_t Size() const { return size_; }
+
+private:
+    static constexpr size_t kMaxLevel = 32; ///< Enough levels for 4^32 members.
+
+    Node *head_;        ///< A sentinel with `kMaxLevel` levels, before the first member.
+    size_t level_ = 1;  ///< The number of levels in use.
+    size_t size_ = 0;   ///< The number of members.
+    std::minstd_rand rng_; ///< Draws node heights.
+
+    /**
+     * @brief Checks whether a node sorts before the given score and member.
+     */
+    static bool Before(const Node *node, double score, std::string_view member);
+
+    /**
+     * @brief Draws the height of a new node.
+     */
+    size_t RandomLevel();
+};
+
+#endif // SKIP_LIST_H
@@ -2,6 +2,7 @@
 #include <thread>
 
 #include "GeoCache.h"
+#include "ServerStats.h"
 
 /**
  * @brief Evicts the least recently used (LRU) item from the cache.
@@ -25,7 +26,13 @@ void GeoCache::Evict()
         usage_order_.pop_back();
 
         // Remove the LRU key from the cache
-        geo_items_.erase(lru_key);
+        auto key_it = geo_items_.find(lru_key);
+        if (key_it != geo_items_.end())
+        {
+            point_count_.fetch_sub(key_it->second.size(), std::memory_order_relaxed);
+            geo_items_.erase(key_it);
+        }
+        ServerStats::Instance().Add(Stat::kGeoEvictions);
 
         // Log the eviction of the least recently used item
         file_logger_->info("Evicted least recently used item from Geo cache: '" + lru_key + "'");
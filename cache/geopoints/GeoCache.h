@@ -8,11 +8,13 @@
 #include <chrono>
 #include <thread>
 #include <list>
+#include <atomic>
 
 #include "GeoPoint.h"
 #include "RTree.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
+#include "TimedMutex.h"
 #include "IGeoCache.h"
 
 /**
@@ -70,13 +72,19 @@ public:
      */
     bool GeoPath(const GeoPoint &point1, const GeoPoint &point2) override;
 
+    /**
+     * @brief Returns the number of geo-spatial points held, without taking the cache's lock.
+     */
+    size_t Size() const override { return point_count_.load(std::memory_order_relaxed); }
+
 private : 
     size_t max_size_;
     std::unordered_map<std::string, std::unordered_map<std::string, GeoPoint>> geo_items_;
     std::list<std::string> usage_order_; ///< A list to keep track of the usage order of keys, implementing LRU eviction.
     typedef RTree<std::string, float, 2, float> RTreeType;
     RTreeType rtree_;
-    std::mutex mutex_; ///< A mutex to ensure thread-safe operations on the cache.
+    TimedMutex mutex_; ///< A mutex to ensure thread-safe operations on the cache.
+    std::atomic<size_t> point_count_{0}; ///< Mirror of the number of points in `geo_items_`, readable without the lock.
     std::shared_ptr<FileLogger> file_logger_;
     std::unordered_map<std::string, std::vector<std::pair<std::string, GeoPoint>>> adjList; ///< An adjacency list to keep track of connecting edges.
 
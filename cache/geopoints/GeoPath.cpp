@@ -3,7 +3,7 @@
 bool GeoCache::GeoPath(const GeoPoint &point1, const GeoPoint &point2)
 {
     // Acquire a lock to ensure thread safety when accessing shared resources.
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<TimedMutex> lock(mutex_);
 
     // Calculate the distance using GetGeoDistance.
     double distance = GetGeoDistance(point1, point2);
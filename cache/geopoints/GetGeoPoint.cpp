@@ -1,4 +1,5 @@
 #include "GeoCache.h"
+#include "ServerStats.h"
 
 // The GetGeoPoint function tries to find a GeoPoint object associated with the given key in the cache.
 // If both the outer key and the inner key (name of the GeoPoint) exist, it returns true and outputs
@@ -22,7 +23,7 @@
 bool GeoCache::GetGeoPoint(const std::string &key, const std::string &name, GeoPoint &point)
 {
     // Acquire a lock to ensure thread safety when accessing the shared resource 'geo_items_'.
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<TimedMutex> lock(mutex_);
 
     // Attempt to find the outer key in the geo_items_ map.
     auto outer_it = geo_items_.find(key);
@@ -43,10 +44,12 @@ bool GeoCache::GetGeoPoint(const std::string &key, const std::string &name, GeoP
                                ", Longitude: " + std::to_string(point.longitude) +
                                ", Longitude: " + std::to_string(point.elevation) +
                                ")");
+            ServerStats::Instance().Add(Stat::kGeoHits);
             return true; // Indicate that the GeoPoint object was found.
         }
     }
 
     // If either key does not exist in the cache, return false to indicate failure.
+    ServerStats::Instance().Add(Stat::kGeoMisses);
     return false;
 }
\ No newline at end of file
@@ -40,6 +40,11 @@ public:
     virtual double GetGeoDistance(const GeoPoint &point1, const GeoPoint &point2) = 0;
 
     virtual bool GeoPath(const GeoPoint &point1, const GeoPoint &point2) = 0;
+
+    /**
+     * @brief Returns the number of geo-spatial points held, without taking the cache's lock.
+     */
+    virtual size_t Size() const = 0;
 };
 
 #endif // IGEO_CACHE_H
\ No newline at end of file
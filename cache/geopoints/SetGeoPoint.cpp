@@ -1,4 +1,5 @@
 #include "GeoCache.h"
+#include "ServerStats.h"
 
 /**
  * @brief Inserts or updates a geographic point in the cache and the R-tree index.
@@ -16,7 +17,7 @@
 void GeoCache::SetGeoPoint(const std::string &key, const GeoPoint &point)
 {
     // Lock the mutex to ensure thread-safe access to the cache and R-tree
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<TimedMutex> lock(mutex_);
 
     // Check if a point with the given key already exists in the cache
     auto key_it = geo_items_.find(key);
@@ -40,7 +41,13 @@ void GeoCache::SetGeoPoint(const std::string &key, const GeoPoint &point)
     float min[3] = {point.longitude, point.latitude, point.elevation};
     float max[3] = {point.longitude, point.latitude, point.elevation};
     rtree_.Insert(min, max, key + ":" + point.name); // Use 3D bounding box for the new point
-    geo_items_[key][point.name] = point;             // Update the cache with the new point
+    auto &points = geo_items_[key];
+    if (points.find(point.name) == points.end())
+    {
+        point_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+    points[point.name] = point;                      // Update the cache with the new point
+    ServerStats::Instance().Add(Stat::kGeoSets);
 
     // Log the operation
     file_logger_->info("Set GeoPoint: " + key + " (Name: " + point.name +
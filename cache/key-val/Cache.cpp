@@ -3,26 +3,58 @@
 #include <sstream>
 
 #include "Cache.h"
+#include "EvictionPolicyFactory.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
 
 /**
  * @brief Constructs a Cache object with a specified maximum size.
  *
- * Initializes the LRU (Least Recently Used) cache with a maximum capacity defined by `max_size`. The constructor also
- * sets up logging using `FileLogger` and starts a background thread responsible for periodically cleaning up expired
- * cache items. The background cleanup thread runs indefinitely to ensure that the cache remains free of stale data
- * and operates efficiently.
+ * Initializes the cache with a maximum capacity defined by `max_size` and the named eviction policy. The constructor
+ * also sets up logging using `FileLogger` and starts a background thread responsible for periodically cleaning up
+ * expired cache items. The background cleanup thread runs until the cache is destroyed to ensure that the cache
+ * remains free of stale data and operates efficiently.
  *
  * The cache maintains a limit on the number of items it can store. When the cache reaches this limit, it automatically
- * evicts the least recently used items to make room for new entries. This behavior ensures that the cache always contains
- * the most recently accessed data, providing efficient access and memory usage.
+ * evicts the items chosen by the eviction policy to make room for new entries.
  *
  * @param max_size The maximum number of items that the cache can hold. Once this limit is reached, the cache will
- *                 evict the least recently used items to accommodate new entries. The `max_size` should be set according
+ *                 evict items to accommodate new entries. The `max_size` should be set according
  *                 to the application's requirements to balance between memory usage and cache performance.
+ * @param eviction_policy The name of the policy that picks which entry to evict, e.g. "lru", "clock", "lfu",
+ *                        "tinylfu", "arc" or "s3fifo". See `CreateEvictionPolicy`.
+ * @param max_memory The byte budget for keys, values and per-entry overhead. When it is non-zero, the cache evicts
+ *                   until a new entry fits in the budget, in addition to enforcing `max_size`.
+ * @param lazy_free_threshold The size from which the values of removed entries are handed to a second background
+ *                            thread to be freed, so that dropping a large value never happens under the cache lock.
+ *                            Only values stored in shared buffers (`CacheItem::kMinSharedValue` bytes and up) can be
+ *                            deferred; 0 frees every value inline.
+ * @param ordered_index Whether to keep the keys in a B+-tree as well as the hash index, for prefix and range
+ *                      queries in O(log n + matches). Costs an extra index update on every insert and erase.
+ * @param spill_path A file on local disk where evicted values are kept as a second tier and promoted back to memory
+ *                   on access, or an empty string to discard evicted values. The file is truncated.
+ * @param spill_max_bytes The size of the disk tier's file; the oldest spilled values are dropped when it is full.
+ * @throws std::invalid_argument If the policy name is unknown or `spill_max_bytes` is too small.
+ * @throws std::runtime_error If the disk tier's file cannot be created.
  */
-Cache::Cache(size_t max_size) : max_size_(max_size)
+Cache::Cache(size_t max_size,
+             const std::string &eviction_policy,
+             size_t max_memory,
+             size_t lazy_free_threshold,
+             bool ordered_index,
+             const std::string &spill_path,
+             size_t spill_max_bytes)
+    : max_size_(max_size),
+      max_memory_(max_memory),
+      ordered_(ordered_index ? std::make_unique<OrderedIndex>() : nullptr),
+      spill_(spill_path.empty() ? nullptr : std::make_unique<SpillStore>(spill_path, spill_max_bytes)),
+      policy_(CreateEvictionPolicy(eviction_policy)),
+      lazy_free_threshold_(lazy_free_threshold),
+      // Versions continue from the wall clock, so that a version handed out before a restart is not reused
+      version_clock_(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                               std::chrono::system_clock::now().time_since_epoch())
+                                               .count())),
+      stats_(ServerStats::Instance())
 {
     // Initialize the file logger with a unique log file name based on the current thread ID
     std::ostringstream oss;
@@ -36,22 +68,51 @@ Cache::Cache(size_t max_size) : max_size_(max_size)
 
     // Start the background thread for cache cleanup
     // This thread will periodically remove expired cache items to ensure the cache remains efficient
-    std::thread(&Cache::Cleanup, this).detach();
+    cleanup_thread_ = std::thread(&Cache::Cleanup, this);
+
+    // Start the background thread that frees large values of removed entries off the cache lock
+    lazy_free_thread_ = std::thread(&Cache::LazyFree, this);
 }
 
 /**
  * @brief Destroys the Cache object and cleans up resources.
  *
- * The destructor logs a message indicating the destruction of the cache. While the destructor does not explicitly stop
- * the background cleanup thread, it ensures that the cache's lifecycle is properly logged. The cleanup thread will
- * continue to run until the application terminates, and it will handle the removal of expired items from the cache.
- *
- * @note The background cleanup thread runs indefinitely. It is essential to manage the thread's lifecycle carefully to
- *       avoid resource leaks or undefined behavior. Proper application shutdown procedures should ensure that all threads
- *       are joined or otherwise handled before the application exits.
+ * The destructor wakes the background cleanup thread, waits for it to finish, frees the remaining entries, lets the
+ * lazy-free thread drain its queue and logs a message indicating the destruction of the cache.
  */
 Cache::~Cache()
 {
+    // Stop the cleanup thread before the members it uses go away
+    {
+        std::lock_guard<std::mutex> lock(cleanup_mutex_);
+        stopping_ = true;
+    }
+    cleanup_cv_.notify_all();
+    if (cleanup_thread_.joinable())
+    {
+        cleanup_thread_.join();
+    }
+
+    // Free the entries; the index and the policy only hold pointers to them
+    for (size_t slot = 0; slot < items_.SlotCount(); ++slot)
+    {
+        if (CacheItem *item = items_.At(slot))
+        {
+            CacheItem::Destroy(slabs_, item);
+        }
+    }
+
+    // Let the lazy-free thread free what is still queued, then stop it
+    {
+        std::lock_guard<std::mutex> lock(lazy_free_mutex_);
+        lazy_free_stopping_ = true;
+    }
+    lazy_free_cv_.notify_all();
+    if (lazy_free_thread_.joinable())
+    {
+        lazy_free_thread_.join();
+    }
+
     // Log the destruction of the cache
     file_logger_->info("Cache destroyed");
     std::cout << "Cache destroyed" << std::endl;
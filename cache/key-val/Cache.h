@@ -1,36 +1,76 @@
 #ifndef CACHE_H
 #define CACHE_H
 
-#include <unordered_map>
-#include <list>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
 
 #include "ICache.h"
+#include "CacheItem.h"
+#include "IEvictionPolicy.h"
+#include "TimerWheel.h"
+#include "SwissIndex.h"
+#include "OrderedIndex.h"
+#include "SpillStore.h"
 #include "GeoPoint.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
 #include "RTree.h"
+#include "ServerStats.h"
+#include "TimedMutex.h"
 
 /**
  * @class Cache
  * @brief A thread-safe, size-limited cache implementation with time-to-live (TTL) support.
  * 
  * This class implements the ICache interface and provides a cache system that can store, retrieve, 
- * and delete key-value pairs with associated expiration times. It supports a maximum size to limit 
- * memory usage and uses an LRU (Least Recently Used) strategy to evict entries when the cache is full.
+ * and delete key-value pairs with associated expiration times. It supports a maximum number of entries
+ * and an optional byte budget to limit memory usage, and delegates the choice of which entry to evict when the cache is full to a pluggable
+ * `IEvictionPolicy` (LRU by default).
  */
 class Cache : public ICache
 {
 public:
+    /**
+     * @brief The default size from which values of removed entries are freed by the lazy-free thread.
+     */
+    static constexpr size_t kDefaultLazyFreeThreshold = 64 * 1024;
+
+    /**
+     * @brief The default size of the disk tier's file.
+     */
+    static constexpr size_t kDefaultSpillBytes = size_t(1) << 30;
+
     /**
      * @brief Constructs a Cache object with a specified maximum size.
      * 
      * Initializes a cache with a maximum number of entries that can be stored. If the cache reaches 
-     * the maximum size, it will evict the least recently used (LRU) entries to make space for new ones.
+     * the maximum size, or storing an entry would exceed the byte budget, it will ask the eviction policy
+     * for victims until the new entry fits.
      * 
      * @param max_size The maximum number of entries the cache can hold. Defaults to 1000.
+     * @param eviction_policy The name of the eviction policy, see `EvictionPolicyNames()`. Defaults to "lru".
+     * @param max_memory The byte budget for keys, values and per-entry overhead. 0 (the default) disables it.
+     * @param lazy_free_threshold Values at least this large are freed on a background thread when their entry is
+     *                            deleted, evicted, expired or overwritten. 0 frees every value inline.
+     * @param ordered_index Whether to also keep the keys in an `OrderedIndex`, which `Keys` uses for literal
+     *                      prefixes and `Range` and `DeletePrefix` require.
+     * @param spill_path A file to keep evicted values in as a second tier (see `SpillStore`), or an empty string to
+     *                   discard evicted values.
+     * @param spill_max_bytes The size of the disk tier's file.
+     * @throws std::invalid_argument If the policy name is unknown or `spill_max_bytes` is too small.
+     * @throws std::runtime_error If the disk tier's file cannot be created.
      */
-    explicit Cache(size_t max_size = 1000);
+    explicit Cache(size_t max_size = 1000,
+                   const std::string &eviction_policy = "lru",
+                   size_t max_memory = 0,
+                   size_t lazy_free_threshold = kDefaultLazyFreeThreshold,
+                   bool ordered_index = false,
+                   const std::string &spill_path = "",
+                   size_t spill_max_bytes = kDefaultSpillBytes);
 
     /**
      * @brief Destructor for the Cache class.
@@ -43,25 +83,50 @@ public:
      * @brief Stores a key-value pair in the cache with a specified duration.
      * 
      * Adds a key-value pair to the cache with a specified time-to-live (TTL). If the cache exceeds its 
-     * maximum size, the least recently used item will be evicted. If the key already exists, its value 
+     * maximum size, the eviction policy's victim will be evicted. If the key already exists, its value 
      * is updated, and its TTL is reset.
      * 
      * @param key A string representing the key.
      * @param value A string representing the value associated with the key.
-     * @param duration The time-to-live for the key-value pair. Specified as a duration of type `std::chrono::seconds`.
+     * @param duration The time-to-live for the key-value pair. Specified as a duration of type `std::chrono::seconds`;
+     *                 0 means the pair never expires.
+     * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than
+     *                           the byte budget.
      */
     void Set(const std::string &key, 
              const std::string &value, 
              std::chrono::seconds duration
     ) override;
 
+    /**
+     * @brief Stores a key-value pair, moving a large value into a shared buffer instead of copying it.
+     *
+     * @param key A string representing the key.
+     * @param value The value, moved from.
+     * @param duration The time-to-live for the key-value pair; 0 means the pair never expires.
+     * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than
+     *                           the byte budget.
+     */
+    void Set(const std::string &key, std::string &&value, std::chrono::seconds duration) override;
+
+    /**
+     * @brief Stores a key-value pair, sharing the handle's buffer if the value is large.
+     *
+     * @param key A string representing the key.
+     * @param value A handle to the value.
+     * @param duration The time-to-live for the key-value pair; 0 means the pair never expires.
+     * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than
+     *                           the byte budget.
+     */
+    void Set(const std::string &key, const CacheValue &value, std::chrono::seconds duration) override;
+
     /**
      * @brief Retrieves the value associated with a specified key.
      * 
      * Tries to find a value associated with the provided key. If the key exists in the cache and has not 
      * expired, the value is stored in the output parameter `value`, and the function returns true. If the 
-     * key does not exist or has expired, the function returns false. The access will also move the key to 
-     * the front of the usage order list, marking it as most recently used.
+     * key does not exist or has expired, the function returns false. The access is also reported to the 
+     * eviction policy, marking the key as recently used.
      * 
      * @param key A string representing the key to search for in the cache.
      * @param value A reference to a string where the found value will be stored.
@@ -69,6 +134,18 @@ public:
      */
     bool Get(const std::string &key, std::string &value) override;
 
+    /**
+     * @brief Retrieves an immutable handle to the value associated with a specified key.
+     *
+     * For a large value, only a reference count is updated under the lock; smaller values are copied into the
+     * handle.
+     *
+     * @param key A string representing the key to search for in the cache.
+     * @param value Receives a handle to the value if found.
+     * @return `true` if the key exists and has not expired, otherwise `false`.
+     */
+    bool Get(const std::string &key, CacheValue &value) override;
+
     /**
      * @brief Deletes a key-value pair from the cache.
      * 
@@ -79,47 +156,427 @@ public:
      */
     void Delete(const std::string &key) override;
 
+    /**
+     * @brief Adds to an integer value in place under the exclusive lock.
+     *
+     * Integer values are stored as 8-byte integers, so the update neither parses nor copies the value.
+     *
+     * @param key The key of the counter.
+     * @param delta The amount to add, which may be negative.
+     * @return The new value.
+     * @throws std::invalid_argument If the value is not an integer.
+     * @throws std::out_of_range If the result would overflow a 64-bit integer.
+     * @throws std::length_error If a missing key is longer than `CacheItem::kMaxKeySize`.
+     */
+    int64_t IncrBy(const std::string &key, int64_t delta) override;
+
+    /**
+     * @brief Adds to a floating-point value under the exclusive lock.
+     *
+     * @param key The key of the counter.
+     * @param delta The amount to add, which may be negative.
+     * @return The new value, in the shortest decimal form that reads back exactly.
+     * @throws std::invalid_argument If the value is not a number or the result is not finite.
+     * @throws std::length_error If a missing key is longer than `CacheItem::kMaxKeySize`.
+     */
+    std::string IncrByFloat(const std::string &key, double delta) override;
+
+    /**
+     * @brief Appends to a value in place under the exclusive lock.
+     *
+     * @param key The key to append to.
+     * @param suffix The bytes to append.
+     * @return The length of the value after the append.
+     * @throws std::length_error If the key is too long or the resulting entry alone is larger than the byte budget.
+     */
+    size_t Append(const std::string &key, const std::string &suffix) override;
+
+    /**
+     * @brief Replaces a value and returns the previous one under a single exclusive lock acquisition.
+     *
+     * @param key The key to set.
+     * @param value The new value.
+     * @param old_value Receives the previous value if the key existed.
+     * @return `true` if the key existed and had not expired.
+     * @throws std::length_error If the key is too long or the entry alone is larger than the byte budget.
+     */
+    bool GetSet(const std::string &key, const std::string &value, std::string &old_value) override;
+
+    /**
+     * @brief Retrieves a handle to a value together with the entry's version.
+     *
+     * @param key The key to look up.
+     * @param value Receives a handle to the value if found.
+     * @param version Receives the entry's version if found.
+     * @return `true` if the key exists and has not expired.
+     */
+    bool GetVersioned(const std::string &key, CacheValue &value, uint64_t &version) override;
+
+    /**
+     * @brief Stores a value only if the entry still has the expected version, under a single exclusive lock
+     *        acquisition.
+     *
+     * @param key The key to set.
+     * @param value The new value.
+     * @param version The expected version, or 0 to store only if the key does not exist.
+     * @param duration The new TTL in seconds, or 0 for an entry that never expires.
+     * @param new_version Receives the entry's version after a successful store.
+     * @return Whether the value was stored, and why not otherwise.
+     * @throws std::length_error If the key is too long or the entry alone is larger than the byte budget.
+     */
+    CasResult CompareAndSet(const std::string &key,
+                            const std::string &value,
+                            uint64_t version,
+                            std::chrono::seconds duration,
+                            uint64_t &new_version) override;
+
+    /**
+     * @brief Retrieves the values of several keys under a single lock acquisition.
+     *
+     * The keys are hashed before the lock is taken. Like `Get`, the lock is shared if the eviction policy allows it.
+     *
+     * @param keys The keys to look up.
+     * @param values Receives one value per key, empty for keys that were not found.
+     * @param found Receives, for each key, whether it exists and has not expired.
+     * @return The number of keys found.
+     */
+    size_t MGet(const std::vector<std::string> &keys,
+                std::vector<std::string> &values,
+                std::vector<bool> &found) override;
+
+    /**
+     * @brief Stores several key-value pairs under a single exclusive lock acquisition.
+     *
+     * Every pair is validated and hashed before the lock is taken, so a refused pair leaves the cache untouched.
+     *
+     * @param entries The pairs to store, in order; a later pair for the same key wins.
+     * @throws std::length_error If any key is longer than `CacheItem::kMaxKeySize` or any entry alone is larger
+     *                           than the byte budget.
+     */
+    void MSet(const std::vector<CacheSetRequest> &entries) override;
+
+    /**
+     * @brief Deletes several keys under a single exclusive lock acquisition.
+     *
+     * @param keys The keys to delete.
+     * @param deleted Receives, for each key, whether it existed.
+     * @return The number of keys deleted.
+     */
+    size_t MDelete(const std::vector<std::string> &keys, std::vector<bool> &deleted) override;
+
+    /**
+     * @brief Iterates over the keys a few at a time with a stateless cursor, holding the lock only shared and
+     *        briefly.
+     *
+     * @param cursor 0 to start a scan, or the value returned by the previous call.
+     * @param pattern A glob-style pattern (see `GlobMatch`), or an empty string to return every key.
+     * @param count A hint for how many keys to examine per call.
+     * @param keys Receives the matching keys of this call.
+     * @return The cursor to pass to the next call, or 0 once the scan is complete.
+     */
+    size_t Scan(size_t cursor, const std::string &pattern, size_t count, std::vector<std::string> &keys) override;
+
+    /**
+     * @brief Reports the accounted memory usage and the limits without taking the cache lock.
+     *
+     * @return A snapshot of the memory accounting.
+     */
+    CacheMemoryStats MemoryStats() override;
+
+    /**
+     * @brief Reports the bytes accounted to a single key.
+     *
+     * @param key The key to look up.
+     * @param bytes Receives the key's footprint if it exists.
+     * @return `true` if the key exists and has not expired, otherwise `false`.
+     */
+    bool MemoryUsage(const std::string &key, size_t &bytes) override;
+
+    /**
+     * @brief Reports the usage of each size class of the slab allocator holding the entries.
+     *
+     * @return One entry per size class in use, by increasing chunk size.
+     */
+    std::vector<SlabClassStats> SlabStats() override;
+
+    /**
+     * @brief Reports the most frequently accessed keys, as estimated from a sample of the reads and writes.
+     *
+     * @param count The most keys to return.
+     * @return The hottest keys by decreasing estimated access count; empty while tracking is disabled.
+     */
+    std::vector<HotKey> HotKeys(size_t count) override;
+
+    /**
+     * @brief Returns every key matching a glob-style pattern, in key order if the ordered index is enabled.
+     *
+     * @param pattern A glob-style pattern (see `GlobMatch`), or an empty string to return every key.
+     * @param keys Receives the matching keys.
+     */
+    void Keys(const std::string &pattern, std::vector<std::string> &keys) override;
+
+    /**
+     * @brief Returns the keys in `[start, end)` in key order from the ordered index.
+     *
+     * @param start The smallest key to return.
+     * @param end The first key past the range, or an empty string for no upper bound.
+     * @param limit The most keys to return, or 0 for no limit.
+     * @param keys Receives the keys in the range.
+     * @throws std::logic_error If the ordered index is disabled.
+     */
+    void Range(const std::string &start, const std::string &end, size_t limit, std::vector<std::string> &keys) override;
+
+    /**
+     * @brief Deletes every key starting with a prefix, found through the ordered index.
+     *
+     * @param prefix The prefix.
+     * @return The number of keys deleted.
+     * @throws std::logic_error If the ordered index is disabled.
+     */
+    size_t DeletePrefix(const std::string &prefix) override;
+
+    /**
+     * @brief Enables, disables or changes the sampling of accesses for hot-key tracking, and forgets past counts.
+     *
+     * @param sample_rate Count one access in `sample_rate`; 1 counts every access and 0 disables tracking.
+     */
+    void ConfigureHotKeys(uint32_t sample_rate) override;
+
+    /**
+     * @brief Reports the hot-key sample rate.
+     *
+     * @return One access in this many is counted, or 0 if tracking is disabled.
+     */
+    uint32_t HotKeysSampleRate() override;
+
+    /**
+     * @brief Forgets the access counts gathered for hot-key tracking.
+     */
+    void ResetHotKeys() override;
+
 private:
     /**
-     * @struct CacheItem
-     * @brief A structure to hold a cache entry's value and expiration time.
+     * @brief Fixed bytes accounted to every entry: the `CacheItem` header and version with the allocator header,
+     *        and its share of index slots at the maximum 7/8 load factor.
+     */
+    static constexpr size_t kEntryOverhead =
+        CacheItem::kRecordHeader + sizeof(void *) + SwissIndex::kSlotBytes * 8 / 7;
+
+    /**
+     * @brief The most entries `Cleanup` expires per exclusive lock acquisition, so reaping a large batch of expired
+     *        keys never blocks other operations for long.
+     */
+    static constexpr size_t kExpireBatch = 256;
+
+    /**
+     * @brief The most index groups `Scan` visits per shared lock acquisition.
+     */
+    static constexpr size_t kScanStepsPerLock = 64;
+
+    /**
+     * @brief The most keys `DeletePrefix` deletes per exclusive lock acquisition.
      */
-    struct CacheItem
-    {
-        std::string value;                             ///< The cached value associated with the key.
-        std::chrono::steady_clock::time_point expiration; ///< The expiration time point for the cache entry.
-    };
+    static constexpr size_t kDeletePrefixBatch = 256;
 
     size_t max_size_;  ///< The maximum number of entries the cache can hold.
-    std::unordered_map<std::string, std::pair<CacheItem, std::list<std::string>::iterator>> items_; ///< A hash map to store cache items and iterators to their positions in the usage order list.
-    std::list<std::string> usage_order_; ///< A list to keep track of the usage order of keys, implementing LRU eviction.
-    std::mutex mutex_; ///< A mutex to ensure thread-safe operations on the cache.
+    size_t max_memory_; ///< The byte budget, or 0 if only `max_size_` applies.
+    std::atomic<size_t> used_memory_{0}; ///< Bytes accounted to all entries. Written under the exclusive lock.
+    std::atomic<size_t> key_count_{0}; ///< Mirror of `items_.size()` readable without the lock.
+    SlabAllocator slabs_; ///< Holds the entry records and their external values.
+    SwissIndex items_; ///< Indexes the slab-allocated cache items, which never move, so policies can link them intrusively.
+    std::unique_ptr<OrderedIndex> ordered_; ///< Orders the same items by key for prefix and range queries, or null if disabled.
+    std::unique_ptr<SpillStore> spill_; ///< Keeps evicted values on disk, or null if disabled. Holds no key that is in `items_`.
+    std::unique_ptr<IEvictionPolicy> policy_; ///< Orders the entries and picks eviction victims.
+    TimerWheel expiry_; ///< Indexes entries with a TTL by expiration time for `Cleanup`.
+    TimedSharedMutex mutex_; ///< Guards the cache. Writers lock it exclusively; GETs share it if the policy allows.
     std::shared_ptr<FileLogger> file_logger_; ///< A file logger to log activities.
+    std::thread cleanup_thread_; ///< The background thread running `Cleanup`.
+    std::mutex cleanup_mutex_; ///< Protects `stopping_` for the cleanup thread's wait.
+    std::condition_variable cleanup_cv_; ///< Wakes the cleanup thread early when the cache is destroyed.
+    bool stopping_ = false; ///< Set by the destructor to stop the cleanup thread.
+    size_t lazy_free_threshold_; ///< The smallest value freed by `LazyFree`, or 0 to free inline.
+    std::atomic<size_t> lazy_free_pending_{0}; ///< Bytes of values queued for `LazyFree`.
+    std::vector<CacheValue> lazy_free_queue_; ///< References to values waiting to be freed.
+    std::thread lazy_free_thread_; ///< The background thread running `LazyFree`.
+    std::mutex lazy_free_mutex_; ///< Protects `lazy_free_queue_` and `lazy_free_stopping_`.
+    std::condition_variable lazy_free_cv_; ///< Wakes the lazy-free thread when values are queued.
+    bool lazy_free_stopping_ = false; ///< Set by the destructor to stop the lazy-free thread once the queue is empty.
+    HotKeyTracker hot_keys_; ///< Samples key accesses outside the cache lock to find the hottest keys.
+    uint64_t version_clock_; ///< The last version given to an entry. Written under the exclusive lock.
+    ServerStats &stats_; ///< The process-wide counters INFO reports.
 
     /**
      * @brief Cleans up expired cache entries.
      * 
-     * Iterates through the cache and removes any entries that have expired. This function ensures that the cache 
-     * does not hold onto expired data unnecessarily.
+     * Every timer wheel tick, removes the entries that have expired since the last tick, in batches of at most
+     * `kExpireBatch`. This function ensures that the cache does not hold onto expired data unnecessarily.
      */
     void Cleanup();
 
     /**
-     * @brief Moves a key to the front of the usage order list.
-     * 
-     * Updates the usage order to mark a key as the most recently used. This is part of the LRU eviction strategy.
-     * 
-     * @param key The key to move to the front of the usage order.
+     * @brief Frees queued values off the cache lock until the cache is destroyed.
+     *
+     * Runs on `lazy_free_thread_`. Each wakeup takes the whole queue and drops its references without holding any
+     * lock, so freeing a large value never delays cache operations.
+     */
+    void LazyFree();
+
+    /**
+     * @brief Queues the value of an entry about to lose it for `LazyFree`, if the value is large enough.
+     *
+     * The queue holds its own reference to the value's shared buffer, so when the entry then drops its reference
+     * under the cache lock the buffer survives until the lazy-free thread drops the last one.
+     *
+     * @note This method assumes that the caller already holds the mutex lock exclusively.
+     *
+     * @param item An entry that is about to be erased or have its value replaced.
+     */
+    void DeferFree(const CacheItem &item);
+
+    /**
+     * @brief Refuses entries that can never be stored.
+     *
+     * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize`, the value longer than
+     *                           `CacheItem::kMaxValueSize`, or the entry alone is larger than the byte budget.
+     */
+    void CheckEntry(const std::string &key, std::string_view value) const;
+
+    /**
+     * @brief Computes the expiration time of an entry set now, `time_point::max()` for a zero TTL.
+     */
+    static std::chrono::steady_clock::time_point ExpirationAfter(std::chrono::seconds duration);
+
+    /**
+     * @brief Validates and stores a key-value pair; the body shared by the `Set` overloads.
+     *
+     * @param shared A handle holding `value`, whose buffer is shared instead of copied if the value is large.
+     */
+    void Store(const std::string &key,
+               std::string_view value,
+               const CacheValue *shared,
+               std::chrono::seconds duration);
+
+    /**
+     * @brief Inserts or updates a validated entry. The caller holds the exclusive lock.
+     *
+     * @param shared A handle holding `value`, whose buffer is shared instead of copied if the value is large.
+     * @return `true` if a new entry was inserted, `false` if an existing one was updated.
+     */
+    bool SetLocked(const std::string &key,
+                   size_t hash,
+                   std::string_view value,
+                   std::chrono::steady_clock::time_point expiration,
+                   const CacheValue *shared = nullptr);
+
+    /**
+     * @brief Looks up a key and reports the hit to the eviction policy. The caller holds the lock, exclusively if
+     *        `exclusive` is set.
+     *
+     * Under a shared lock, expired entries are left in place and misses are not reported to the eviction policy.
+     *
+     * @return The entry if the key is found and not expired, otherwise `nullptr`.
+     */
+    CacheItem *GetLocked(const std::string &key,
+                         size_t hash,
+                         std::chrono::steady_clock::time_point now,
+                         bool exclusive);
+
+    /**
+     * @brief Reads an entry's value under the lock: copies a small value into `value`, or takes a handle to a
+     *        shared one into `deferred` so the copy can be made after the lock is released.
+     */
+    static void ReadValue(const CacheItem &item, std::string &value, CacheValue &deferred);
+
+    /**
+     * @brief Removes a key if it exists. The caller holds the exclusive lock.
+     *
+     * @return `true` if the key existed.
+     */
+    bool DeleteLocked(const std::string &key, size_t hash);
+
+    /**
+     * @brief Finds a key that has not expired, erasing it if it has. The caller holds the exclusive lock.
+     *
+     * @return The live entry, or `nullptr`.
+     */
+    CacheItem *FindLive(const std::string &key, size_t hash);
+
+    /**
+     * @brief Checks whether a key may be on the disk tier. The caller holds the lock, at least shared.
+     *
+     * @param hash `SwissIndex::Hash(key)`.
+     * @return `false` if the disk tier is disabled or definitely does not hold the key.
+     */
+    bool MaybeSpilled(size_t hash) const { return spill_ && spill_->MayContain(hash); }
+
+    /**
+     * @brief Writes an entry that is about to be evicted to the disk tier. The caller holds the exclusive lock.
+     *
+     * @param key The entry's key.
+     * @param item The entry.
+     * @return `true` if the value was written; expired entries and values larger than a segment are not.
+     */
+    bool Spill(const std::string &key, const CacheItem &item);
+
+    /**
+     * @brief Moves a key from the disk tier back to memory. The caller holds the exclusive lock.
+     *
+     * @param key The key, which is not in memory.
+     * @param hash `SwissIndex::Hash(key)`.
+     * @param now The time against which the entry's expiration is checked.
+     * @return The promoted entry, or `nullptr` if the disk tier does not hold the key or its entry expired.
      */
-    void MoveToFront(const std::string &key);
+    CacheItem *Promote(const std::string &key, size_t hash, std::chrono::steady_clock::time_point now);
 
     /**
-     * @brief Evicts the least recently used item from the cache.
+     * @brief Re-accounts an entry whose value changed in place, then evicts other entries while over the byte
+     *        budget. The caller holds the exclusive lock.
+     *
+     * @param item The modified entry, which is never evicted here.
+     * @param old_footprint `Footprint(item)` before the change.
+     */
+    void Reaccount(CacheItem &item, size_t old_footprint);
+
+    /**
+     * @brief Evicts the eviction policy's victim from the cache.
      * 
-     * This function removes the least recently used item from the cache when the cache reaches its maximum size.
-     * It ensures that the cache can make space for new entries while adhering to the LRU policy.
+     * This function removes one item from the cache when the cache reaches its maximum size, so that the cache
+     * can make space for new entries. Which item goes is up to `policy_`.
+     *
+     * @param keep An entry that must not be evicted, e.g. the one currently being updated. If the policy picks it,
+     *             it is handed back to the policy and nothing is evicted.
+     * @return `true` if an entry was evicted.
+     */
+    bool Evict(CacheItem *keep = nullptr);
+
+    /**
+     * @brief Removes an entry from `items_` and the timer wheel, releases its memory accounting and frees it.
+     *
+     * The entry must already be detached from the eviction policy.
+     *
+     * @param item The entry to erase.
+     */
+    void EraseItem(CacheItem *item);
+
+    /**
+     * @brief Computes the bytes accounted to an entry.
+     *
+     * Counts the slab chunks of the entry's record and of its external value, if any, plus the entry's share of
+     * index slots and, if enabled, of the ordered index's leaves.
+     *
+     * @param item The entry.
+     * @return The entry's footprint in bytes.
+     */
+    size_t Footprint(const CacheItem &item) const;
+
+    /**
+     * @brief Checks whether the entry count or accounted bytes exceed the limits after adding `incoming` bytes.
+     *
+     * @param incoming Bytes about to be added, or 0 to check the current state.
+     * @param extra_entries Entries about to be added.
+     * @return `true` if eviction is needed.
      */
-    void Evict();
+    bool OverLimits(size_t incoming, size_t extra_entries) const;
 };
 
 #endif // CACHE_H
\ No newline at end of file
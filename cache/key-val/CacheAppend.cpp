@@ -0,0 +1,64 @@
+#include "Cache.h"
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Atomically appends `suffix` to a value.
+ *
+ * The value grows in place while its inline payload or external chunk has room, so appending to a value only
+ * copies the new bytes in the common case. A missing or expired key is created with the value `suffix` and no
+ * expiration; an existing key keeps its TTL. As with `Set`, other entries are evicted if the longer value pushes
+ * the cache over its byte budget.
+ *
+ * @param key The key to append to.
+ * @param suffix The bytes to append.
+ * @return The length of the value after the append.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the resulting entry alone is
+ *                           larger than the byte budget.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+size_t Cache::Append(const std::string &key, const std::string &suffix)
+{
+    CheckEntry(key, suffix);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    size_t length;
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+
+        CacheItem *item = FindLive(key, hash);
+        if (item == nullptr)
+        {
+            SetLocked(key, hash, suffix, std::chrono::steady_clock::time_point::max());
+            length = suffix.size();
+        }
+        else
+        {
+            length = item->value_size + suffix.size();
+            if (max_memory_ != 0 && kEntryOverhead + key.size() + length > max_memory_)
+            {
+                throw std::length_error("OOM: value for key '" + key + "' would be larger than maxmemory");
+            }
+            if (length > CacheItem::kMaxValueSize)
+            {
+                throw std::length_error("value for key '" + key + "' would be longer than 4 GiB");
+            }
+
+            size_t old_footprint = Footprint(*item);
+            item->Append(slabs_, suffix);
+            item->SetVersion(++version_clock_);
+            policy_->OnAccess(item);
+            Reaccount(*item, old_footprint);
+        }
+    }
+
+    // Log a message indicating the new length
+    file_logger_->info("APPEND key '" + key + "': " + std::to_string(length) + " bytes");
+    std::cout << "APPEND key '" << key << "': " << length << " bytes" << std::endl;
+    return length;
+}
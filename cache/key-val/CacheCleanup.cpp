@@ -14,67 +14,66 @@
 /**
  * @brief Periodically cleans up expired items from the cache.
  *
- * This method runs in an infinite loop, periodically waking up every minute to check and remove expired cache items.
- * It helps to maintain the cache's size and ensures that stale data is not served to clients. The cleanup operation
- * involves locking the cache's mutex to ensure thread safety while modifying the internal data structures.
+ * This method runs in a loop, waking up once per timer wheel tick to remove the cache items that expired since the
+ * previous tick. It helps to maintain the cache's size and ensures that stale data is not served to clients.
  *
  * The method performs the following steps:
- * 1. Sleeps for a predefined interval (1 minute) to reduce the frequency of cleanup operations.
- * 2. Acquires a lock on the mutex to ensure that no other thread is modifying the cache while this operation is ongoing.
- * 3. Iterates over the list of cache items and checks each item's expiration time against the current time.
- * 4. Removes items that are expired from both the internal storage and the usage order list.
- * 5. Logs the start and end of the cleanup process, as well as each removal of an expired item.
+ * 1. Sleeps for one tick of `expiry_` (or until the cache is being destroyed).
+ * 2. Acquires the mutex lock exclusively and advances the timer wheel to the current time, expiring at most
+ *    `kExpireBatch` items.
+ * 3. Removes each expired item from both the eviction policy and the internal storage.
+ * 4. Releases the lock and repeats step 2 until the wheel has caught up, so that other operations can interleave
+ *    with a large expiry burst.
+ * 5. Logs the number of items removed in this cycle.
  *
  * @note This method is designed to run continuously in a separate thread, which is started during the cache's
- *       construction. It does not return any value and runs indefinitely until the application is terminated.
+ *       construction. It runs until the cache is destroyed.
  *
  * @details
- * The cleanup thread operates independently of other threads and ensures that expired items are removed without
- * blocking cache operations. It uses a `std::mutex` to synchronize access to the cache data structures, ensuring
- * that concurrent modifications by other threads do not result in data races or inconsistencies.
+ * Expired entries are found through the timer wheel rather than by scanning `items_`, so each cycle costs time
+ * proportional to the number of entries that actually expire. Entries can still expire between cycles; `Get`
+ * checks the expiration itself and never returns them.
  *
- * The logging mechanism captures detailed information about the cleanup process:
- * - **Start of Cleanup Process**: Indicates the beginning of a new cleanup cycle.
- * - **Expired Item Removal**: Logs each removal of an expired item from the cache.
- * - **End of Cleanup Process**: Indicates the completion of the cleanup cycle.
- *
- * Ensure that the cache's destructor and the thread management are handled correctly to avoid resource leaks or
- * undefined behavior. The cleanup thread will continue running even after the `Cache` object is destroyed, so it is
- * crucial to manage the thread's lifetime appropriately.
+ * The wait between cycles is interruptible: the cache's destructor sets `stopping_` and notifies `cleanup_cv_`, after
+ * which the loop returns and the thread is joined.
  */
 void Cache::Cleanup()
 {
-    while (true)
+    auto expire = [this](CacheItem *item)
     {
-        // Sleep for a defined cleanup interval (1 minute)
-        std::this_thread::sleep_for(std::chrono::minutes(1));
+        // Remove the expired item from the eviction policy and cache
+        policy_->OnRemove(item);
+        EraseItem(item);
+    };
 
-        // Lock the mutex to ensure thread-safety while modifying cache data
-        std::lock_guard<std::mutex> lock(mutex_);
+    while (true)
+    {
+        // Sleep for one timer wheel tick, or until the cache is being destroyed
+        {
+            std::unique_lock<std::mutex> wait_lock(cleanup_mutex_);
+            if (cleanup_cv_.wait_for(wait_lock, expiry_.Resolution(), [this] { return stopping_; }))
+            {
+                return;
+            }
+        }
 
-        // Get the current time to compare with expiration times
-        auto now = std::chrono::steady_clock::now();
+        size_t removed = 0;
+        size_t expired = 0;
+        do
+        {
+            // Lock the mutex to ensure thread-safety while modifying cache data
+            std::unique_lock<TimedSharedMutex> lock(mutex_);
 
-        // Log the start of the cleanup process
+            expired = expiry_.Advance(std::chrono::steady_clock::now(), kExpireBatch, expire);
+            removed += expired;
+        } while (expired == kExpireBatch);
 
-        // Iterate over the cache items
-        for (auto it = items_.begin(); it != items_.end();)
+        // Log the removal of expired items
+        if (removed > 0)
         {
-            // Check if the current item is expired
-            if (it->second.first.expiration <= now)
-            {
-                // Remove the expired item from the usage list and cache
-                usage_order_.erase(it->second.second);
-                it = items_.erase(it);
-
-                // Log the removal of an expired item
-                file_logger_->info("Expired item removed from cache");
-                std::cout << "Expired item removed from cache" << std::endl;
-            }
-            else
-            {
-                ++it; // Move to the next item if the current one is not expired
-            }
+            stats_.Add(Stat::kExpirations, removed);
+            file_logger_->info("Expired " + std::to_string(removed) + " item(s) removed from cache");
+            std::cout << "Expired " << removed << " item(s) removed from cache" << std::endl;
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,70 @@
+#include "Cache.h"
+#include <iostream>
+
+/**
+ * @brief Stores a value only if the entry still has the expected version.
+ *
+ * The version check and the store happen under one exclusive lock acquisition, so of several writers that read the
+ * same version, exactly one succeeds and the others see a conflict, without any coordination between them. A
+ * version of 0, which no entry ever has, asks to store the value only if the key does not exist.
+ *
+ * @param key The key to set.
+ * @param value The new value.
+ * @param version The expected version, or 0 to store only if the key does not exist.
+ * @param duration The new TTL in seconds, or 0 for an entry that never expires.
+ * @param new_version Receives the entry's version after a successful store.
+ * @return `CasResult::kStored` if the value was stored, `CasResult::kConflict` if the entry has another version or
+ *         exists although 0 was given, and `CasResult::kNotFound` if it does not exist.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than
+ *                           the byte budget.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+CasResult Cache::CompareAndSet(const std::string &key,
+                               const std::string &value,
+                               uint64_t version,
+                               std::chrono::seconds duration,
+                               uint64_t &new_version)
+{
+    CheckEntry(key, value);
+    auto expiration = ExpirationAfter(duration);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    CasResult result;
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+
+        CacheItem *item = FindLive(key, hash);
+        if (item == nullptr)
+        {
+            result = version == 0 ? CasResult::kStored : CasResult::kNotFound;
+        }
+        else
+        {
+            result = item->Version() == version ? CasResult::kStored : CasResult::kConflict;
+        }
+
+        if (result == CasResult::kStored)
+        {
+            // The store stamps the entry with the newest version
+            SetLocked(key, hash, value, expiration);
+            new_version = version_clock_;
+        }
+    }
+    if (result == CasResult::kStored)
+    {
+        stats_.Add(Stat::kSets);
+    }
+
+    // Log a message indicating the outcome
+    const char *outcome = result == CasResult::kStored     ? "stored"
+                          : result == CasResult::kConflict ? "version mismatch"
+                                                           : "not found";
+    file_logger_->info("CAS key '" + key + "': " + outcome);
+    std::cout << "CAS key '" << key << "': " << outcome << std::endl;
+    return result;
+}
@@ -6,7 +6,7 @@
  * @brief Removes a key-value pair from the cache if the key exists.
  *
  * This method attempts to find a specified key in the cache. If the key is found, it deletes the key-value pair
- * from both the internal data structure and the usage order list, effectively removing the key from the cache.
+ * from both the internal data structure and the eviction policy, effectively removing the key from the cache.
  * If the key does not exist, no changes are made.
  *
  * @param key The key to be removed from the cache.
@@ -15,21 +15,17 @@
  */
 void Cache::Delete(const std::string &key)
 {
-    // Lock the mutex to ensure thread-safety
-    std::lock_guard<std::mutex> lock(mutex_);
+    size_t hash = SwissIndex::Hash(key);
 
-    // Attempt to find the key in the cache
-    auto it = items_.find(key);
-
-    // Check if the key exists in the cache
-    if (it != items_.end())
+    bool deleted;
     {
-        // Remove the key from the usage order list
-        usage_order_.erase(it->second.second);
-
-        // Remove the key-value pair from the cache
-        items_.erase(it);
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        deleted = DeleteLocked(key, hash);
+    }
 
+    if (deleted)
+    {
         // Log a message indicating successful deletion
         file_logger_->info("DELETE key '" + key + "': succeeded");
         std::cout << "DELETE key '" << key << "': succeeded" << std::endl;
@@ -40,4 +36,27 @@ void Cache::Delete(const std::string &key)
         file_logger_->info("DELETE key '" + key + "': failed");
         std::cout << "DELETE key: '" << key << "': failed" << std::endl;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Removes a key if it exists. The caller holds the exclusive lock.
+ *
+ * @param key The key to remove.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @return `true` if the key existed.
+ */
+bool Cache::DeleteLocked(const std::string &key, size_t hash)
+{
+    // Attempt to find the key in the cache
+    CacheItem *item = items_.Find(key, hash);
+    if (item == nullptr)
+    {
+        // The key may only be on the disk tier
+        return spill_ && spill_->Erase(key, hash);
+    }
+
+    // Remove the entry from the eviction policy, then the key-value pair from the cache
+    policy_->OnRemove(item);
+    EraseItem(item);
+    return true;
+}
@@ -0,0 +1,69 @@
+#include "Cache.h"
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Deletes every key starting with a prefix.
+ *
+ * The keys are found through the ordered index, so the cost is O(log n) per batch plus O(1) per deleted key
+ * regardless of the size of the cache. They are deleted in batches of at most `kDeletePrefixBatch`, each under its
+ * own exclusive lock acquisition, so clearing a large tenant never blocks other operations for long. Keys added
+ * under the prefix while the deletion runs may or may not be deleted. Keys on the disk tier are deleted too, in one
+ * pass over all spilled keys under a single exclusive lock acquisition.
+ *
+ * @param prefix The prefix. An empty prefix deletes every key.
+ * @return The number of unexpired keys deleted; expired keys under the prefix are removed as well.
+ * @throws std::logic_error If the ordered index is disabled.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+size_t Cache::DeletePrefix(const std::string &prefix)
+{
+    if (!ordered_)
+    {
+        throw std::logic_error("the ordered index is disabled");
+    }
+
+    std::vector<CacheItem *> batch;
+    size_t deleted = 0;
+    auto now = std::chrono::steady_clock::now();
+
+    do
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+
+        // Collect the batch before erasing, since erasing invalidates the iterator
+        batch.clear();
+        for (auto it = ordered_->LowerBound(prefix); it.Valid() && batch.size() < kDeletePrefixBatch; ++it)
+        {
+            if ((*it)->Key().substr(0, prefix.size()) != prefix)
+            {
+                break;
+            }
+            batch.push_back(*it);
+        }
+
+        for (CacheItem *item : batch)
+        {
+            if (item->expiration > now)
+            {
+                ++deleted;
+            }
+            policy_->OnRemove(item);
+            EraseItem(item);
+        }
+    } while (batch.size() == kDeletePrefixBatch);
+
+    if (spill_)
+    {
+        // The disk tier is not ordered, so this visits every spilled key in one go
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        deleted += spill_->ErasePrefix(prefix, now);
+    }
+
+    // Log a message with the number of keys deleted
+    file_logger_->info("DELPREFIX '" + prefix + "': " + std::to_string(deleted) + " keys deleted");
+    std::cout << "DELPREFIX '" << prefix << "': " << deleted << " keys deleted" << std::endl;
+    return deleted;
+}
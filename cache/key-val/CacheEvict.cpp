@@ -4,31 +4,48 @@
 #include "Cache.h"
 
 /**
- * @brief Evicts the least recently used (LRU) item from the cache.
+ * @brief Evicts one item from the cache, as chosen by the eviction policy.
  *
- * This method identifies the least recently used item based on the usage order list and removes it from both
- * the cache and the usage order list. This ensures that the cache size stays within the defined limit, allowing
- * new items to be added without exceeding memory constraints.
+ * This method asks `policy_` for a victim, which the policy stops tracking, and removes it from the cache, after
+ * writing its value to the disk tier if one is configured. This
+ * ensures that the cache stays within its entry and byte limits, allowing new items to be added without exceeding
+ * memory constraints.
  *
- * @note This method is called when the cache reaches its maximum capacity. It is crucial for implementing
- *       the LRU eviction policy.
+ * @param keep An entry that must survive, such as the one being updated. If the policy picks it, it is handed back
+ *             to the policy and nothing is evicted.
+ * @return `true` if an entry was evicted, `false` if there was nothing left to evict.
+ *
+ * @note This method is called when the cache reaches one of its limits. It assumes that the caller already holds
+ *       the mutex lock exclusively.
  */
-void Cache::Evict()
+bool Cache::Evict(CacheItem *keep)
 {
-    // Check if there are any items to evict
-    if (!usage_order_.empty())
+    // Ask the policy for a victim; it is already detached from the policy's queues
+    CacheItem *victim = policy_->Evict();
+
+    // Check if there was anything to evict
+    if (victim == nullptr)
     {
-        // Identify the least recently used key (last in the usage list)
-        auto lru_key = usage_order_.back();
+        return false;
+    }
 
-        // Remove the LRU key from the usage list
-        usage_order_.pop_back();
+    // Never evict the entry the caller is working on; it is the only entry left that could go
+    if (victim == keep)
+    {
+        policy_->OnInsert(keep);
+        return false;
+    }
 
-        // Remove the LRU key from the cache
-        items_.erase(lru_key);
+    std::string victim_key(victim->Key());
 
-        // Log the eviction of the least recently used item
-        file_logger_->info("Evicted least recently used item: '" + lru_key + "'");
-        std::cout << "Evicted least recently used item: '" << lru_key << "'" << std::endl;
-    }
-}
\ No newline at end of file
+    // Keep the victim's value on the disk tier, if enabled, then remove the victim from the cache
+    bool spilled = spill_ && Spill(victim_key, *victim);
+    EraseItem(victim);
+    stats_.Add(Stat::kEvictions);
+
+    // Log the eviction
+    const char *destination = spilled ? " to disk" : "";
+    file_logger_->info("Evicted item (" + policy_->Name() + "): '" + victim_key + "'" + destination);
+    std::cout << "Evicted item (" << policy_->Name() << "): '" << victim_key << "'" << destination << std::endl;
+    return true;
+}
@@ -1,11 +1,19 @@
 #include "Cache.h"
 #include <iostream>
+#include <shared_mutex>
 
 /**
  * @brief Retrieves the value associated with a given key from the cache, if it exists and is not expired.
  *
  * This method looks up a key in the cache and, if found and not expired, returns the associated value.
- * It also updates the usage order to mark the key as recently used. If the key is expired, it removes the key from the cache.
+ * It also reports the access to the eviction policy. If the key is expired, it removes the key from the cache.
+ *
+ * If the eviction policy allows it (`IEvictionPolicy::SharedAccess`), the lookup runs under a shared lock: a hit only
+ * updates the entry's access counter with relaxed stores, and expired entries are left for writers and the cleanup
+ * thread to reclaim.
+ *
+ * A value of at least `CacheItem::kMinSharedValue` bytes is not copied under the lock: the lookup takes a reference
+ * to its shared buffer and copies it after releasing the lock, so large reads do not hold up writers.
  *
  * @param key The key to search for in the cache.
  * @param value A reference to a string where the value associated with the key will be stored if found.
@@ -15,36 +23,203 @@
  */
 bool Cache::Get(const std::string &key, std::string &value)
 {
-    // Lock the mutex to ensure thread-safety
-    std::lock_guard<std::mutex> lock(mutex_);
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+    auto now = std::chrono::steady_clock::now();
 
-    // Attempt to find the key in the cache
-    auto it = items_.find(key);
+    CacheItem *item = nullptr;
+    CacheValue deferred;
+    bool exclusive = !policy_->SharedAccess();
+    if (!exclusive)
+    {
+        // A hit does not reorder anything under this policy, so readers can share the lock
+        std::shared_lock<TimedSharedMutex> lock(mutex_);
+        item = GetLocked(key, hash, now, false);
+        if (item != nullptr)
+        {
+            ReadValue(*item, value, deferred);
+        }
+
+        // Promoting a key back from the disk tier needs the exclusive lock
+        exclusive = item == nullptr && MaybeSpilled(hash);
+    }
+
+    if (exclusive)
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        item = GetLocked(key, hash, now, true);
+        if (item != nullptr)
+        {
+            ReadValue(*item, value, deferred);
+        }
+    }
+
+    if (item == nullptr)
+    {
+        stats_.Add(Stat::kKeyspaceMisses);
+        return false;
+    }
+    stats_.Add(Stat::kKeyspaceHits);
+
+    // A large value is copied only now that the lock is released
+    if (deferred.Shared())
+    {
+        value.assign(deferred.View());
+    }
+
+    // Log a message indicating the key has been found
+    file_logger_->info("GET key '" + key + "': found");
+    std::cout << "GET key '" << key << "': found" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Retrieves an immutable handle to the value associated with a given key.
+ *
+ * Behaves like the copying `Get`, but a value of at least `CacheItem::kMinSharedValue` bytes is never copied: the
+ * critical section only takes a reference to its shared buffer, and the handle keeps the bytes alive after the key
+ * is overwritten, deleted or evicted. Smaller values are copied into the handle under the lock.
+ *
+ * @param key The key to search for in the cache.
+ * @param value Receives a handle to the value if found.
+ * @return true If the key is found and the value is not expired, false otherwise.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+bool Cache::Get(const std::string &key, CacheValue &value)
+{
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+    auto now = std::chrono::steady_clock::now();
+
+    CacheItem *item = nullptr;
+    bool exclusive = !policy_->SharedAccess();
+    if (!exclusive)
+    {
+        // A hit does not reorder anything under this policy, so readers can share the lock
+        std::shared_lock<TimedSharedMutex> lock(mutex_);
+        item = GetLocked(key, hash, now, false);
+        if (item != nullptr)
+        {
+            value = item->Handle();
+        }
+
+        // Promoting a key back from the disk tier needs the exclusive lock
+        exclusive = item == nullptr && MaybeSpilled(hash);
+    }
 
-    // If the key is found in the cache
-    if (it != items_.end())
+    if (exclusive)
     {
-        // Check if the key has not expired
-        if (it->second.first.expiration > std::chrono::steady_clock::now())
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        item = GetLocked(key, hash, now, true);
+        if (item != nullptr)
         {
-            // Retrieve the value associated with the key
-            value = it->second.first.value;
+            value = item->Handle();
+        }
+    }
+
+    if (item == nullptr)
+    {
+        stats_.Add(Stat::kKeyspaceMisses);
+        return false;
+    }
+    stats_.Add(Stat::kKeyspaceHits);
+
+    // Log a message indicating the key has been found
+    file_logger_->info("GET key '" + key + "': found");
+    std::cout << "GET key '" << key << "': found" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Looks up a key. The caller holds the lock, exclusively if `exclusive` is set.
+ *
+ * Under a shared lock, expired entries are left in place, keys on the disk tier are not promoted and misses are
+ * not reported to the eviction policy.
+ *
+ * @param key The key to search for.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @param now The time against which the entry's expiration is checked.
+ * @param exclusive Whether the caller holds the lock exclusively.
+ * @return The entry if the key is found and not expired, otherwise `nullptr`. The hit has been reported to the
+ *         eviction policy.
+ */
+CacheItem *Cache::GetLocked(const std::string &key,
+                            size_t hash,
+                            std::chrono::steady_clock::time_point now,
+                            bool exclusive)
+{
+    // Attempt to find the key in the cache
+    CacheItem *item = items_.Find(key, hash);
 
-            // Update the usage order by moving the key to the front
-            MoveToFront(key);
+    // If the key is found and has not expired, report the hit to the eviction policy
+    if (item != nullptr && item->expiration > now)
+    {
+        policy_->OnAccess(item);
+        return item;
+    }
 
-            // Log a message indicating the key has been found
-            file_logger_->info("GET key '" + key + "': found");
-            std::cout << "GET key '" << key << "': found" << std::endl;
-            return true;
+    if (exclusive)
+    {
+        if (item != nullptr)
+        {
+            // If the key has expired, remove it from the eviction policy and the cache
+            policy_->OnRemove(item);
+            EraseItem(item);
+            stats_.Add(Stat::kExpirations);
         }
-        else
+        else if ((item = Promote(key, hash, now)) != nullptr)
         {
-            // If the key has expired, remove it from the cache
-            items_.erase(it);
+            // The key was on the disk tier and is back in memory
+            return item;
         }
+
+        // Let frequency-based policies count lookups of absent keys
+        policy_->OnMiss(key);
     }
 
-    // Return false if the key is not found or is expired
-    return false;
-}
\ No newline at end of file
+    // Return nullptr if the key is not found or is expired
+    return nullptr;
+}
+
+/**
+ * @brief Reads an entry's value while the caller holds the lock.
+ *
+ * @param item The entry.
+ * @param value Receives a copy of the value unless it is shared.
+ * @param deferred Receives a handle to the value if it is shared; the caller copies it after releasing the lock.
+ */
+void Cache::ReadValue(const CacheItem &item, std::string &value, CacheValue &deferred)
+{
+    if (item.encoding == CacheItem::kShared)
+    {
+        deferred = item.Handle();
+    }
+    else
+    {
+        item.CopyValue(value);
+    }
+}
+
+/**
+ * @brief Finds a key that has not expired, erasing it if it has, and promoting it if it is on the disk tier. The
+ *        caller holds the exclusive lock.
+ *
+ * @param key The key to search for.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @return The live entry, or `nullptr`.
+ */
+CacheItem *Cache::FindLive(const std::string &key, size_t hash)
+{
+    CacheItem *item = items_.Find(key, hash);
+    if (item != nullptr && item->expiration <= std::chrono::steady_clock::now())
+    {
+        policy_->OnRemove(item);
+        EraseItem(item);
+        stats_.Add(Stat::kExpirations);
+        return nullptr;
+    }
+    return item != nullptr ? item : Promote(key, hash, std::chrono::steady_clock::now());
+}
@@ -0,0 +1,46 @@
+#include "Cache.h"
+#include <iostream>
+
+/**
+ * @brief Atomically replaces a value and returns the previous one.
+ *
+ * The previous value is copied out and the new one stored under one exclusive lock acquisition, so no other
+ * writer can slip in between. Like `Set` with a duration of 0, the key no longer expires afterwards.
+ *
+ * @param key The key to set.
+ * @param value The new value.
+ * @param old_value Receives the previous value if the key existed.
+ * @return `true` if the key existed and had not expired.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than
+ *                           the byte budget.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+bool Cache::GetSet(const std::string &key, const std::string &value, std::string &old_value)
+{
+    CheckEntry(key, value);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    bool existed;
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+
+        CacheItem *item = FindLive(key, hash);
+        existed = item != nullptr;
+        if (existed)
+        {
+            item->CopyValue(old_value);
+        }
+        SetLocked(key, hash, value, std::chrono::steady_clock::time_point::max());
+    }
+    stats_.Add(Stat::kSets);
+
+    // Log a message indicating the key has been set
+    file_logger_->info("GETSET key '" + key + "': " + (existed ? "replaced" : "created"));
+    std::cout << "GETSET key '" << key << "': " << (existed ? "replaced" : "created") << std::endl;
+    return existed;
+}
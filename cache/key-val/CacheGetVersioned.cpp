@@ -0,0 +1,64 @@
+#include "Cache.h"
+#include <iostream>
+#include <shared_mutex>
+
+/**
+ * @brief Retrieves a handle to a value together with the entry's version.
+ *
+ * Behaves like the handle-returning `Get`: the version and the handle are taken in the same critical section, so
+ * the version always describes the returned value, and a large value is never copied.
+ *
+ * @param key The key to search for in the cache.
+ * @param value Receives a handle to the value if found.
+ * @param version Receives the entry's version if found.
+ * @return true If the key is found and the value is not expired, false otherwise.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+bool Cache::GetVersioned(const std::string &key, CacheValue &value, uint64_t &version)
+{
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+    auto now = std::chrono::steady_clock::now();
+
+    CacheItem *item = nullptr;
+    bool exclusive = !policy_->SharedAccess();
+    if (!exclusive)
+    {
+        // A hit does not reorder anything under this policy, so readers can share the lock
+        std::shared_lock<TimedSharedMutex> lock(mutex_);
+        item = GetLocked(key, hash, now, false);
+        if (item != nullptr)
+        {
+            value = item->Handle();
+            version = item->Version();
+        }
+
+        // Promoting a key back from the disk tier needs the exclusive lock
+        exclusive = item == nullptr && MaybeSpilled(hash);
+    }
+
+    if (exclusive)
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        item = GetLocked(key, hash, now, true);
+        if (item != nullptr)
+        {
+            value = item->Handle();
+            version = item->Version();
+        }
+    }
+
+    if (item == nullptr)
+    {
+        stats_.Add(Stat::kKeyspaceMisses);
+        return false;
+    }
+    stats_.Add(Stat::kKeyspaceHits);
+
+    // Log a message indicating the key has been found
+    file_logger_->info("GETV key '" + key + "': found");
+    std::cout << "GETV key '" << key << "': found" << std::endl;
+    return true;
+}
@@ -0,0 +1,47 @@
+#include "Cache.h"
+#include <iostream>
+
+/**
+ * @brief Reports the most frequently accessed keys, as estimated from a sample of the reads and writes.
+ *
+ * GET, SET, MGET and MSET record their keys in the tracker before taking the cache lock, so neither recording nor
+ * this report ever waits for the cache lock.
+ *
+ * @param count The most keys to return.
+ * @return The hottest keys by decreasing estimated access count; empty while tracking is disabled.
+ */
+std::vector<HotKey> Cache::HotKeys(size_t count)
+{
+    return hot_keys_.Top(count);
+}
+
+/**
+ * @brief Enables, disables or changes the sampling of accesses for hot-key tracking, and forgets past counts.
+ *
+ * @param sample_rate Count one access in `sample_rate`; 1 counts every access and 0 disables tracking.
+ */
+void Cache::ConfigureHotKeys(uint32_t sample_rate)
+{
+    hot_keys_.SetSampleRate(sample_rate);
+
+    file_logger_->info("HOTKEYS: sample rate set to " + std::to_string(sample_rate));
+    std::cout << "HOTKEYS: sample rate set to " << sample_rate << std::endl;
+}
+
+/**
+ * @brief Reports the hot-key sample rate.
+ *
+ * @return One access in this many is counted, or 0 if tracking is disabled.
+ */
+uint32_t Cache::HotKeysSampleRate()
+{
+    return hot_keys_.SampleRate();
+}
+
+/**
+ * @brief Forgets the access counts gathered for hot-key tracking.
+ */
+void Cache::ResetHotKeys()
+{
+    hot_keys_.Reset();
+}
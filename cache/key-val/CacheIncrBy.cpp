@@ -0,0 +1,66 @@
+#include "Cache.h"
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Atomically adds `delta` to an integer value.
+ *
+ * The read, the addition and the write happen under one exclusive lock acquisition, so concurrent increments are
+ * never lost. Canonical decimal integers are stored as 8-byte integers in the entry record, so an increment reads
+ * and writes the integer in place without parsing, formatting or allocating. A missing or expired key is created
+ * with the value `delta` and no expiration; an existing key keeps its TTL.
+ *
+ * @param key The key of the counter.
+ * @param delta The amount to add, which may be negative.
+ * @return The new value.
+ * @throws std::invalid_argument If the value is not an integer.
+ * @throws std::out_of_range If the result would overflow a 64-bit integer.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize`.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+int64_t Cache::IncrBy(const std::string &key, int64_t delta)
+{
+    CheckEntry(key, std::string());
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    int64_t result;
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+
+        CacheItem *item = FindLive(key, hash);
+        if (item == nullptr)
+        {
+            // A missing counter starts from 0
+            result = delta;
+            SetLocked(key, hash, std::to_string(result), std::chrono::steady_clock::time_point::max());
+        }
+        else
+        {
+            int64_t current;
+            if (!item->ToInt(current))
+            {
+                throw std::invalid_argument("value of key '" + key + "' is not an integer");
+            }
+            if (__builtin_add_overflow(current, delta, &result))
+            {
+                throw std::out_of_range("increment of key '" + key + "' would overflow");
+            }
+
+            size_t old_footprint = Footprint(*item);
+            item->SetInt(slabs_, result);
+            item->SetVersion(++version_clock_);
+            policy_->OnAccess(item);
+            Reaccount(*item, old_footprint);
+        }
+    }
+
+    // Log a message indicating the new value
+    file_logger_->info("INCRBY key '" + key + "': " + std::to_string(result));
+    std::cout << "INCRBY key '" << key << "': " << result << std::endl;
+    return result;
+}
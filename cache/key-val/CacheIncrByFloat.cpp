@@ -0,0 +1,87 @@
+#include "Cache.h"
+#include <charconv>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Atomically adds `delta` to a floating-point value.
+ *
+ * The read, the addition and the write happen under one exclusive lock acquisition. An integer-encoded value is
+ * read without parsing. The result is stored in the shortest fixed-point form that reads back to the same double,
+ * so "10.5" plus 0.1 gives "10.6", and a whole result is stored as an integer that `IncrBy` can keep counting. A
+ * missing or expired key is created with the value `delta` and no expiration; an existing key keeps its TTL.
+ *
+ * @param key The key of the counter.
+ * @param delta The amount to add, which may be negative.
+ * @return The new value, as stored.
+ * @throws std::invalid_argument If the value is not a number or the result is not finite.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize`.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+std::string Cache::IncrByFloat(const std::string &key, double delta)
+{
+    CheckEntry(key, std::string());
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    // Large enough for any finite double in fixed-point notation
+    char digits[512];
+    std::string result;
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+
+        CacheItem *item = FindLive(key, hash);
+
+        double current = 0.0;
+        if (item != nullptr)
+        {
+            int64_t number;
+            if (item->ToInt(number))
+            {
+                current = static_cast<double>(number);
+            }
+            else
+            {
+                std::string value;
+                item->CopyValue(value);
+                auto parsed = std::from_chars(value.data(), value.data() + value.size(), current);
+                if (value.empty() || parsed.ec != std::errc() || parsed.ptr != value.data() + value.size() ||
+                    !std::isfinite(current))
+                {
+                    throw std::invalid_argument("value of key '" + key + "' is not a valid float");
+                }
+            }
+        }
+
+        double sum = current + delta;
+        if (!std::isfinite(sum))
+        {
+            throw std::invalid_argument("increment of key '" + key + "' would produce NaN or Infinity");
+        }
+        auto formatted = std::to_chars(digits, digits + sizeof(digits), sum, std::chars_format::fixed);
+        result.assign(digits, formatted.ptr);
+
+        if (item == nullptr)
+        {
+            SetLocked(key, hash, result, std::chrono::steady_clock::time_point::max());
+        }
+        else
+        {
+            size_t old_footprint = Footprint(*item);
+            item->SetValue(slabs_, result);
+            item->SetVersion(++version_clock_);
+            policy_->OnAccess(item);
+            Reaccount(*item, old_footprint);
+        }
+    }
+
+    // Log a message indicating the new value
+    file_logger_->info("INCRBYFLOAT key '" + key + "': " + result);
+    std::cout << "INCRBYFLOAT key '" << key << "': " << result << std::endl;
+    return result;
+}
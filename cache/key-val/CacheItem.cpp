@@ -0,0 +1,296 @@
+#include <charconv>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include "CacheItem.h"
+
+static_assert(sizeof(CacheItem) == 64, "CacheItem header should stay one cache line");
+static_assert(CacheItem::kRecordHeader == sizeof(CacheItem) + sizeof(uint64_t), "the version follows the header");
+
+/**
+ * @brief Parses a value that can be stored as an integer without changing its string form.
+ *
+ * Only the canonical decimal form is accepted, so that formatting the integer reproduces the value exactly:
+ * "42" and "-7" qualify, while "042", "+1", "-0" and " 1" do not.
+ */
+bool CacheItem::ParseInt(std::string_view value, int64_t &number)
+{
+    if (value.empty() || value.size() > 20)
+    {
+        return false;
+    }
+
+    size_t digits = value[0] == '-' ? 1 : 0;
+    if (digits == value.size() || value[digits] < '0' || value[digits] > '9')
+    {
+        return false;
+    }
+    if (value[digits] == '0' && value.size() != 1)
+    {
+        return false;
+    }
+
+    auto result = std::from_chars(value.data(), value.data() + value.size(), number);
+    return result.ec == std::errc() && result.ptr == value.data() + value.size();
+}
+
+/**
+ * @brief The payload a value needs inside the record: 8 bytes for an integer or a pointer to an external chunk,
+ *        otherwise the value itself.
+ */
+size_t CacheItem::PayloadSize(std::string_view value)
+{
+    int64_t number;
+    if (value.size() > kMaxInlineValue || ParseInt(value, number))
+    {
+        return sizeof(int64_t);
+    }
+    return value.size();
+}
+
+/**
+ * @brief Allocates a record sized for the key and the value's payload.
+ *
+ * The payload area is at least 8 bytes, so any later value can be stored in the record as an integer or as a
+ * pointer to an external chunk.
+ */
+CacheItem *CacheItem::Create(SlabAllocator &slabs,
+                             std::string_view key,
+                             std::string_view value,
+                             const CacheValue *shared)
+{
+    size_t payload = PayloadSize(value);
+    size_t record_size = kRecordHeader + key.size() + (payload < sizeof(void *) ? sizeof(void *) : payload);
+    size_t size_class = SlabAllocator::ClassOf(record_size);
+
+    CacheItem *item = new (slabs.Allocate(record_size)) CacheItem();
+    item->size_class = static_cast<uint8_t>(size_class);
+    item->key_size = static_cast<uint16_t>(key.size());
+    item->SetVersion(0);
+    std::memcpy(reinterpret_cast<char *>(item) + kRecordHeader, key.data(), key.size());
+    item->StorePayload(slabs, value, shared);
+    return item;
+}
+
+void CacheItem::Destroy(SlabAllocator &slabs, CacheItem *item)
+{
+    item->ReleasePayload(slabs);
+
+    size_t record_size = SlabAllocator::ClassSize(item->size_class);
+    item->~CacheItem();
+    slabs.Deallocate(item, record_size);
+}
+
+char *CacheItem::ExternalValue() const
+{
+    char *chunk;
+    std::memcpy(&chunk, Payload(), sizeof(chunk));
+    return chunk;
+}
+
+CacheValue::Buffer *CacheItem::SharedValue() const
+{
+    CacheValue::Buffer *buffer;
+    std::memcpy(&buffer, Payload(), sizeof(buffer));
+    return buffer;
+}
+
+void CacheItem::ReleasePayload(SlabAllocator &slabs)
+{
+    if (encoding == kExternal)
+    {
+        slabs.Deallocate(ExternalValue(), value_size);
+    }
+    else if (encoding == kShared)
+    {
+        CacheValue::Release(SharedValue());
+    }
+}
+
+/**
+ * @brief Stores the value as an integer if it is one, inline if it is short and fits in the record's chunk, in a
+ *        shared buffer if it is large, and in a separate chunk otherwise.
+ *
+ * A large value that comes with a shared handle adopts the handle's buffer, so it is not copied at all.
+ */
+void CacheItem::StorePayload(SlabAllocator &slabs, std::string_view value, const CacheValue *shared)
+{
+    value_size = static_cast<uint32_t>(value.size());
+
+    if (value.size() >= kMinSharedValue)
+    {
+        CacheValue::Buffer *buffer;
+        if (shared != nullptr && shared->buffer_ != nullptr)
+        {
+            buffer = shared->buffer_;
+            CacheValue::Retain(buffer);
+        }
+        else
+        {
+            buffer = new CacheValue::Buffer();
+            buffer->data.assign(value.data(), value.size());
+        }
+        std::memcpy(Payload(), &buffer, sizeof(buffer));
+        encoding = kShared;
+        return;
+    }
+
+    int64_t number;
+    if (ParseInt(value, number))
+    {
+        encoding = kInt;
+        std::memcpy(Payload(), &number, sizeof(number));
+        return;
+    }
+
+    size_t room = SlabAllocator::ClassSize(size_class) - kRecordHeader - key_size;
+    if (value.size() <= kMaxInlineValue && value.size() <= room)
+    {
+        encoding = kRaw;
+        std::memcpy(Payload(), value.data(), value.size());
+        return;
+    }
+
+    char *chunk = static_cast<char *>(slabs.Allocate(value.size()));
+    std::memcpy(chunk, value.data(), value.size());
+    std::memcpy(Payload(), &chunk, sizeof(chunk));
+    encoding = kExternal;
+}
+
+void CacheItem::SetValue(SlabAllocator &slabs, std::string_view value, const CacheValue *shared)
+{
+    ReleasePayload(slabs);
+    StorePayload(slabs, value, shared);
+}
+
+/**
+ * @brief Integer-encoded values are read directly; a short inline value may still be a canonical integer if it was
+ *        built by `Append`, so it is parsed.
+ */
+bool CacheItem::ToInt(int64_t &number) const
+{
+    switch (encoding)
+    {
+    case kInt:
+        std::memcpy(&number, Payload(), sizeof(number));
+        return true;
+    case kRaw:
+        return ParseInt(std::string_view(Payload(), value_size), number);
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Every record has at least 8 payload bytes, so an integer always fits in place.
+ */
+void CacheItem::SetInt(SlabAllocator &slabs, int64_t number)
+{
+    ReleasePayload(slabs);
+
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    value_size = static_cast<uint32_t>(result.ptr - digits);
+    encoding = kInt;
+    std::memcpy(Payload(), &number, sizeof(number));
+}
+
+/**
+ * @brief An inline value grows in place while the record's chunk has room, and an external value while its chunk
+ *        does; since chunk sizes grow geometrically, repeated appends to a large value copy it only occasionally.
+ *        A shared value grows in place when no reader holds a handle to it. Otherwise the value is rebuilt and
+ *        stored like `SetValue` would.
+ */
+void CacheItem::Append(SlabAllocator &slabs, std::string_view suffix)
+{
+    size_t total = value_size + suffix.size();
+    if (total > kMaxValueSize)
+    {
+        throw std::length_error("value would be longer than " + std::to_string(kMaxValueSize) + " bytes");
+    }
+
+    if (encoding == kRaw)
+    {
+        size_t room = SlabAllocator::ClassSize(size_class) - kRecordHeader - key_size;
+        if (total <= kMaxInlineValue && total <= room)
+        {
+            std::memcpy(Payload() + value_size, suffix.data(), suffix.size());
+            value_size = static_cast<uint32_t>(total);
+            return;
+        }
+    }
+    else if (encoding == kExternal && SlabAllocator::ChunkSize(total) == SlabAllocator::ChunkSize(value_size))
+    {
+        std::memcpy(ExternalValue() + value_size, suffix.data(), suffix.size());
+        value_size = static_cast<uint32_t>(total);
+        return;
+    }
+    else if (encoding == kShared && SharedValue()->refs.load(std::memory_order_acquire) == 1)
+    {
+        // New handles are only taken under the cache lock, which the caller holds exclusively
+        SharedValue()->data.append(suffix.data(), suffix.size());
+        value_size = static_cast<uint32_t>(total);
+        return;
+    }
+
+    std::string value;
+    value.reserve(total);
+    CopyValue(value);
+    value.append(suffix);
+    SetValue(slabs, value);
+}
+
+void CacheItem::CopyValue(std::string &out) const
+{
+    switch (encoding)
+    {
+    case kInt:
+    {
+        int64_t number;
+        std::memcpy(&number, Payload(), sizeof(number));
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), number);
+        out.assign(digits, result.ptr);
+        break;
+    }
+    case kExternal:
+        out.assign(ExternalValue(), value_size);
+        break;
+    case kShared:
+        out.assign(SharedValue()->data);
+        break;
+    default:
+        out.assign(Payload(), value_size);
+        break;
+    }
+}
+
+/**
+ * @brief Small values are copied, which is cheaper than allocating a buffer to share.
+ */
+CacheValue CacheItem::Handle() const
+{
+    if (encoding == kShared)
+    {
+        return CacheValue::Share(SharedValue());
+    }
+
+    CacheValue handle;
+    CopyValue(handle.local_);
+    return handle;
+}
+
+size_t CacheItem::AllocatedBytes() const
+{
+    size_t bytes = SlabAllocator::ClassSize(size_class);
+    if (encoding == kExternal)
+    {
+        bytes += SlabAllocator::ChunkSize(value_size);
+    }
+    else if (encoding == kShared)
+    {
+        bytes += CacheValue::BufferBytes(SharedValue());
+    }
+    return bytes;
+}
@@ -0,0 +1,215 @@
+#ifndef CACHE_ITEM_H
+#define CACHE_ITEM_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "SlabAllocator.h"
+#include "CacheValue.h"
+
+/**
+ * @struct CacheItem
+ * @brief A key-value cache entry together with the bookkeeping used by eviction policies.
+ *
+ * An entry is one contiguous record allocated from the cache's slab allocator: this 64-byte header, followed by the
+ * entry's 8-byte version, the key bytes and the value payload. The version is only read by versioned commands, so it is
+ * kept out of the header's cache line, next to the key that every lookup reads anyway. Short values are stored inline
+ * in the payload; values that are canonical decimal integers are stored as an 8-byte `int64_t`; longer values live in a
+ * separate slab chunk that the payload points to, and values of at least `kMinSharedValue` bytes in a reference-counted
+ * `CacheValue` buffer that readers can share without copying. A lookup therefore usually touches a single allocation,
+ * and a small entry costs little more than its key and value.
+ *
+ * Entries are linked into the eviction policy's queues intrusively, so moving an entry between positions or
+ * queues only relinks pointers and never allocates. Entries are indexed by pointer and never move. Entries with a
+ * TTL are also linked into the cache's `TimerWheel` through a second pair of links. `queue`, `freq` and `epoch`
+ * are scratch space owned by whichever `IEvictionPolicy` is in use.
+ */
+struct CacheItem
+{
+    static constexpr uint16_t kUnscheduled = UINT16_MAX; ///< `timer_slot` of an entry that is not in the wheel.
+    static constexpr size_t kMaxKeySize = UINT16_MAX;    ///< The longest key a record can hold.
+    static constexpr size_t kMaxValueSize = UINT32_MAX;  ///< The longest value a record can hold.
+    static constexpr size_t kMaxInlineValue = 128;       ///< The longest value stored inline in the record.
+    static constexpr size_t kMinSharedValue = 4096;      ///< The shortest value stored in a shared buffer.
+    static constexpr size_t kRecordHeader = 64 + sizeof(uint64_t); ///< The header and version bytes before the key.
+
+    /**
+     * @brief How the value payload is stored.
+     */
+    enum Encoding : uint8_t
+    {
+        kRaw = 0,      ///< `value_size` bytes inline after the key.
+        kInt = 1,      ///< An `int64_t` inline after the key; `value_size` is the length of its decimal form.
+        kExternal = 2, ///< A pointer after the key to a slab chunk of `value_size` bytes.
+        kShared = 3,   ///< A pointer after the key to a `CacheValue` buffer holding one of its references.
+    };
+
+    CacheItem *prev = nullptr; ///< The neighbour closer to the head of the policy queue holding this entry.
+    CacheItem *next = nullptr; ///< The neighbour closer to the tail of the policy queue holding this entry.
+
+    CacheItem *timer_prev = nullptr; ///< The previous entry in the same timer wheel slot.
+    CacheItem *timer_next = nullptr; ///< The next entry in the same timer wheel slot.
+
+    size_t hash = 0;                                  ///< `SwissIndex::Hash` of the key, also used by sketches and ghost lists.
+    std::chrono::steady_clock::time_point expiration; ///< The expiration time point for the cache entry.
+
+    uint32_t value_size = 0;            ///< The length of the value as a string.
+    uint16_t key_size = 0;              ///< The length of the key.
+    uint16_t timer_slot = kUnscheduled; ///< The timer wheel slot (level * slots + index) holding this entry.
+    uint16_t epoch = 0;                 ///< The policy's aging epoch at which `freq` was last written, modulo 2^16.
+    std::atomic<uint8_t> hits{0};       ///< Saturating access counter, updated with relaxed stores by shared-lock hits.
+    uint8_t queue = 0;                  ///< The policy queue (segment) this entry is currently linked into.
+    uint8_t freq = 0;                   ///< Frequency counter for LFU-style policies.
+    uint8_t encoding = kRaw;            ///< The `Encoding` of the value payload.
+    uint8_t size_class = 0;             ///< The slab size class of this record.
+
+    /**
+     * @brief Allocates a record holding `key` and `value`.
+     *
+     * @param slabs The allocator to take the record, and the value chunk if any, from.
+     * @param key The key. At most `kMaxKeySize` bytes.
+     * @param value The value.
+     * @param shared A handle holding `value`, whose buffer is shared instead of copied if the value is large.
+     * @return The new entry, with every other field at its default.
+     */
+    static CacheItem *Create(SlabAllocator &slabs,
+                             std::string_view key,
+                             std::string_view value,
+                             const CacheValue *shared = nullptr);
+
+    /**
+     * @brief Frees a record created by `Create` together with its value chunk.
+     *
+     * @param slabs The allocator the record came from.
+     * @param item The entry to free.
+     */
+    static void Destroy(SlabAllocator &slabs, CacheItem *item);
+
+    /**
+     * @brief Parses a value that can be stored as an integer without changing its string form.
+     *
+     * Accepts an optional minus sign followed by digits, without leading zeros or "-0", that fits in `int64_t`.
+     *
+     * @param value The value to parse.
+     * @param number Receives the integer on success.
+     * @return `true` if the value was parsed.
+     */
+    static bool ParseInt(std::string_view value, int64_t &number);
+
+    /**
+     * @brief Replaces the value, in place when the record has room for the new payload.
+     *
+     * @param slabs The allocator the record came from.
+     * @param value The new value.
+     * @param shared A handle holding `value`, whose buffer is shared instead of copied if the value is large.
+     */
+    void SetValue(SlabAllocator &slabs, std::string_view value, const CacheValue *shared = nullptr);
+
+    /**
+     * @brief Reads the value as an integer without copying it.
+     *
+     * @param number Receives the integer if the value is one in canonical decimal form.
+     * @return `true` if the value is an integer.
+     */
+    bool ToInt(int64_t &number) const;
+
+    /**
+     * @brief Replaces the value with an integer, in place.
+     *
+     * @param slabs The allocator the record came from.
+     * @param number The new value.
+     */
+    void SetInt(SlabAllocator &slabs, int64_t number);
+
+    /**
+     * @brief Appends to the value, in place when the inline payload or the external chunk has room for the result.
+     *
+     * @param slabs The allocator the record came from.
+     * @param suffix The bytes to append.
+     * @throws std::length_error If the result would be longer than `kMaxValueSize`; the value is then unchanged.
+     */
+    void Append(SlabAllocator &slabs, std::string_view suffix);
+
+    /**
+     * @brief Copies the value, formatting integer-encoded values back to decimal.
+     *
+     * @param out Receives the value.
+     */
+    void CopyValue(std::string &out) const;
+
+    /**
+     * @brief Returns a handle to the value: a new reference to a shared buffer, or a copy of a smaller value.
+     */
+    CacheValue Handle() const;
+
+    /**
+     * @brief Returns the key, which is stored inline after the header and version.
+     */
+    std::string_view Key() const
+    {
+        return std::string_view(reinterpret_cast<const char *>(this) + kRecordHeader, key_size);
+    }
+
+    /**
+     * @brief Returns the version the cache stamped on the entry at its last write.
+     */
+    uint64_t Version() const
+    {
+        uint64_t version;
+        std::memcpy(&version, reinterpret_cast<const char *>(this) + sizeof(CacheItem), sizeof(version));
+        return version;
+    }
+
+    /**
+     * @brief Stamps the entry with a new version.
+     */
+    void SetVersion(uint64_t version)
+    {
+        std::memcpy(reinterpret_cast<char *>(this) + sizeof(CacheItem), &version, sizeof(version));
+    }
+
+    /**
+     * @brief Returns the bytes held by this entry: the record and the value chunk or shared buffer if any.
+     */
+    size_t AllocatedBytes() const;
+
+private:
+    CacheItem() = default;
+
+    /**
+     * @brief Returns the start of the value payload, right after the key.
+     */
+    char *Payload() { return reinterpret_cast<char *>(this) + kRecordHeader + key_size; }
+    const char *Payload() const { return reinterpret_cast<const char *>(this) + kRecordHeader + key_size; }
+
+    /**
+     * @brief Returns the chunk holding an external value.
+     */
+    char *ExternalValue() const;
+
+    /**
+     * @brief Returns the buffer holding a shared value.
+     */
+    CacheValue::Buffer *SharedValue() const;
+
+    /**
+     * @brief Frees the value chunk or drops the reference to the shared buffer, if any.
+     */
+    void ReleasePayload(SlabAllocator &slabs);
+
+    /**
+     * @brief Writes a payload for `value` into the record, which must have room for it.
+     */
+    void StorePayload(SlabAllocator &slabs, std::string_view value, const CacheValue *shared);
+
+    /**
+     * @brief Returns the payload bytes `value` needs inside the record.
+     */
+    static size_t PayloadSize(std::string_view value);
+};
+
+#endif // CACHE_ITEM_H
@@ -0,0 +1,85 @@
+#include "Cache.h"
+#include <algorithm>
+#include <iostream>
+#include <shared_mutex>
+
+#include "GlobMatch.h"
+
+namespace
+{
+    /**
+     * @brief Returns the literal characters a glob-style pattern starts with, up to its first special character.
+     */
+    std::string_view LiteralPrefix(std::string_view pattern)
+    {
+        return pattern.substr(0, std::min(pattern.find_first_of("*?[\\"), pattern.size()));
+    }
+}
+
+/**
+ * @brief Returns every key matching a glob-style pattern.
+ *
+ * With the ordered index enabled, only the keys starting with the pattern's literal prefix (the characters before
+ * its first `*`, `?`, `[` or `\`) are visited, so "tenant:123:*" costs O(log n + matches) and the keys come back
+ * in order. Without it, every key is visited. Either way the whole walk runs under one shared lock acquisition, so
+ * a pattern matching most of a large cache delays writers for its duration; prefer `Scan` for those.
+ *
+ * Expired keys are skipped. Keys are copied under the lock and matched against `pattern` after it is released.
+ *
+ * @param pattern A glob-style pattern (see `GlobMatch`), or an empty string to return every key.
+ * @param keys Receives the matching keys.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+void Cache::Keys(const std::string &pattern, std::vector<std::string> &keys)
+{
+    std::string_view prefix = LiteralPrefix(pattern);
+    std::vector<std::string> candidates;
+    auto now = std::chrono::steady_clock::now();
+
+    {
+        // Reading the indexes does not modify anything, so KEYS shares the lock with readers
+        std::shared_lock<TimedSharedMutex> lock(mutex_);
+
+        if (ordered_)
+        {
+            for (auto it = ordered_->LowerBound(prefix); it.Valid(); ++it)
+            {
+                std::string_view key = (*it)->Key();
+                if (key.substr(0, prefix.size()) != prefix)
+                {
+                    break;
+                }
+                if ((*it)->expiration > now)
+                {
+                    candidates.emplace_back(key);
+                }
+            }
+        }
+        else
+        {
+            for (size_t slot = 0; slot < items_.SlotCount(); ++slot)
+            {
+                CacheItem *item = items_.At(slot);
+                if (item != nullptr && item->expiration > now && item->Key().substr(0, prefix.size()) == prefix)
+                {
+                    candidates.emplace_back(item->Key());
+                }
+            }
+        }
+    }
+
+    // Match the rest of the pattern outside the lock
+    keys.clear();
+    for (auto &key : candidates)
+    {
+        if (prefix.size() == pattern.size() || GlobMatch(pattern, key))
+        {
+            keys.push_back(std::move(key));
+        }
+    }
+
+    // Log a message with the number of keys found
+    file_logger_->info("KEYS '" + pattern + "': " + std::to_string(keys.size()) + " keys");
+    std::cout << "KEYS '" << pattern << "': " << keys.size() << " keys" << std::endl;
+}
@@ -0,0 +1,69 @@
+#include "Cache.h"
+#include <iostream>
+
+/**
+ * @brief Frees the values queued by `DeferFree` until the cache is destroyed.
+ *
+ * The thread sleeps until values are queued, then swaps the whole queue out under `lazy_free_mutex_` and drops the
+ * references outside of any lock. A reader still holding a `CacheValue` handle keeps its buffer alive; the buffer
+ * is then freed by whichever thread drops the last reference. When the cache is destroyed, the queue is drained
+ * before the thread exits.
+ */
+void Cache::LazyFree()
+{
+    std::vector<CacheValue> batch;
+    std::unique_lock<std::mutex> lock(lazy_free_mutex_);
+
+    while (true)
+    {
+        lazy_free_cv_.wait(lock, [this]
+                           { return lazy_free_stopping_ || !lazy_free_queue_.empty(); });
+        if (lazy_free_queue_.empty())
+        {
+            return;
+        }
+
+        batch.swap(lazy_free_queue_);
+        lock.unlock();
+
+        size_t count = batch.size();
+        size_t bytes = 0;
+        for (const auto &value : batch)
+        {
+            bytes += value.Size();
+        }
+        batch.clear();
+        lazy_free_pending_.fetch_sub(bytes, std::memory_order_relaxed);
+
+        // Log a message indicating the values freed
+        file_logger_->info("LAZYFREE: freed " + std::to_string(count) + " values, " + std::to_string(bytes) + " bytes");
+
+        lock.lock();
+    }
+}
+
+/**
+ * @brief Queues a large value for `LazyFree`.
+ *
+ * Only shared buffers can be freed off the cache lock: records and smaller values live in the slab allocator,
+ * which the cache only uses under its exclusive lock, and are cheap to free anyway.
+ *
+ * @note This method assumes that the caller already holds the mutex lock exclusively.
+ *
+ * @param item An entry that is about to be erased or have its value replaced.
+ */
+void Cache::DeferFree(const CacheItem &item)
+{
+    if (lazy_free_threshold_ == 0 || item.encoding != CacheItem::kShared || item.value_size < lazy_free_threshold_)
+    {
+        return;
+    }
+
+    CacheValue value = item.Handle();
+    lazy_free_pending_.fetch_add(value.Size(), std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(lazy_free_mutex_);
+        lazy_free_queue_.push_back(std::move(value));
+    }
+    lazy_free_cv_.notify_one();
+}
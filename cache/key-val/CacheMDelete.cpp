@@ -0,0 +1,43 @@
+#include "Cache.h"
+#include <iostream>
+
+/**
+ * @brief Deletes several keys under a single exclusive lock acquisition.
+ *
+ * The keys are hashed before the lock is taken, so the lock is only held for the index and policy updates.
+ *
+ * @param keys The keys to delete.
+ * @param deleted Receives, for each key, whether it existed.
+ * @return The number of keys deleted.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+size_t Cache::MDelete(const std::vector<std::string> &keys, std::vector<bool> &deleted)
+{
+    // Hash the keys before taking the lock
+    std::vector<size_t> hashes(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        hashes[i] = SwissIndex::Hash(keys[i]);
+    }
+
+    deleted.assign(keys.size(), false);
+    size_t count = 0;
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            if (DeleteLocked(keys[i], hashes[i]))
+            {
+                deleted[i] = true;
+                ++count;
+            }
+        }
+    }
+
+    // Log one line for the whole batch
+    file_logger_->info("MDEL " + std::to_string(keys.size()) + " keys: " + std::to_string(count) + " deleted");
+    std::cout << "MDEL " << keys.size() << " keys: " << count << " deleted" << std::endl;
+    return count;
+}
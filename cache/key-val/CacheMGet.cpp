@@ -0,0 +1,93 @@
+#include "Cache.h"
+#include <iostream>
+#include <shared_mutex>
+
+/**
+ * @brief Retrieves the values of several keys under a single lock acquisition.
+ *
+ * All keys are hashed before the lock is taken and looked up against the same clock reading, so a batch of N keys
+ * costs one lock round-trip instead of N. Like `Get`, the lock is shared if the eviction policy allows it; otherwise
+ * expired entries found along the way are erased and misses are reported to the policy. Large values are copied
+ * after the lock is released.
+ *
+ * @param keys The keys to look up.
+ * @param values Receives one value per key, empty for keys that were not found.
+ * @param found Receives, for each key, whether it exists and has not expired.
+ * @return The number of keys found.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+size_t Cache::MGet(const std::vector<std::string> &keys,
+                   std::vector<std::string> &values,
+                   std::vector<bool> &found)
+{
+    // Hash the keys before taking the lock
+    std::vector<size_t> hashes(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        hashes[i] = SwissIndex::Hash(keys[i]);
+        hot_keys_.Record(keys[i], hashes[i]);
+    }
+
+    values.assign(keys.size(), std::string());
+    found.assign(keys.size(), false);
+    std::vector<CacheValue> deferred(keys.size());
+    auto now = std::chrono::steady_clock::now();
+    size_t hits = 0;
+
+    auto lookup = [&](bool exclusive)
+    {
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            if (found[i])
+            {
+                continue;
+            }
+            CacheItem *item = GetLocked(keys[i], hashes[i], now, exclusive);
+            if (item != nullptr)
+            {
+                ReadValue(*item, values[i], deferred[i]);
+                found[i] = true;
+                ++hits;
+            }
+        }
+    };
+
+    bool exclusive = !policy_->SharedAccess();
+    if (!exclusive)
+    {
+        // A hit does not reorder anything under this policy, so readers can share the lock
+        std::shared_lock<TimedSharedMutex> lock(mutex_);
+        lookup(false);
+
+        // Promoting keys back from the disk tier needs the exclusive lock; the second pass only looks up the misses
+        for (size_t i = 0; i < keys.size() && !exclusive; ++i)
+        {
+            exclusive = !found[i] && MaybeSpilled(hashes[i]);
+        }
+    }
+
+    if (exclusive)
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        lookup(true);
+    }
+
+    // Large values are copied only now that the lock is released
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        if (deferred[i].Shared())
+        {
+            values[i].assign(deferred[i].View());
+        }
+    }
+
+    stats_.Add(Stat::kKeyspaceHits, hits);
+    stats_.Add(Stat::kKeyspaceMisses, keys.size() - hits);
+
+    // Log one line for the whole batch
+    file_logger_->info("MGET " + std::to_string(keys.size()) + " keys: " + std::to_string(hits) + " found");
+    std::cout << "MGET " << keys.size() << " keys: " << hits << " found" << std::endl;
+    return hits;
+}
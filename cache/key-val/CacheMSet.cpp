@@ -0,0 +1,49 @@
+#include "Cache.h"
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Stores several key-value pairs under a single exclusive lock acquisition.
+ *
+ * Every pair is validated, hashed and given its expiration time before the lock is taken, so a refused pair
+ * leaves the cache untouched and the lock is only held for the index and policy updates. Each pair is then set
+ * exactly like `Set` would, evicting as needed; with a small cache, later pairs of a large batch may evict earlier
+ * ones.
+ *
+ * @param entries The pairs to store, in order; a later pair for the same key wins.
+ * @throws std::length_error If any key is longer than `CacheItem::kMaxKeySize` or any entry alone is larger than
+ *                           the byte budget.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+void Cache::MSet(const std::vector<CacheSetRequest> &entries)
+{
+    std::vector<size_t> hashes(entries.size());
+    std::vector<std::chrono::steady_clock::time_point> expirations(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        CheckEntry(entries[i].key, entries[i].value);
+        hashes[i] = SwissIndex::Hash(entries[i].key);
+        hot_keys_.Record(entries[i].key, hashes[i]);
+        expirations[i] = ExpirationAfter(entries[i].duration);
+    }
+
+    size_t inserted = 0;
+    {
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (SetLocked(entries[i].key, hashes[i], entries[i].value, expirations[i]))
+            {
+                ++inserted;
+            }
+        }
+    }
+
+    stats_.Add(Stat::kSets, entries.size());
+
+    // Log one line for the whole batch
+    file_logger_->info("MSET " + std::to_string(entries.size()) + " keys: " + std::to_string(inserted) + " new");
+    std::cout << "MSET " << entries.size() << " keys: " << inserted << " new" << std::endl;
+}
@@ -0,0 +1,131 @@
+#include <shared_mutex>
+
+#include "Cache.h"
+
+/**
+ * @brief Computes the bytes accounted to an entry against the memory budget.
+ *
+ * Counts the slab chunk holding the entry's record (header, key and inline value), the chunk holding its value if
+ * the value is stored separately, and the entry's share of index slots and, if the ordered index is enabled, of
+ * its leaves.
+ *
+ * @param item The entry.
+ * @return The entry's footprint in bytes.
+ */
+size_t Cache::Footprint(const CacheItem &item) const
+{
+    return item.AllocatedBytes() + SwissIndex::kSlotBytes * 8 / 7 + (ordered_ ? OrderedIndex::kEntryBytes : 0);
+}
+
+/**
+ * @brief Checks the entry and byte limits.
+ *
+ * @param incoming Bytes about to be added.
+ * @param extra_entries Entries about to be added.
+ * @return `true` if either limit would be exceeded.
+ */
+bool Cache::OverLimits(size_t incoming, size_t extra_entries) const
+{
+    if (items_.Size() + extra_entries > max_size_)
+    {
+        return true;
+    }
+    return max_memory_ != 0 && used_memory_.load(std::memory_order_relaxed) + incoming > max_memory_;
+}
+
+/**
+ * @brief Erases and frees an entry, unschedules its expiry and subtracts its footprint from the accounting.
+ *
+ * A large value is handed to the lazy-free thread instead of being freed here.
+ *
+ * @note This method assumes that the caller already holds the mutex lock exclusively and has detached the entry
+ *       from the eviction policy.
+ *
+ * @param item The entry to erase.
+ */
+void Cache::EraseItem(CacheItem *item)
+{
+    DeferFree(*item);
+    expiry_.Unschedule(item);
+    used_memory_.fetch_sub(Footprint(*item), std::memory_order_relaxed);
+    items_.Erase(item);
+    if (ordered_)
+    {
+        ordered_->Erase(item);
+    }
+    key_count_.store(items_.Size(), std::memory_order_relaxed);
+    CacheItem::Destroy(slabs_, item);
+}
+
+/**
+ * @brief Re-accounts an entry whose value changed in place and evicts other entries until usage is back under the
+ *        byte budget.
+ *
+ * @note This method assumes that the caller already holds the mutex lock exclusively.
+ *
+ * @param item The modified entry, which is never evicted here.
+ * @param old_footprint `Footprint(item)` before the change.
+ */
+void Cache::Reaccount(CacheItem &item, size_t old_footprint)
+{
+    used_memory_.fetch_sub(old_footprint, std::memory_order_relaxed);
+    used_memory_.fetch_add(Footprint(item), std::memory_order_relaxed);
+
+    // A larger value may push the cache over its byte budget; evict other entries until it fits
+    while (OverLimits(0, 0) && Evict(&item))
+    {
+    }
+}
+
+/**
+ * @brief Reports the accounted memory usage and the limits.
+ *
+ * The counters are atomics maintained by writers, so this never waits for the cache lock.
+ *
+ * @return A snapshot of the memory accounting.
+ */
+CacheMemoryStats Cache::MemoryStats()
+{
+    CacheMemoryStats stats;
+    stats.used_memory = used_memory_.load(std::memory_order_relaxed);
+    stats.max_memory = max_memory_;
+    stats.keys = key_count_.load(std::memory_order_relaxed);
+    stats.max_keys = max_size_;
+    stats.allocated_memory = slabs_.ReservedBytes();
+    stats.lazy_free_pending = lazy_free_pending_.load(std::memory_order_relaxed);
+    stats.spilled_keys = spill_ ? spill_->Size() : 0;
+    stats.spilled_bytes = spill_ ? spill_->Bytes() : 0;
+    return stats;
+}
+
+/**
+ * @brief Reports the bytes accounted to a single key.
+ *
+ * @param key The key to look up.
+ * @param bytes Receives the key's footprint if it exists.
+ * @return `true` if the key exists and has not expired, otherwise `false`.
+ */
+bool Cache::MemoryUsage(const std::string &key, size_t &bytes)
+{
+    std::shared_lock<TimedSharedMutex> lock(mutex_);
+
+    CacheItem *item = items_.Find(key, SwissIndex::Hash(key));
+    if (item == nullptr || item->expiration <= std::chrono::steady_clock::now())
+    {
+        return false;
+    }
+
+    bytes = Footprint(*item);
+    return true;
+}
+
+/**
+ * @brief Reports the usage of each slab allocator size class.
+ *
+ * @return One entry per size class that currently holds slabs, by increasing chunk size.
+ */
+std::vector<SlabClassStats> Cache::SlabStats()
+{
+    std::shared_lock<TimedSharedMutex> lock(mutex_);
+    return slabs_.Stats();
+}
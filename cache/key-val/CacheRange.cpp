@@ -0,0 +1,51 @@
+#include "Cache.h"
+#include <iostream>
+#include <shared_mutex>
+#include <stdexcept>
+
+/**
+ * @brief Returns the keys in `[start, end)` in key order.
+ *
+ * Descends the ordered index once to `start` and walks its leaves, so a range costs O(log n + matches) under one
+ * shared lock acquisition. Expired keys are skipped and do not count towards `limit`. To page through a large
+ * range, pass the last key returned followed by a NUL byte as the next `start`.
+ *
+ * @param start The smallest key to return.
+ * @param end The first key past the range, or an empty string for no upper bound.
+ * @param limit The most keys to return, or 0 for no limit.
+ * @param keys Receives the keys in the range.
+ * @throws std::logic_error If the ordered index is disabled.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+void Cache::Range(const std::string &start, const std::string &end, size_t limit, std::vector<std::string> &keys)
+{
+    if (!ordered_)
+    {
+        throw std::logic_error("the ordered index is disabled");
+    }
+
+    keys.clear();
+    auto now = std::chrono::steady_clock::now();
+    {
+        // Reading the index does not modify anything, so ranges share the lock with readers
+        std::shared_lock<TimedSharedMutex> lock(mutex_);
+
+        for (auto it = ordered_->LowerBound(start); it.Valid() && (limit == 0 || keys.size() < limit); ++it)
+        {
+            std::string_view key = (*it)->Key();
+            if (!end.empty() && key >= end)
+            {
+                break;
+            }
+            if ((*it)->expiration > now)
+            {
+                keys.emplace_back(key);
+            }
+        }
+    }
+
+    // Log a message with the number of keys found
+    file_logger_->info("RANGE ['" + start + "', '" + end + "'): " + std::to_string(keys.size()) + " keys");
+    std::cout << "RANGE ['" << start << "', '" << end << "'): " << keys.size() << " keys" << std::endl;
+}
@@ -0,0 +1,78 @@
+#include "Cache.h"
+#include <iostream>
+#include <shared_mutex>
+
+#include "GlobMatch.h"
+
+/**
+ * @brief Iterates over the keys a few at a time with a stateless cursor.
+ *
+ * Each call resumes the walk of the index where `cursor` points and stops once it has collected about `count` keys,
+ * or has visited `10 * count` home groups without finding enough. The walk only takes the lock shared, and drops
+ * it every `kScanStepsPerLock` groups, so even a large `count` never stalls other operations for long. Keys are
+ * copied under the lock and matched against `pattern` after it is released, so a selective pattern may return
+ * fewer than `count` keys, or none, while the scan is not finished. Expired keys are skipped.
+ *
+ * A scan that starts from cursor 0 and runs until a call returns 0 returns every key that exists for the whole scan
+ * at least once; keys added or removed meanwhile may or may not be returned, and a key may be returned twice if the
+ * index grows mid-scan (see `SwissIndex::Scan`).
+ *
+ * @param cursor 0 to start a scan, or the value returned by the previous call.
+ * @param pattern A glob-style pattern (see `GlobMatch`), or an empty string to return every key.
+ * @param count A hint for how many keys to examine per call; at least 1.
+ * @param keys Receives the matching keys of this call.
+ * @return The cursor to pass to the next call, or 0 once the scan is complete.
+ *
+ * @note This method is thread-safe and uses a mutex to protect shared resources.
+ */
+size_t Cache::Scan(size_t cursor, const std::string &pattern, size_t count, std::vector<std::string> &keys)
+{
+    count = count == 0 ? 1 : count;
+    const size_t max_steps = count * 10;
+
+    std::vector<CacheItem *> batch;
+    std::vector<std::string> candidates;
+    size_t steps = 0;
+    auto now = std::chrono::steady_clock::now();
+
+    do
+    {
+        // Reading the index does not modify anything, so scans share the lock with readers
+        std::shared_lock<TimedSharedMutex> lock(mutex_);
+
+        for (size_t held = 0; held < kScanStepsPerLock; ++held)
+        {
+            batch.clear();
+            cursor = items_.Scan(cursor, batch);
+            ++steps;
+
+            for (CacheItem *item : batch)
+            {
+                if (item->expiration > now)
+                {
+                    candidates.emplace_back(item->Key());
+                }
+            }
+
+            if (cursor == 0 || candidates.size() >= count || steps >= max_steps)
+            {
+                break;
+            }
+        }
+    } while (cursor != 0 && candidates.size() < count && steps < max_steps);
+
+    // Match the pattern outside the lock
+    keys.clear();
+    for (auto &key : candidates)
+    {
+        if (pattern.empty() || GlobMatch(pattern, key))
+        {
+            keys.push_back(std::move(key));
+        }
+    }
+
+    // Log a message with the progress of the scan
+    file_logger_->info("SCAN: " + std::to_string(keys.size()) + " keys, next cursor " + std::to_string(cursor));
+    std::cout << "SCAN: " << keys.size() << " keys, next cursor " << cursor << std::endl;
+    return cursor;
+}
@@ -1,5 +1,6 @@
 #include "Cache.h"
 #include <iostream>
+#include <stdexcept>
 
 #include "LoggerManager.h"
 #include "FileLogger.h"
@@ -8,13 +9,16 @@
  * @brief Sets a key-value pair in the cache with a specified time-to-live (TTL).
  *
  * This method inserts or updates a key-value pair in the cache. If the key already exists, the value is updated,
- * and the key is moved to the front of the usage order list to indicate it has been recently used.
- * If the key does not exist and the cache has reached its maximum size, the least recently used (LRU) item
- * is evicted before inserting the new key-value pair. The item will expire after the specified duration.
+ * and the update is reported to the eviction policy as an access.
+ * If the key does not exist and the cache has reached its maximum size, the eviction policy's victim
+ * is evicted before inserting the new key-value pair. With a byte budget, victims are evicted until the new entry
+ * fits; an update that grows a value evicts other entries until usage is back under the budget. The item will
+ * expire after the specified duration and is indexed in the timer wheel so `Cleanup` can reap it on time.
  *
  * @param key The key to be set in the cache.
  * @param value The value associated with the key to be set in the cache.
- * @param duration The duration (in seconds) for which the key-value pair should remain in the cache.
+ * @param duration The duration (in seconds) for which the key-value pair should remain in the cache, or 0 for an
+ *                 entry that never expires.
  *
  * @note This method is thread-safe and uses a mutex to protect shared resources.
  */
@@ -23,43 +27,190 @@ void Cache::Set(const std::string &key,
                 std::chrono::seconds duration
 )
 {
-    // Lock the mutex to ensure thread-safety
-    std::lock_guard<std::mutex> lock(mutex_);
+    Store(key, value, nullptr, duration);
+}
 
-    // Search for the key in the cache
-    auto it = items_.find(key);
-
-    // If the key already exists, update the value and expiration time
-    if (it != items_.end())
+/**
+ * @brief Sets a key-value pair, taking ownership of the value.
+ *
+ * A value of at least `CacheItem::kMinSharedValue` bytes is moved into a shared buffer before the lock is taken
+ * and the entry adopts the buffer, so the value is never copied; smaller values are copied into the entry record
+ * as with the `const` overload.
+ *
+ * @param key The key to be set in the cache.
+ * @param value The value, moved from.
+ * @param duration The TTL in seconds, or 0 for an entry that never expires.
+ */
+void Cache::Set(const std::string &key, std::string &&value, std::chrono::seconds duration)
+{
+    if (value.size() >= CacheItem::kMinSharedValue)
     {
-        // Update the value associated with the key
-        it->second.first.value = value;
-        // Update the expiration time of the key-value pair
-        it->second.first.expiration = std::chrono::steady_clock::now() + duration;
-        // Move the key to the front of the usage order list
-        MoveToFront(key);
+        CacheValue shared(std::move(value));
+        Store(key, shared.View(), &shared, duration);
+        return;
     }
-    else
+    Store(key, value, nullptr, duration);
+}
+
+/**
+ * @brief Sets a key-value pair from a value handle.
+ *
+ * A large value's buffer is shared between the handle and the entry rather than copied, so storing the same
+ * handle under many keys keeps a single copy of the value.
+ *
+ * @param key The key to be set in the cache.
+ * @param value A handle to the value.
+ * @param duration The TTL in seconds, or 0 for an entry that never expires.
+ */
+void Cache::Set(const std::string &key, const CacheValue &value, std::chrono::seconds duration)
+{
+    Store(key, value.View(), &value, duration);
+}
+
+/**
+ * @brief Validates a key-value pair, then inserts or updates it under the exclusive lock.
+ *
+ * @param key The key to be set in the cache.
+ * @param value The value.
+ * @param shared A handle holding `value`, or `nullptr`.
+ * @param duration The TTL in seconds, or 0 for an entry that never expires.
+ */
+void Cache::Store(const std::string &key,
+                  std::string_view value,
+                  const CacheValue *shared,
+                  std::chrono::seconds duration)
+{
+    CheckEntry(key, value);
+    auto expiration = ExpirationAfter(duration);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    bool inserted;
     {
-        // Key does not exist, create a new CacheItem
-        CacheItem item;
-        item.value = value;
-        item.expiration = std::chrono::steady_clock::now() + duration;
-
-        // Check if the cache has reached its maximum size
-        if (items_.size() >= max_size_)
-        {
-            // Evict the least recently used item
-            Evict();
-        }
-
-        // Insert the new key at the beginning of the usage order list
-        auto list_it = usage_order_.insert(usage_order_.begin(), key);
-        // Add the new key-value pair to the cache
-        items_[key] = {item, list_it};
+        // Lock the mutex to ensure thread-safety
+        std::unique_lock<TimedSharedMutex> lock(mutex_);
+        inserted = SetLocked(key, hash, value, expiration, shared);
+    }
+    stats_.Add(Stat::kSets);
 
+    if (inserted)
+    {
         // Log a message indicating the key has been set
         file_logger_->info("Key '" + key + "' is SET");
         std::cout << "Key '" << key << "' is SET" << std::endl;
     }
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Refuses entries that can never be stored.
+ *
+ * @param key The key to be set.
+ * @param value The value to be set.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize`, the value longer than
+ *                           `CacheItem::kMaxValueSize`, or the entry alone is larger than the byte budget.
+ */
+void Cache::CheckEntry(const std::string &key, std::string_view value) const
+{
+    // Keys are stored inline in the entry record with a 16-bit length
+    if (key.size() > CacheItem::kMaxKeySize)
+    {
+        throw std::length_error("key is longer than " + std::to_string(CacheItem::kMaxKeySize) + " bytes");
+    }
+
+    // Value lengths are stored in the entry record in 32 bits
+    if (value.size() > CacheItem::kMaxValueSize)
+    {
+        throw std::length_error("value is longer than " + std::to_string(CacheItem::kMaxValueSize) + " bytes");
+    }
+
+    // An entry that cannot fit even in an empty cache is refused up front
+    if (max_memory_ != 0 && kEntryOverhead + key.size() + value.size() > max_memory_)
+    {
+        throw std::length_error("OOM: value for key '" + key + "' is larger than maxmemory");
+    }
+}
+
+/**
+ * @brief Computes the expiration time of an entry set now with the given TTL.
+ *
+ * @param duration The TTL, or 0 for an entry that never expires.
+ * @return The expiration time, `time_point::max()` for a zero TTL.
+ */
+std::chrono::steady_clock::time_point Cache::ExpirationAfter(std::chrono::seconds duration)
+{
+    return duration.count() == 0 ? std::chrono::steady_clock::time_point::max()
+                                 : std::chrono::steady_clock::now() + duration;
+}
+
+/**
+ * @brief Inserts or updates an entry. The caller holds the exclusive lock and has validated the entry.
+ *
+ * @param key The key to be set.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @param value The value to be set.
+ * @param expiration The entry's expiration time.
+ * @param shared A handle holding `value`, whose buffer is shared instead of copied if the value is large.
+ * @return `true` if a new entry was inserted, `false` if an existing one was updated. Either way the entry has a
+ *         new version.
+ */
+bool Cache::SetLocked(const std::string &key,
+                      size_t hash,
+                      std::string_view value,
+                      std::chrono::steady_clock::time_point expiration,
+                      const CacheValue *shared)
+{
+    // Search for the key in the cache
+    CacheItem *existing = items_.Find(key, hash);
+
+    // If the key already exists, update the value and expiration time
+    if (existing != nullptr)
+    {
+        CacheItem &item = *existing;
+
+        // Update the value associated with the key, remembering the old footprint; a large old value is freed
+        // by the lazy-free thread
+        size_t old_footprint = Footprint(item);
+        DeferFree(item);
+        item.SetValue(slabs_, value, shared);
+        item.SetVersion(++version_clock_);
+        // Update the expiration time of the key-value pair and move it in the timer wheel
+        item.expiration = expiration;
+        expiry_.Reschedule(&item);
+        // Report the overwrite to the eviction policy as an access
+        policy_->OnAccess(&item);
+
+        // Re-account the entry, since the value may have grown or shrunk
+        Reaccount(item, old_footprint);
+        return false;
+    }
+
+    // Evict the eviction policy's victims until the new entry fits in both limits
+    size_t incoming = kEntryOverhead + key.size() + value.size();
+    while (!items_.Empty() && OverLimits(incoming, 1) && Evict())
+    {
+    }
+
+    // Key does not exist, so any copy on the disk tier is stale; create a new entry record and index it
+    if (spill_)
+    {
+        spill_->Erase(key, hash);
+    }
+    CacheItem &item = *CacheItem::Create(slabs_, key, value, shared);
+    item.expiration = expiration;
+    item.hash = hash;
+    item.SetVersion(++version_clock_);
+    items_.Insert(&item);
+    if (ordered_)
+    {
+        ordered_->Insert(&item);
+    }
+    used_memory_.fetch_add(Footprint(item), std::memory_order_relaxed);
+    key_count_.store(items_.Size(), std::memory_order_relaxed);
+    expiry_.Schedule(&item);
+
+    // Hand the new entry to the eviction policy
+    policy_->OnInsert(&item);
+    return true;
+}
@@ -0,0 +1,61 @@
+#include "Cache.h"
+#include <iostream>
+
+/**
+ * @brief Writes an entry that is about to be evicted to the disk tier.
+ *
+ * The copy into the file's mapping happens under the cache lock; it usually only dirties page cache pages, which
+ * the kernel writes back later.
+ *
+ * @note This method assumes that the caller already holds the mutex lock exclusively.
+ *
+ * @param key The entry's key.
+ * @param item The entry.
+ * @return `true` if the value was written; expired entries and values larger than a segment are not.
+ */
+bool Cache::Spill(const std::string &key, const CacheItem &item)
+{
+    if (item.expiration <= std::chrono::steady_clock::now())
+    {
+        return false;
+    }
+
+    // A handle views a shared value in place and copies only small ones
+    CacheValue value = item.Handle();
+    return spill_->Put(key, item.hash, value.View(), item.expiration, item.Version());
+}
+
+/**
+ * @brief Moves a key from the disk tier back to memory.
+ *
+ * The value is read from the file and stored like a SET with the entry's original expiration time, which may evict
+ * other entries to the disk tier in turn. The entry keeps the version it had when it was spilled, so a round trip
+ * through the disk tier does not fail a pending CAS. The key leaves the disk tier either way; an expired entry is
+ * dropped.
+ *
+ * @note This method assumes that the caller already holds the mutex lock exclusively.
+ *
+ * @param key The key, which is not in memory.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @param now The time against which the entry's expiration is checked.
+ * @return The promoted entry, or `nullptr` if the disk tier does not hold the key or its entry expired.
+ */
+CacheItem *Cache::Promote(const std::string &key, size_t hash, std::chrono::steady_clock::time_point now)
+{
+    std::string value;
+    std::chrono::steady_clock::time_point expiration;
+    uint64_t version;
+    if (!spill_ || !spill_->Take(key, hash, value, expiration, version) || expiration <= now)
+    {
+        return nullptr;
+    }
+
+    SetLocked(key, hash, value, expiration);
+    CacheItem *item = items_.Find(key, hash);
+    item->SetVersion(version);
+
+    // Log the promotion
+    file_logger_->info("Promoted key '" + key + "' from disk");
+    std::cout << "Promoted key '" << key << "' from disk" << std::endl;
+    return item;
+}
@@ -0,0 +1,68 @@
+#include <utility>
+
+#include "CacheValue.h"
+
+CacheValue::CacheValue(std::string value)
+    : buffer_(new Buffer())
+{
+    buffer_->data = std::move(value);
+}
+
+CacheValue::CacheValue(const CacheValue &other)
+    : buffer_(other.buffer_), local_(other.local_)
+{
+    if (buffer_ != nullptr)
+    {
+        Retain(buffer_);
+    }
+}
+
+CacheValue::CacheValue(CacheValue &&other) noexcept
+    : buffer_(std::exchange(other.buffer_, nullptr)), local_(std::move(other.local_))
+{
+}
+
+CacheValue &CacheValue::operator=(CacheValue other) noexcept
+{
+    std::swap(buffer_, other.buffer_);
+    std::swap(local_, other.local_);
+    return *this;
+}
+
+CacheValue::~CacheValue()
+{
+    if (buffer_ != nullptr)
+    {
+        Release(buffer_);
+    }
+}
+
+CacheValue CacheValue::Share(Buffer *buffer)
+{
+    Retain(buffer);
+    CacheValue handle;
+    handle.buffer_ = buffer;
+    return handle;
+}
+
+void CacheValue::Retain(Buffer *buffer)
+{
+    buffer->refs.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief The last reference may be dropped by any thread, outside the cache lock, so buffers come from the global
+ *        heap rather than the cache's unsynchronized slab allocator.
+ */
+void CacheValue::Release(Buffer *buffer)
+{
+    if (buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        delete buffer;
+    }
+}
+
+size_t CacheValue::BufferBytes(const Buffer *buffer)
+{
+    return sizeof(Buffer) + buffer->data.capacity() + 1;
+}
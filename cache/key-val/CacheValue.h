@@ -0,0 +1,99 @@
+#ifndef CACHE_VALUE_H
+#define CACHE_VALUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @class CacheValue
+ * @brief An immutable handle to a cache value, sharing large values by reference count.
+ *
+ * The cache stores large values in reference-counted buffers, so a `Get` returning a handle only bumps the count
+ * under the cache lock and the caller reads the bytes after the lock is released. The handle stays valid after
+ * the entry is overwritten, deleted or evicted; the buffer is freed when its last handle goes away. Small values
+ * are copied into the handle instead, which is cheaper than sharing them.
+ *
+ * A handle built from a string takes ownership of it without copying. Passing it to `ICache::Set` stores a large
+ * value without copying it again, and the same buffer can be stored under several keys.
+ *
+ * Copying a handle is thread-safe; the bytes are never modified while more than one handle refers to them.
+ */
+class CacheValue
+{
+public:
+    /**
+     * @brief Constructs an empty value.
+     */
+    CacheValue() = default;
+
+    /**
+     * @brief Takes ownership of a string as a shared buffer.
+     *
+     * @param value The value, moved into the buffer.
+     */
+    explicit CacheValue(std::string value);
+
+    CacheValue(const CacheValue &other);
+    CacheValue(CacheValue &&other) noexcept;
+    CacheValue &operator=(CacheValue other) noexcept;
+    ~CacheValue();
+
+    /**
+     * @brief Returns the value's bytes, valid as long as this handle is.
+     */
+    std::string_view View() const
+    {
+        return buffer_ != nullptr ? std::string_view(buffer_->data) : std::string_view(local_);
+    }
+
+    /**
+     * @brief Returns the length of the value.
+     */
+    size_t Size() const { return View().size(); }
+
+    /**
+     * @brief Returns whether the handle shares a buffer rather than holding a private copy.
+     */
+    bool Shared() const { return buffer_ != nullptr; }
+
+private:
+    friend struct CacheItem;
+    friend class EpochCache;
+
+    /**
+     * @brief A reference-counted value buffer.
+     */
+    struct Buffer
+    {
+        std::atomic<uint32_t> refs{1}; ///< Handles and cache entries referring to the buffer.
+        std::string data;              ///< The value.
+    };
+
+    Buffer *buffer_ = nullptr; ///< The shared buffer, or `nullptr` if the value is held in `local_`.
+    std::string local_;        ///< A private copy of a small value.
+
+    /**
+     * @brief Makes a handle to `buffer`, taking a new reference.
+     */
+    static CacheValue Share(Buffer *buffer);
+
+    /**
+     * @brief Takes a new reference to `buffer`.
+     */
+    static void Retain(Buffer *buffer);
+
+    /**
+     * @brief Drops a reference to `buffer`, freeing it with the last one.
+     */
+    static void Release(Buffer *buffer);
+
+    /**
+     * @brief Returns the heap bytes held by `buffer`.
+     */
+    static size_t BufferBytes(const Buffer *buffer);
+};
+
+#endif // CACHE_VALUE_H
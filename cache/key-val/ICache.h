@@ -3,8 +3,49 @@
 
 #include <string>
 #include <chrono>
+#include <vector>
 
 #include "GeoPoint.h"
+#include "SlabAllocator.h"
+#include "CacheValue.h"
+#include "HotKeyTracker.h"
+
+/**
+ * @struct CacheMemoryStats
+ * @brief A snapshot of a cache's memory accounting, as reported by the MEMORY command.
+ */
+struct CacheMemoryStats
+{
+    size_t used_memory; ///< Bytes accounted to keys, values and per-entry bookkeeping.
+    size_t max_memory;  ///< The byte budget, or 0 if only the entry limit applies.
+    size_t keys;        ///< The number of stored entries.
+    size_t max_keys;    ///< The maximum number of entries.
+    size_t allocated_memory = 0; ///< Bytes the cache's allocator holds from the system, including free chunks.
+    size_t lazy_free_pending = 0; ///< Bytes of removed values still waiting to be freed in the background.
+    size_t spilled_keys = 0; ///< Keys held by the disk tier.
+    size_t spilled_bytes = 0; ///< Key and value bytes held by the disk tier.
+};
+
+/**
+ * @struct CacheSetRequest
+ * @brief One key-value pair of a batched set, as sent by the MSET command.
+ */
+struct CacheSetRequest
+{
+    std::string key;                ///< The key to set.
+    std::string value;              ///< The value associated with the key.
+    std::chrono::seconds duration;  ///< The time-to-live, or 0 for a pair that never expires.
+};
+
+/**
+ * @brief The outcome of a compare-and-set.
+ */
+enum class CasResult
+{
+    kStored,   ///< The entry had the expected version and the new value was stored.
+    kConflict, ///< The entry has another version, or exists although it was expected to be absent.
+    kNotFound, ///< The entry does not exist, or has expired.
+};
 
 /**
  * @class ICache
@@ -36,12 +77,30 @@ public:
      * @param key A string representing the key.
      * @param value A string representing the value associated with the key.
      * @param duration The time-to-live for the key-value pair. Specified as a duration
-     *                 of type `std::chrono::seconds`.
+     *                 of type `std::chrono::seconds`; 0 means the pair never expires.
      */
     virtual void Set(const std::string &key, 
                      const std::string &value, 
                      std::chrono::seconds duration) = 0;
 
+    /**
+     * @brief Stores a key-value pair, taking ownership of the value instead of copying it where possible.
+     *
+     * @param key A string representing the key.
+     * @param value The value, moved from.
+     * @param duration The time-to-live for the key-value pair; 0 means the pair never expires.
+     */
+    virtual void Set(const std::string &key, std::string &&value, std::chrono::seconds duration) = 0;
+
+    /**
+     * @brief Stores a key-value pair, sharing the handle's buffer instead of copying it where possible.
+     *
+     * @param key A string representing the key.
+     * @param value A handle to the value.
+     * @param duration The time-to-live for the key-value pair; 0 means the pair never expires.
+     */
+    virtual void Set(const std::string &key, const CacheValue &value, std::chrono::seconds duration) = 0;
+
     /**
      * @brief Retrieves the value associated with a specified key.
      *
@@ -56,6 +115,17 @@ public:
      */
     virtual bool Get(const std::string &key, std::string &value) = 0;
 
+    /**
+     * @brief Retrieves an immutable handle to the value associated with a specified key.
+     *
+     * The handle stays valid after the key is overwritten or removed.
+     *
+     * @param key A string representing the key to search for in the cache.
+     * @param value Receives a handle to the value if found.
+     * @return `true` if the key exists and has not expired, otherwise `false`.
+     */
+    virtual bool Get(const std::string &key, CacheValue &value) = 0;
+
     /**
      * @brief Deletes a key-value pair from the cache.
      *
@@ -65,6 +135,203 @@ public:
      * @param key A string representing the key of the key-value pair to delete from the cache.
      */
     virtual void Delete(const std::string &key) = 0;
+
+    /**
+     * @brief Atomically adds to an integer value.
+     *
+     * A missing key is created with the value `delta` and no expiration; an existing key keeps its TTL.
+     *
+     * @param key The key of the counter.
+     * @param delta The amount to add, which may be negative.
+     * @return The new value.
+     * @throws std::invalid_argument If the value is not an integer.
+     * @throws std::out_of_range If the result would overflow a 64-bit integer.
+     */
+    virtual int64_t IncrBy(const std::string &key, int64_t delta) = 0;
+
+    /**
+     * @brief Atomically adds to a floating-point value.
+     *
+     * A missing key is created with the value `delta` and no expiration; an existing key keeps its TTL.
+     *
+     * @param key The key of the counter.
+     * @param delta The amount to add, which may be negative.
+     * @return The new value, as stored.
+     * @throws std::invalid_argument If the value is not a number or the result is not finite.
+     */
+    virtual std::string IncrByFloat(const std::string &key, double delta) = 0;
+
+    /**
+     * @brief Atomically appends to a value.
+     *
+     * A missing key is created with the value `suffix` and no expiration; an existing key keeps its TTL.
+     *
+     * @param key The key to append to.
+     * @param suffix The bytes to append.
+     * @return The length of the value after the append.
+     */
+    virtual size_t Append(const std::string &key, const std::string &suffix) = 0;
+
+    /**
+     * @brief Atomically replaces a value and returns the previous one.
+     *
+     * Like `Set` with a duration of 0, the key no longer expires afterwards.
+     *
+     * @param key The key to set.
+     * @param value The new value.
+     * @param old_value Receives the previous value if the key existed.
+     * @return `true` if the key existed and had not expired.
+     */
+    virtual bool GetSet(const std::string &key, const std::string &value, std::string &old_value) = 0;
+
+    /**
+     * @brief Retrieves a value together with the entry's version.
+     *
+     * Every write to an entry gives it a new version, greater than any version handed out before, so a version
+     * identifies one state of the entry and can be passed to `CompareAndSet`.
+     *
+     * @param key The key to look up.
+     * @param value Receives a handle to the value if found.
+     * @param version Receives the entry's version if found.
+     * @return `true` if the key exists and has not expired.
+     */
+    virtual bool GetVersioned(const std::string &key, CacheValue &value, uint64_t &version) = 0;
+
+    /**
+     * @brief Stores a value only if the entry still has the expected version.
+     *
+     * @param key The key to set.
+     * @param value The new value.
+     * @param version The version read by `GetVersioned`, or 0 to store only if the key does not exist.
+     * @param duration The new time-to-live, or 0 for an entry that never expires.
+     * @param new_version Receives the entry's version after a successful store.
+     * @return Whether the value was stored, and why not otherwise.
+     */
+    virtual CasResult CompareAndSet(const std::string &key,
+                                    const std::string &value,
+                                    uint64_t version,
+                                    std::chrono::seconds duration,
+                                    uint64_t &new_version) = 0;
+
+    /**
+     * @brief Retrieves the values of several keys at once.
+     *
+     * @param keys The keys to look up.
+     * @param values Receives one value per key, empty for keys that were not found.
+     * @param found Receives, for each key, whether it exists and has not expired.
+     * @return The number of keys found.
+     */
+    virtual size_t MGet(const std::vector<std::string> &keys,
+                        std::vector<std::string> &values,
+                        std::vector<bool> &found) = 0;
+
+    /**
+     * @brief Stores several key-value pairs at once, each with its own duration.
+     *
+     * Either every pair is stored or, if one of them is refused, none is.
+     *
+     * @param entries The pairs to store, in order; a later pair for the same key wins.
+     */
+    virtual void MSet(const std::vector<CacheSetRequest> &entries) = 0;
+
+    /**
+     * @brief Deletes several keys at once.
+     *
+     * @param keys The keys to delete.
+     * @param deleted Receives, for each key, whether it existed.
+     * @return The number of keys deleted.
+     */
+    virtual size_t MDelete(const std::vector<std::string> &keys, std::vector<bool> &deleted) = 0;
+
+    /**
+     * @brief Iterates over the keys a few at a time with a stateless cursor.
+     *
+     * A scan starts with cursor 0 and is complete when a call returns 0. Every key that exists for the whole scan
+     * is returned at least once; a key may be returned more than once.
+     *
+     * @param cursor 0 to start a scan, or the value returned by the previous call.
+     * @param pattern A glob-style pattern the keys must match, or an empty string to return every key.
+     * @param count A hint for how many keys to examine per call.
+     * @param keys Receives the matching keys of this call.
+     * @return The cursor to pass to the next call, or 0 once the scan is complete.
+     */
+    virtual size_t Scan(size_t cursor, const std::string &pattern, size_t count, std::vector<std::string> &keys) = 0;
+
+    /**
+     * @brief Reports the cache's current memory usage and limits.
+     *
+     * @return A snapshot of the memory accounting.
+     */
+    virtual CacheMemoryStats MemoryStats() = 0;
+
+    /**
+     * @brief Reports the bytes accounted to a single key.
+     *
+     * @param key The key to look up.
+     * @param bytes Receives the key's footprint if it exists.
+     * @return `true` if the key exists and has not expired, otherwise `false`.
+     */
+    virtual bool MemoryUsage(const std::string &key, size_t &bytes) = 0;
+
+    /**
+     * @brief Reports the usage of each size class of the cache's slab allocator.
+     *
+     * @return One entry per size class in use, by increasing chunk size.
+     */
+    virtual std::vector<SlabClassStats> SlabStats() = 0;
+
+    /**
+     * @brief Reports the most frequently accessed keys, as estimated from a sample of the reads and writes.
+     *
+     * @param count The most keys to return.
+     * @return The hottest keys by decreasing estimated access count; empty while tracking is disabled.
+     */
+    virtual std::vector<HotKey> HotKeys(size_t count) = 0;
+
+    /**
+     * @brief Enables, disables or changes the sampling of accesses for hot-key tracking, and forgets past counts.
+     *
+     * @param sample_rate Count one access in `sample_rate`; 1 counts every access and 0 disables tracking.
+     */
+    virtual void ConfigureHotKeys(uint32_t sample_rate) = 0;
+
+    /**
+     * @brief Reports the hot-key sample rate.
+     *
+     * @return One access in this many is counted, or 0 if tracking is disabled.
+     */
+    virtual uint32_t HotKeysSampleRate() = 0;
+
+    /**
+     * @brief Forgets the access counts gathered for hot-key tracking.
+     */
+    virtual void ResetHotKeys() = 0;
+
+    /**
+     * @brief Returns every key matching a glob-style pattern.
+     *
+     * @param pattern A glob-style pattern, or an empty string to return every key.
+     * @param keys Receives the matching keys.
+     */
+    virtual void Keys(const std::string &pattern, std::vector<std::string> &keys) = 0;
+
+    /**
+     * @brief Returns the keys in `[start, end)` in key order.
+     *
+     * @param start The smallest key to return.
+     * @param end The first key past the range, or an empty string for no upper bound.
+     * @param limit The most keys to return, or 0 for no limit.
+     * @param keys Receives the keys in the range.
+     */
+    virtual void Range(const std::string &start, const std::string &end, size_t limit, std::vector<std::string> &keys) = 0;
+
+    /**
+     * @brief Deletes every key starting with a prefix.
+     *
+     * @param prefix The prefix.
+     * @return The number of keys deleted.
+     */
+    virtual size_t DeletePrefix(const std::string &prefix) = 0;
 };
 
 #endif // ICACHE_H
\ No newline at end of file
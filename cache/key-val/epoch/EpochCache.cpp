@@ -0,0 +1,488 @@
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "EpochCache.h"
+#include "CacheItem.h"
+#include "LoggerManager.h"
+#include "FileLogger.h"
+
+EpochCache::Table::Table(size_t bucket_count)
+    : mask(bucket_count - 1), buckets(new std::atomic<Node *>[bucket_count])
+{
+    for (size_t i = 0; i < bucket_count; ++i)
+    {
+        buckets[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Constructs an EpochCache with the given limits.
+ *
+ * Sets up logging like `Cache` and starts the background thread that ticks the access clock and expires entries.
+ *
+ * @param max_size The maximum number of entries the cache can hold.
+ * @param max_memory The byte budget for keys, values and per-entry overhead. 0 disables it.
+ */
+EpochCache::EpochCache(size_t max_size, size_t max_memory)
+    : max_size_(max_size),
+      max_memory_(max_memory),
+      epochs_(EpochManager::Instance()),
+      table_(new Table(kInitialBuckets)),
+      // Versions continue from the wall clock, so that a version handed out before a restart is not reused
+      version_clock_(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                               std::chrono::system_clock::now().time_since_epoch())
+                                               .count())),
+      rng_(std::random_device()()),
+      stats_(ServerStats::Instance())
+{
+    // Initialize the file logger with a unique log file name based on the current thread ID
+    std::ostringstream oss;
+    oss << "cache_" << std::this_thread::get_id() << ".log";
+
+    file_logger_ = std::make_shared<FileLogger>(oss.str());
+    file_logger_->setLogLevel(ILogger::LogLevel::DEBUG);
+
+    // Register the file logger with the LoggerManager to handle logging
+    LoggerManager::getInstance().addLogger(file_logger_);
+
+    // Start the background thread for the access clock and expiry
+    cleanup_thread_ = std::thread(&EpochCache::Cleanup, this);
+}
+
+/**
+ * @brief Stops the cleanup thread and frees every entry.
+ *
+ * No reader can still be pinned on this cache's nodes, so the table is freed directly; the nodes retired earlier
+ * are freed by waiting for the epoch to move past them.
+ */
+EpochCache::~EpochCache()
+{
+    // Stop the cleanup thread before the members it uses go away
+    {
+        std::lock_guard<std::mutex> lock(cleanup_mutex_);
+        stopping_ = true;
+    }
+    cleanup_cv_.notify_all();
+    if (cleanup_thread_.joinable())
+    {
+        cleanup_thread_.join();
+    }
+
+    FreeTable(table_.load(std::memory_order_relaxed));
+    epochs_.Synchronize();
+
+    // Log the destruction of the cache
+    file_logger_->info("Cache destroyed");
+    std::cout << "Cache destroyed" << std::endl;
+}
+
+/**
+ * @brief Returns the bytes accounted to an entry: the node, the key and the value.
+ */
+size_t EpochCache::Footprint(size_t key_size, size_t value_size)
+{
+    return sizeof(Node) + key_size + value_size;
+}
+
+/**
+ * @brief Refuses entries that can never be stored.
+ *
+ * The key limit is the same as `Cache`'s, so that switching engines never changes which keys are accepted.
+ *
+ * @param key The key to be set.
+ * @param value The value to be set.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than the
+ *                           byte budget.
+ */
+void EpochCache::CheckEntry(const std::string &key, std::string_view value) const
+{
+    if (key.size() > CacheItem::kMaxKeySize)
+    {
+        throw std::length_error("key is longer than " + std::to_string(CacheItem::kMaxKeySize) + " bytes");
+    }
+
+    // An entry that cannot fit even in an empty cache is refused up front
+    if (max_memory_ != 0 && Footprint(key.size(), value.size()) > max_memory_)
+    {
+        throw std::length_error("OOM: value for key '" + key + "' is larger than maxmemory");
+    }
+}
+
+/**
+ * @brief Computes the expiration time of an entry set now with the given TTL.
+ *
+ * @param duration The TTL, or 0 for an entry that never expires.
+ * @return The expiration time, `time_point::max()` for a zero TTL.
+ */
+std::chrono::steady_clock::time_point EpochCache::ExpirationAfter(std::chrono::seconds duration)
+{
+    return duration.count() == 0 ? std::chrono::steady_clock::time_point::max()
+                                 : std::chrono::steady_clock::now() + duration;
+}
+
+/**
+ * @brief Wraps a value in a handle, moving it into a shared buffer only if it is large, as `Cache` does.
+ *
+ * @param value The value, moved from.
+ * @return The handle.
+ */
+CacheValue EpochCache::MakeValue(std::string value)
+{
+    if (value.size() >= CacheItem::kMinSharedValue)
+    {
+        return CacheValue(std::move(value));
+    }
+
+    CacheValue handle;
+    handle.local_ = std::move(value);
+    return handle;
+}
+
+/**
+ * @brief Finds the live node of a key. The caller holds an `EpochManager::Guard`.
+ *
+ * A hit stores the access clock into the node only when it has ticked since the node's last read, so a key read
+ * by every core does not bounce its cache line between them on every read.
+ *
+ * @param key The key to look up.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @return The node, valid until the guard goes away, or `nullptr`.
+ */
+const EpochCache::Node *EpochCache::FindLive(std::string_view key, size_t hash) const
+{
+    const Table *table = table_.load(std::memory_order_acquire);
+    const Node *node = table->buckets[hash & table->mask].load(std::memory_order_acquire);
+    for (; node != nullptr; node = node->next.load(std::memory_order_acquire))
+    {
+        if (node->hash == hash && node->key == key)
+        {
+            break;
+        }
+    }
+
+    if (node == nullptr || node->expiration <= std::chrono::steady_clock::now())
+    {
+        return nullptr;
+    }
+
+    uint32_t now = access_clock_.load(std::memory_order_relaxed);
+    if (node->last_access.load(std::memory_order_relaxed) != now)
+    {
+        node->last_access.store(now, std::memory_order_relaxed);
+    }
+    return node;
+}
+
+/**
+ * @brief Finds the link pointing at the node of a key, expired or not. The caller holds `write_mutex_`.
+ *
+ * @param key The key to look up.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @return The bucket head or `next` field holding the node, or `nullptr` if the key is absent.
+ */
+std::atomic<EpochCache::Node *> *EpochCache::FindLocked(std::string_view key, size_t hash) const
+{
+    Table *table = table_.load(std::memory_order_relaxed);
+    std::atomic<Node *> *link = &table->buckets[hash & table->mask];
+    for (Node *node = link->load(std::memory_order_relaxed); node != nullptr;
+         node = link->load(std::memory_order_relaxed))
+    {
+        if (node->hash == hash && node->key == key)
+        {
+            return link;
+        }
+        link = &node->next;
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Finds the live node of a key, unlinking it if it has expired. The caller holds `write_mutex_`.
+ *
+ * @param key The key to look up.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @return The node, or `nullptr`.
+ */
+EpochCache::Node *EpochCache::FindLiveLocked(std::string_view key, size_t hash)
+{
+    std::atomic<Node *> *link = FindLocked(key, hash);
+    if (link == nullptr)
+    {
+        return nullptr;
+    }
+
+    Node *node = link->load(std::memory_order_relaxed);
+    if (node->expiration <= std::chrono::steady_clock::now())
+    {
+        UnlinkLocked(link, node);
+        stats_.Add(Stat::kExpirations);
+        return nullptr;
+    }
+    return node;
+}
+
+/**
+ * @brief Inserts or replaces the entry of a key. The caller holds `write_mutex_` and has validated the entry.
+ *
+ * Room is made first, since evicting may unlink the node that precedes the key's. The new node is fully built
+ * before the release store that publishes it, so a reader either finds the old node or the complete new one.
+ *
+ * @param key The key to be set.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @param value The value.
+ * @param expiration The entry's expiration time.
+ * @return `true` if the key had no live entry. Either way the entry has a new version.
+ */
+bool EpochCache::SetLocked(const std::string &key,
+                           size_t hash,
+                           CacheValue value,
+                           std::chrono::steady_clock::time_point expiration)
+{
+    size_t footprint = Footprint(key.size(), value.Size());
+    Node *existing = FindLiveLocked(key, hash);
+    size_t freed = existing != nullptr ? Footprint(*existing) : 0;
+    EvictLocked(existing != nullptr ? 0 : 1, footprint > freed ? footprint - freed : 0, key);
+
+    Node *node = new Node(key, hash, std::move(value), expiration, ++version_clock_,
+                          access_clock_.load(std::memory_order_relaxed));
+
+    std::atomic<Node *> *link = FindLocked(key, hash);
+    if (link != nullptr)
+    {
+        Node *old = link->load(std::memory_order_relaxed);
+        node->next.store(old->next.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        link->store(node, std::memory_order_release);
+        used_memory_.fetch_add(footprint, std::memory_order_relaxed);
+        used_memory_.fetch_sub(Footprint(*old), std::memory_order_relaxed);
+        epochs_.Retire(old);
+        return false;
+    }
+
+    Table *table = table_.load(std::memory_order_relaxed);
+    std::atomic<Node *> &bucket = table->buckets[hash & table->mask];
+    node->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    bucket.store(node, std::memory_order_release);
+    used_memory_.fetch_add(footprint, std::memory_order_relaxed);
+    if (key_count_.fetch_add(1, std::memory_order_relaxed) + 1 > table->mask + 1)
+    {
+        GrowLocked();
+    }
+    return true;
+}
+
+/**
+ * @brief Removes the entry of a key if it exists. The caller holds `write_mutex_`.
+ *
+ * @param key The key to remove.
+ * @param hash `SwissIndex::Hash(key)`.
+ * @return `true` if the key had a live entry.
+ */
+bool EpochCache::DeleteLocked(std::string_view key, size_t hash)
+{
+    std::atomic<Node *> *link = FindLocked(key, hash);
+    if (link == nullptr)
+    {
+        return false;
+    }
+
+    Node *node = link->load(std::memory_order_relaxed);
+    bool live = node->expiration > std::chrono::steady_clock::now();
+    UnlinkLocked(link, node);
+    return live;
+}
+
+/**
+ * @brief Unlinks `node` from `link` and retires it. The caller holds `write_mutex_`.
+ *
+ * A reader standing on `node` still follows its unchanged `next` to the rest of the chain.
+ */
+void EpochCache::UnlinkLocked(std::atomic<Node *> *link, Node *node)
+{
+    link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+    key_count_.fetch_sub(1, std::memory_order_relaxed);
+    used_memory_.fetch_sub(Footprint(*node), std::memory_order_relaxed);
+    epochs_.Retire(node);
+}
+
+/**
+ * @brief Evicts sampled entries until `new_keys` more entries and `new_bytes` more bytes fit. The caller holds
+ *        `write_mutex_`.
+ *
+ * Each victim is the least recently read of `kEvictionSamples` nodes taken from consecutive buckets starting at a
+ * random one; the first expired node met is taken immediately.
+ *
+ * @param new_keys The entries about to be added.
+ * @param new_bytes The bytes about to be added.
+ * @param keep A key that is not evicted, as it is about to be written.
+ */
+void EpochCache::EvictLocked(size_t new_keys, size_t new_bytes, std::string_view keep)
+{
+    auto now = std::chrono::steady_clock::now();
+    while (key_count_.load(std::memory_order_relaxed) + new_keys > max_size_ ||
+           (max_memory_ != 0 && used_memory_.load(std::memory_order_relaxed) + new_bytes > max_memory_))
+    {
+        Table *table = table_.load(std::memory_order_relaxed);
+        size_t start = static_cast<size_t>(rng_()) & table->mask;
+
+        std::atomic<Node *> *victim_link = nullptr;
+        Node *victim = nullptr;
+        size_t sampled = 0;
+        for (size_t i = 0; i <= table->mask && sampled < kEvictionSamples; ++i)
+        {
+            std::atomic<Node *> *link = &table->buckets[(start + i) & table->mask];
+            for (Node *node = link->load(std::memory_order_relaxed); node != nullptr;
+                 link = &node->next, node = link->load(std::memory_order_relaxed))
+            {
+                if (node->key == keep)
+                {
+                    continue;
+                }
+                if (node->expiration <= now)
+                {
+                    victim_link = link;
+                    victim = node;
+                    sampled = kEvictionSamples;
+                    break;
+                }
+                // The access clock wraps, so compare ages rather than raw stamps
+                uint32_t clock = access_clock_.load(std::memory_order_relaxed);
+                if (victim == nullptr || clock - node->last_access.load(std::memory_order_relaxed) >
+                                             clock - victim->last_access.load(std::memory_order_relaxed))
+                {
+                    victim_link = link;
+                    victim = node;
+                }
+                if (++sampled == kEvictionSamples)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (victim == nullptr)
+        {
+            // Only `keep` is left
+            return;
+        }
+
+        std::string victim_key = victim->key;
+        UnlinkLocked(victim_link, victim);
+        stats_.Add(Stat::kEvictions);
+
+        // Log a message indicating the key has been evicted
+        file_logger_->info("Evicted item (sampled): '" + victim_key + "'");
+        std::cout << "Evicted item (sampled): '" << victim_key << "'" << std::endl;
+    }
+}
+
+/**
+ * @brief Doubles the bucket count once the table holds more entries than buckets. The caller holds `write_mutex_`.
+ *
+ * Moving a node would relink it into another chain while readers of the old table may be following it, so every
+ * node is copied instead; values are shared, not copied, when they are large. The old table and its nodes are
+ * retired together once the new one is published.
+ */
+void EpochCache::GrowLocked()
+{
+    Table *old = table_.load(std::memory_order_relaxed);
+    Table *table = new Table((old->mask + 1) * 2);
+
+    for (size_t i = 0; i <= old->mask; ++i)
+    {
+        for (Node *node = old->buckets[i].load(std::memory_order_relaxed); node != nullptr;
+             node = node->next.load(std::memory_order_relaxed))
+        {
+            Node *copy = new Node(node->key, node->hash, node->value, node->expiration, node->version,
+                                  node->last_access.load(std::memory_order_relaxed));
+            std::atomic<Node *> &bucket = table->buckets[node->hash & table->mask];
+            copy->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            bucket.store(copy, std::memory_order_relaxed);
+        }
+    }
+
+    table_.store(table, std::memory_order_release);
+    epochs_.Retire(old, &EpochCache::FreeTable);
+}
+
+/**
+ * @brief Frees a table that no reader can reach, with every node of its chains.
+ */
+void EpochCache::FreeTable(void *pointer)
+{
+    Table *table = static_cast<Table *>(pointer);
+    for (size_t i = 0; i <= table->mask; ++i)
+    {
+        Node *node = table->buckets[i].load(std::memory_order_relaxed);
+        while (node != nullptr)
+        {
+            Node *next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+    delete table;
+}
+
+/**
+ * @brief Ticks the access clock and removes expired entries until the cache is destroyed.
+ *
+ * Every `kCleanupInterval`, the thread walks the buckets from where it stopped last time, `kSweepBuckets` per writer
+ * lock acquisition, and keeps going while the previous batch found expired entries, up to one pass over the table.
+ * Reads never return expired entries, so the sweep only bounds how long they take up memory.
+ */
+void EpochCache::Cleanup()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> wait_lock(cleanup_mutex_);
+            if (cleanup_cv_.wait_for(wait_lock, kCleanupInterval, [this] { return stopping_; }))
+            {
+                return;
+            }
+        }
+
+        access_clock_.fetch_add(1, std::memory_order_relaxed);
+
+        size_t removed = 0;
+        size_t expired = 0;
+        size_t swept = 0;
+        do
+        {
+            // Lock the mutex to ensure thread-safety while modifying cache data
+            std::lock_guard<TimedMutex> lock(write_mutex_);
+
+            Table *table = table_.load(std::memory_order_relaxed);
+            auto now = std::chrono::steady_clock::now();
+            expired = 0;
+            for (size_t i = 0; i < kSweepBuckets; ++i, ++swept)
+            {
+                std::atomic<Node *> *link = &table->buckets[sweep_cursor_++ & table->mask];
+                for (Node *node = link->load(std::memory_order_relaxed); node != nullptr;
+                     node = link->load(std::memory_order_relaxed))
+                {
+                    if (node->expiration <= now)
+                    {
+                        UnlinkLocked(link, node);
+                        ++expired;
+                    }
+                    else
+                    {
+                        link = &node->next;
+                    }
+                }
+            }
+            removed += expired;
+        } while (expired > 0 && swept <= table_.load(std::memory_order_relaxed)->mask);
+
+        // Log the removal of expired items
+        if (removed > 0)
+        {
+            stats_.Add(Stat::kExpirations, removed);
+            file_logger_->info("Expired " + std::to_string(removed) + " item(s) removed from cache");
+            std::cout << "Expired " << removed << " item(s) removed from cache" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,379 @@
+#ifndef EPOCH_CACHE_H
+#define EPOCH_CACHE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "ICache.h"
+#include "EpochManager.h"
+#include "HotKeyTracker.h"
+#include "ServerStats.h"
+#include "TimedMutex.h"
+#include "LoggerManager.h"
+#include "FileLogger.h"
+
+/**
+ * @class EpochCache
+ * @brief A cache whose reads never take a lock: lookups walk the index while writers replace entries under them.
+ *
+ * The index is a chained hash table. An entry is an immutable node; a writer never modifies a node a reader may be
+ * looking at, but links a new node in its place with a release store and retires the old one through the
+ * `EpochManager`, which frees it once every reader that could have seen it has finished. A read pins the current
+ * epoch, hashes, follows one chain and copies the value, so readers only share the cache lines of the nodes they
+ * visit and scale with the number of cores.
+ *
+ * Writers are serialized by one mutex. When the table grows, the writer copies the nodes into a table twice the
+ * size, publishes it and retires the old table as a whole, so readers never see a half-moved chain.
+ *
+ * There is no eviction policy to notify on every hit. Each node carries the coarse time of its last read, which a
+ * read rewrites at most once per `kCleanupInterval`; a writer making room samples `kEvictionSamples` nodes and evicts
+ * the least recently read one, preferring an expired node. A background thread expires entries a few buckets at a
+ * time. There is no slab allocator, ordered index or disk tier: `SlabStats` is empty and `Range` and `DeletePrefix`
+ * are refused.
+ */
+class EpochCache : public ICache
+{
+public:
+    static constexpr size_t kInitialBuckets = 64;  ///< The bucket count of an empty table; a power of two.
+    static constexpr size_t kEvictionSamples = 5;  ///< Nodes compared to choose each eviction victim.
+    static constexpr size_t kSweepBuckets = 256;   ///< Buckets the cleanup thread checks per lock acquisition.
+    static constexpr std::chrono::milliseconds kCleanupInterval{100}; ///< The cleanup period and access clock tick.
+
+    /**
+     * @brief Constructs an EpochCache with the given limits.
+     *
+     * @param max_size The maximum number of entries the cache can hold.
+     * @param max_memory The byte budget for keys, values and per-entry overhead. 0 (the default) disables it.
+     */
+    explicit EpochCache(size_t max_size = 1000, size_t max_memory = 0);
+
+    /**
+     * @brief Stops the cleanup thread and frees every entry. No other thread may still use the cache.
+     */
+    ~EpochCache() override;
+
+    /**
+     * @brief Stores a key-value pair, replacing the key's entry if it exists.
+     *
+     * @param key The key.
+     * @param value The value.
+     * @param duration The time-to-live; 0 means the pair never expires.
+     * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than
+     *                           the byte budget.
+     */
+    void Set(const std::string &key, const std::string &value, std::chrono::seconds duration) override;
+
+    /**
+     * @brief Stores a key-value pair, moving a large value into a shared buffer instead of copying it.
+     */
+    void Set(const std::string &key, std::string &&value, std::chrono::seconds duration) override;
+
+    /**
+     * @brief Stores a key-value pair, sharing the handle's buffer if the value is large.
+     */
+    void Set(const std::string &key, const CacheValue &value, std::chrono::seconds duration) override;
+
+    /**
+     * @brief Copies the value of a key without taking any lock.
+     *
+     * @param key The key to look up.
+     * @param value Receives the value if found.
+     * @return `true` if the key exists and has not expired.
+     */
+    bool Get(const std::string &key, std::string &value) override;
+
+    /**
+     * @brief Returns a handle to the value of a key without taking any lock.
+     *
+     * @param key The key to look up.
+     * @param value Receives a handle to the value if found.
+     * @return `true` if the key exists and has not expired.
+     */
+    bool Get(const std::string &key, CacheValue &value) override;
+
+    /**
+     * @brief Deletes a key if it exists.
+     */
+    void Delete(const std::string &key) override;
+
+    /**
+     * @brief Adds to the integer value of a key, creating it from 0 if it does not exist.
+     *
+     * @throws std::invalid_argument If the value is not an integer.
+     * @throws std::out_of_range If the result would overflow.
+     */
+    int64_t IncrBy(const std::string &key, int64_t delta) override;
+
+    /**
+     * @brief Adds to the floating-point value of a key, creating it from 0 if it does not exist.
+     *
+     * @throws std::invalid_argument If the value is not a number or the result is not finite.
+     */
+    std::string IncrByFloat(const std::string &key, double delta) override;
+
+    /**
+     * @brief Appends to the value of a key, creating it if it does not exist.
+     *
+     * @throws std::length_error If the entry would be larger than the byte budget.
+     */
+    size_t Append(const std::string &key, const std::string &suffix) override;
+
+    /**
+     * @brief Replaces the value of a key, returning the previous one.
+     */
+    bool GetSet(const std::string &key, const std::string &value, std::string &old_value) override;
+
+    /**
+     * @brief Returns a handle to the value of a key and the entry's version without taking any lock.
+     */
+    bool GetVersioned(const std::string &key, CacheValue &value, uint64_t &version) override;
+
+    /**
+     * @brief Stores a value only if the entry still has the expected version.
+     */
+    CasResult CompareAndSet(const std::string &key,
+                            const std::string &value,
+                            uint64_t version,
+                            std::chrono::seconds duration,
+                            uint64_t &new_version) override;
+
+    /**
+     * @brief Copies the values of several keys, all read in one pinned traversal.
+     */
+    size_t MGet(const std::vector<std::string> &keys,
+                std::vector<std::string> &values,
+                std::vector<bool> &found) override;
+
+    /**
+     * @brief Stores several key-value pairs under one writer lock acquisition.
+     */
+    void MSet(const std::vector<CacheSetRequest> &entries) override;
+
+    /**
+     * @brief Deletes several keys under one writer lock acquisition.
+     */
+    size_t MDelete(const std::vector<std::string> &keys, std::vector<bool> &deleted) override;
+
+    /**
+     * @brief Iterates over the keys a few buckets at a time with a stateless cursor.
+     */
+    size_t Scan(size_t cursor, const std::string &pattern, size_t count, std::vector<std::string> &keys) override;
+
+    /**
+     * @brief Reports the bytes accounted to the entries and the limits.
+     */
+    CacheMemoryStats MemoryStats() override;
+
+    /**
+     * @brief Reports the bytes accounted to a single key.
+     */
+    bool MemoryUsage(const std::string &key, size_t &bytes) override;
+
+    /**
+     * @brief Returns no size classes; entries are allocated from the global heap.
+     */
+    std::vector<SlabClassStats> SlabStats() override;
+
+    /**
+     * @brief Reports the most frequently accessed keys, as estimated from a sample of the reads and writes.
+     */
+    std::vector<HotKey> HotKeys(size_t count) override;
+
+    /**
+     * @brief Enables, disables or changes the sampling of accesses for hot-key tracking.
+     */
+    void ConfigureHotKeys(uint32_t sample_rate) override;
+
+    /**
+     * @brief Reports the hot-key sample rate, 0 if tracking is disabled.
+     */
+    uint32_t HotKeysSampleRate() override;
+
+    /**
+     * @brief Forgets the access counts gathered for hot-key tracking.
+     */
+    void ResetHotKeys() override;
+
+    /**
+     * @brief Returns every key matching a glob-style pattern, visiting every key.
+     */
+    void Keys(const std::string &pattern, std::vector<std::string> &keys) override;
+
+    /**
+     * @brief Refused: the cache keeps no ordered index.
+     *
+     * @throws std::logic_error Always.
+     */
+    void Range(const std::string &start, const std::string &end, size_t limit, std::vector<std::string> &keys) override;
+
+    /**
+     * @brief Refused: the cache keeps no ordered index.
+     *
+     * @throws std::logic_error Always.
+     */
+    size_t DeletePrefix(const std::string &prefix) override;
+
+private:
+    /**
+     * @brief One entry. Only `next` and `last_access` change after the node is published.
+     */
+    struct Node
+    {
+        std::atomic<Node *> next{nullptr};                ///< The next node of the bucket's chain.
+        mutable std::atomic<uint32_t> last_access;        ///< The access clock at the last read.
+        const size_t hash;                                ///< `SwissIndex::Hash(key)`.
+        const std::chrono::steady_clock::time_point expiration; ///< When the entry expires.
+        const uint64_t version;                           ///< The entry's version, see `ICache::GetVersioned`.
+        const std::string key;                            ///< The key.
+        const CacheValue value;                           ///< The value.
+
+        Node(std::string_view key,
+             size_t hash,
+             CacheValue value,
+             std::chrono::steady_clock::time_point expiration,
+             uint64_t version,
+             uint32_t last_access)
+            : last_access(last_access), hash(hash), expiration(expiration), version(version), key(key),
+              value(std::move(value))
+        {
+        }
+    };
+
+    /**
+     * @brief A power-of-two array of bucket chains.
+     */
+    struct Table
+    {
+        const size_t mask;                                ///< The bucket count minus one.
+        std::unique_ptr<std::atomic<Node *>[]> buckets;   ///< The chains' first nodes.
+
+        explicit Table(size_t bucket_count);
+    };
+
+    const size_t max_size_;   ///< The maximum number of entries.
+    const size_t max_memory_; ///< The byte budget, or 0.
+
+    EpochManager &epochs_;             ///< Reclaims the nodes and tables writers unlink.
+    std::atomic<Table *> table_;       ///< The current table; replaced only by writers.
+    TimedMutex write_mutex_;           ///< Serializes writers.
+    std::atomic<size_t> key_count_{0};   ///< Entries in the table, expired or not.
+    std::atomic<size_t> used_memory_{0}; ///< `Footprint` summed over the entries.
+    std::atomic<uint32_t> access_clock_{0}; ///< Ticks once per `kCleanupInterval`.
+    uint64_t version_clock_;           ///< The last version handed out. Guarded by `write_mutex_`.
+    std::mt19937_64 rng_;              ///< Picks eviction samples. Guarded by `write_mutex_`.
+    size_t sweep_cursor_ = 0;          ///< The next bucket the cleanup thread checks. Guarded by `write_mutex_`.
+
+    HotKeyTracker hot_keys_; ///< Sampled access counts behind `HotKeys`.
+    ServerStats &stats_;     ///< The process-wide counters INFO reports.
+
+    std::thread cleanup_thread_;
+    std::mutex cleanup_mutex_;
+    std::condition_variable cleanup_cv_;
+    bool stopping_ = false;
+
+    std::shared_ptr<FileLogger> file_logger_;
+
+    /**
+     * @brief Returns the bytes accounted to an entry.
+     */
+    static size_t Footprint(size_t key_size, size_t value_size);
+
+    /**
+     * @brief Returns the bytes accounted to a node.
+     */
+    static size_t Footprint(const Node &node) { return Footprint(node.key.size(), node.value.Size()); }
+
+    /**
+     * @brief Refuses entries that can never be stored.
+     *
+     * @throws std::length_error If the key is too long or the entry alone is larger than the byte budget.
+     */
+    void CheckEntry(const std::string &key, std::string_view value) const;
+
+    /**
+     * @brief Computes the expiration time of an entry set now with the given TTL.
+     */
+    static std::chrono::steady_clock::time_point ExpirationAfter(std::chrono::seconds duration);
+
+    /**
+     * @brief Wraps a value in a handle, in a shared buffer only if it is at least `CacheItem::kMinSharedValue` bytes.
+     */
+    static CacheValue MakeValue(std::string value);
+
+    /**
+     * @brief Finds the live node of a key. The caller holds an `EpochManager::Guard`.
+     *
+     * Records the read in the node's `last_access`.
+     *
+     * @return The node, valid until the guard goes away, or `nullptr`.
+     */
+    const Node *FindLive(std::string_view key, size_t hash) const;
+
+    /**
+     * @brief Finds the link pointing at the node of a key, expired or not. The caller holds `write_mutex_`.
+     *
+     * @return The bucket head or `next` field holding the node, or `nullptr` if the key is absent.
+     */
+    std::atomic<Node *> *FindLocked(std::string_view key, size_t hash) const;
+
+    /**
+     * @brief Finds the live node of a key, unlinking it if it has expired. The caller holds `write_mutex_`.
+     */
+    Node *FindLiveLocked(std::string_view key, size_t hash);
+
+    /**
+     * @brief Inserts or replaces the entry of a key with a new version. The caller holds `write_mutex_` and has
+     *        validated the entry.
+     *
+     * @return `true` if the key had no live entry.
+     */
+    bool SetLocked(const std::string &key,
+                   size_t hash,
+                   CacheValue value,
+                   std::chrono::steady_clock::time_point expiration);
+
+    /**
+     * @brief Removes the entry of a key if it exists. The caller holds `write_mutex_`.
+     *
+     * @return `true` if the key had a live entry.
+     */
+    bool DeleteLocked(std::string_view key, size_t hash);
+
+    /**
+     * @brief Unlinks `node` from `link` and retires it. The caller holds `write_mutex_`.
+     */
+    void UnlinkLocked(std::atomic<Node *> *link, Node *node);
+
+    /**
+     * @brief Evicts sampled entries until `new_keys` more entries and `new_bytes` more bytes fit. The caller holds
+     *        `write_mutex_`.
+     *
+     * @param keep A key that is not evicted, as it is about to be written.
+     */
+    void EvictLocked(size_t new_keys, size_t new_bytes, std::string_view keep);
+
+    /**
+     * @brief Doubles the bucket count once the table holds more entries than buckets. The caller holds
+     *        `write_mutex_`.
+     */
+    void GrowLocked();
+
+    /**
+     * @brief Frees a table that no reader can reach, with every node of its chains.
+     */
+    static void FreeTable(void *table);
+
+    /**
+     * @brief Ticks the access clock and removes expired entries until the cache is destroyed.
+     */
+    void Cleanup();
+};
+
+#endif // EPOCH_CACHE_H
@@ -0,0 +1,116 @@
+#include "EpochCache.h"
+#include <iostream>
+#include <stdexcept>
+
+#include "GlobMatch.h"
+#include "ScanCursor.h"
+
+/**
+ * @brief Iterates over the keys a few buckets at a time with a stateless cursor.
+ *
+ * The cursor is a bucket index advanced by `NextReverseCursor`, as in `SwissIndex::Scan`, and the table only ever
+ * doubles, so a scan that spans a resize still visits every key that exists throughout, possibly twice. The walk
+ * runs pinned rather than locked.
+ *
+ * @param cursor 0 to start a scan, or the value returned by the previous call.
+ * @param pattern A glob-style pattern (see `GlobMatch`), or an empty string to return every key.
+ * @param count A hint for how many keys to examine per call; at least 1.
+ * @param keys Receives the matching keys of this call.
+ * @return The cursor to pass to the next call, or 0 once the scan is complete.
+ */
+size_t EpochCache::Scan(size_t cursor, const std::string &pattern, size_t count, std::vector<std::string> &keys)
+{
+    count = count == 0 ? 1 : count;
+    const size_t max_steps = count * 10;
+
+    std::vector<std::string> candidates;
+    auto now = std::chrono::steady_clock::now();
+    {
+        EpochManager::Guard guard(epochs_);
+        const Table *table = table_.load(std::memory_order_acquire);
+
+        size_t steps = 0;
+        do
+        {
+            const Node *node = table->buckets[cursor & table->mask].load(std::memory_order_acquire);
+            for (; node != nullptr; node = node->next.load(std::memory_order_acquire))
+            {
+                if (node->expiration > now)
+                {
+                    candidates.push_back(node->key);
+                }
+            }
+
+            cursor = NextReverseCursor(cursor, table->mask);
+        } while (cursor != 0 && candidates.size() < count && ++steps < max_steps);
+    }
+
+    // Match the pattern outside the traversal
+    keys.clear();
+    for (auto &key : candidates)
+    {
+        if (pattern.empty() || GlobMatch(pattern, key))
+        {
+            keys.push_back(std::move(key));
+        }
+    }
+
+    // Log a message with the progress of the scan
+    file_logger_->info("SCAN: " + std::to_string(keys.size()) + " keys, next cursor " + std::to_string(cursor));
+    std::cout << "SCAN: " << keys.size() << " keys, next cursor " << cursor << std::endl;
+    return cursor;
+}
+
+/**
+ * @brief Returns every key matching a glob-style pattern, visiting every key.
+ *
+ * The walk runs pinned to one table, so it neither blocks writers nor is disturbed by a resize.
+ *
+ * @param pattern A glob-style pattern (see `GlobMatch`), or an empty string to return every key.
+ * @param keys Receives the matching keys.
+ */
+void EpochCache::Keys(const std::string &pattern, std::vector<std::string> &keys)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    keys.clear();
+    {
+        EpochManager::Guard guard(epochs_);
+        const Table *table = table_.load(std::memory_order_acquire);
+        for (size_t i = 0; i <= table->mask; ++i)
+        {
+            const Node *node = table->buckets[i].load(std::memory_order_acquire);
+            for (; node != nullptr; node = node->next.load(std::memory_order_acquire))
+            {
+                if (node->expiration > now && (pattern.empty() || GlobMatch(pattern, node->key)))
+                {
+                    keys.push_back(node->key);
+                }
+            }
+        }
+    }
+
+    // Log a message with the number of matching keys
+    file_logger_->info("KEYS '" + pattern + "': " + std::to_string(keys.size()) + " keys");
+    std::cout << "KEYS '" << pattern << "': " << keys.size() << " keys" << std::endl;
+}
+
+/**
+ * @brief Refused: the cache keeps no ordered index.
+ *
+ * @throws std::logic_error Always.
+ */
+void EpochCache::Range(const std::string &, const std::string &, size_t, std::vector<std::string> &)
+{
+    throw std::logic_error("the epoch engine has no ordered index");
+}
+
+/**
+ * @brief Refused: the cache keeps no ordered index.
+ *
+ * @throws std::logic_error Always.
+ */
+size_t EpochCache::DeletePrefix(const std::string &)
+{
+    throw std::logic_error("the epoch engine has no ordered index");
+}
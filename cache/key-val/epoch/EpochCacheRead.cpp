@@ -0,0 +1,146 @@
+#include "EpochCache.h"
+#include "SwissIndex.h"
+#include <iostream>
+
+/**
+ * @brief Copies the value of a key without taking any lock.
+ *
+ * The lookup pins the epoch, so the node it finds stays allocated while its value is copied even if a writer
+ * replaces or deletes the key meanwhile; the copy is then of the value the key had when the lookup found it.
+ *
+ * @param key The key to look up.
+ * @param value Receives the value if found.
+ * @return `true` if the key exists and has not expired.
+ */
+bool EpochCache::Get(const std::string &key, std::string &value)
+{
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    {
+        EpochManager::Guard guard(epochs_);
+        const Node *node = FindLive(key, hash);
+        if (node == nullptr)
+        {
+            stats_.Add(Stat::kKeyspaceMisses);
+            return false;
+        }
+        value.assign(node->value.View());
+    }
+    stats_.Add(Stat::kKeyspaceHits);
+
+    // Log a message indicating the key has been found
+    file_logger_->info("GET key '" + key + "': found");
+    std::cout << "GET key '" << key << "': found" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Returns a handle to the value of a key without taking any lock.
+ *
+ * A large value is shared: the handle takes a reference to the node's buffer, which outlives the node.
+ *
+ * @param key The key to look up.
+ * @param value Receives a handle to the value if found.
+ * @return `true` if the key exists and has not expired.
+ */
+bool EpochCache::Get(const std::string &key, CacheValue &value)
+{
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    {
+        EpochManager::Guard guard(epochs_);
+        const Node *node = FindLive(key, hash);
+        if (node == nullptr)
+        {
+            stats_.Add(Stat::kKeyspaceMisses);
+            return false;
+        }
+        value = node->value;
+    }
+    stats_.Add(Stat::kKeyspaceHits);
+
+    // Log a message indicating the key has been found
+    file_logger_->info("GET key '" + key + "': found");
+    std::cout << "GET key '" << key << "': found" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Returns a handle to the value of a key and the entry's version without taking any lock.
+ *
+ * Nodes are immutable, so the value and the version always belong to the same write.
+ *
+ * @param key The key to look up.
+ * @param value Receives a handle to the value if found.
+ * @param version Receives the entry's version if found.
+ * @return `true` if the key exists and has not expired.
+ */
+bool EpochCache::GetVersioned(const std::string &key, CacheValue &value, uint64_t &version)
+{
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    {
+        EpochManager::Guard guard(epochs_);
+        const Node *node = FindLive(key, hash);
+        if (node == nullptr)
+        {
+            stats_.Add(Stat::kKeyspaceMisses);
+            return false;
+        }
+        value = node->value;
+        version = node->version;
+    }
+    stats_.Add(Stat::kKeyspaceHits);
+
+    // Log a message indicating the key has been found
+    file_logger_->info("GETV key '" + key + "': found");
+    std::cout << "GETV key '" << key << "': found" << std::endl;
+    return true;
+}
+
+/**
+ * @brief Copies the values of several keys, all read in one pinned traversal.
+ *
+ * Each key is read atomically, but writers are not held off, so the batch as a whole is not a snapshot.
+ *
+ * @param keys The keys to look up.
+ * @param values Receives one value per key, empty for keys that were not found.
+ * @param found Receives, for each key, whether it exists and has not expired.
+ * @return The number of keys found.
+ */
+size_t EpochCache::MGet(const std::vector<std::string> &keys,
+                        std::vector<std::string> &values,
+                        std::vector<bool> &found)
+{
+    values.assign(keys.size(), std::string());
+    found.assign(keys.size(), false);
+    size_t hits = 0;
+
+    {
+        EpochManager::Guard guard(epochs_);
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            size_t hash = SwissIndex::Hash(keys[i]);
+            hot_keys_.Record(keys[i], hash);
+
+            const Node *node = FindLive(keys[i], hash);
+            if (node != nullptr)
+            {
+                values[i].assign(node->value.View());
+                found[i] = true;
+                ++hits;
+            }
+        }
+    }
+
+    stats_.Add(Stat::kKeyspaceHits, hits);
+    stats_.Add(Stat::kKeyspaceMisses, keys.size() - hits);
+
+    // Log one line for the whole batch
+    file_logger_->info("MGET " + std::to_string(keys.size()) + " keys: " + std::to_string(hits) + " found");
+    std::cout << "MGET " << keys.size() << " keys: " << hits << " found" << std::endl;
+    return hits;
+}
@@ -0,0 +1,94 @@
+#include "EpochCache.h"
+#include "SwissIndex.h"
+#include <iostream>
+
+/**
+ * @brief Reports the bytes accounted to the entries and the limits.
+ *
+ * The allocated memory adds the bucket array to the entries; nodes retired but not yet freed are not counted.
+ *
+ * @return A snapshot of the memory accounting.
+ */
+CacheMemoryStats EpochCache::MemoryStats()
+{
+    CacheMemoryStats stats;
+    stats.used_memory = used_memory_.load(std::memory_order_relaxed);
+    stats.max_memory = max_memory_;
+    stats.keys = key_count_.load(std::memory_order_relaxed);
+    stats.max_keys = max_size_;
+
+    EpochManager::Guard guard(epochs_);
+    const Table *table = table_.load(std::memory_order_acquire);
+    stats.allocated_memory = stats.used_memory + (table->mask + 1) * sizeof(std::atomic<Node *>);
+    return stats;
+}
+
+/**
+ * @brief Reports the bytes accounted to a single key.
+ *
+ * @param key The key to look up.
+ * @param bytes Receives the key's footprint if it exists.
+ * @return `true` if the key exists and has not expired.
+ */
+bool EpochCache::MemoryUsage(const std::string &key, size_t &bytes)
+{
+    EpochManager::Guard guard(epochs_);
+    const Node *node = FindLive(key, SwissIndex::Hash(key));
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    bytes = Footprint(*node);
+    return true;
+}
+
+/**
+ * @brief Returns no size classes; nodes are allocated from the global heap.
+ */
+std::vector<SlabClassStats> EpochCache::SlabStats()
+{
+    return {};
+}
+
+/**
+ * @brief Reports the most frequently accessed keys, as estimated from a sample of the reads and writes.
+ *
+ * @param count The most keys to return.
+ * @return The hottest keys by decreasing estimated access count; empty while tracking is disabled.
+ */
+std::vector<HotKey> EpochCache::HotKeys(size_t count)
+{
+    return hot_keys_.Top(count);
+}
+
+/**
+ * @brief Enables, disables or changes the sampling of accesses for hot-key tracking, and forgets past counts.
+ *
+ * @param sample_rate Count one access in `sample_rate`; 1 counts every access and 0 disables tracking.
+ */
+void EpochCache::ConfigureHotKeys(uint32_t sample_rate)
+{
+    hot_keys_.SetSampleRate(sample_rate);
+
+    file_logger_->info("HOTKEYS: sample rate set to " + std::to_string(sample_rate));
+    std::cout << "HOTKEYS: sample rate set to " << sample_rate << std::endl;
+}
+
+/**
+ * @brief Reports the hot-key sample rate.
+ *
+ * @return One access in this many is counted, or 0 if tracking is disabled.
+ */
+uint32_t EpochCache::HotKeysSampleRate()
+{
+    return hot_keys_.SampleRate();
+}
+
+/**
+ * @brief Forgets the access counts gathered for hot-key tracking.
+ */
+void EpochCache::ResetHotKeys()
+{
+    hot_keys_.Reset();
+}
@@ -0,0 +1,424 @@
+#include "EpochCache.h"
+#include "CacheItem.h"
+#include "SwissIndex.h"
+#include <charconv>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+/**
+ * @brief Stores a key-value pair, replacing the key's entry if it exists.
+ *
+ * The entry is validated and hashed before the writer lock is taken; under it, the writer evicts if needed and
+ * publishes the new node. Readers are never blocked.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @param duration The time-to-live; 0 means the pair never expires.
+ * @throws std::length_error If the key is longer than `CacheItem::kMaxKeySize` or the entry alone is larger than the
+ *                           byte budget.
+ */
+void EpochCache::Set(const std::string &key, const std::string &value, std::chrono::seconds duration)
+{
+    Set(key, MakeValue(value), duration);
+}
+
+/**
+ * @brief Stores a key-value pair, moving a large value into a shared buffer instead of copying it.
+ *
+ * @param key The key.
+ * @param value The value, moved from.
+ * @param duration The time-to-live; 0 means the pair never expires.
+ * @throws std::length_error If the key is too long or the entry alone is larger than the byte budget.
+ */
+void EpochCache::Set(const std::string &key, std::string &&value, std::chrono::seconds duration)
+{
+    Set(key, MakeValue(std::move(value)), duration);
+}
+
+/**
+ * @brief Stores a key-value pair, sharing the handle's buffer if the value is large.
+ *
+ * @param key The key.
+ * @param value A handle to the value.
+ * @param duration The time-to-live; 0 means the pair never expires.
+ * @throws std::length_error If the key is too long or the entry alone is larger than the byte budget.
+ */
+void EpochCache::Set(const std::string &key, const CacheValue &value, std::chrono::seconds duration)
+{
+    CheckEntry(key, value.View());
+    auto expiration = ExpirationAfter(duration);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    bool inserted;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+        inserted = SetLocked(key, hash, value, expiration);
+    }
+    stats_.Add(Stat::kSets);
+
+    if (inserted)
+    {
+        // Log a message indicating the key has been set
+        file_logger_->info("Key '" + key + "' is SET");
+        std::cout << "Key '" << key << "' is SET" << std::endl;
+    }
+}
+
+/**
+ * @brief Deletes a key if it exists.
+ *
+ * @param key The key to delete.
+ */
+void EpochCache::Delete(const std::string &key)
+{
+    size_t hash = SwissIndex::Hash(key);
+
+    bool deleted;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+        deleted = DeleteLocked(key, hash);
+    }
+
+    if (deleted)
+    {
+        // Log a message indicating successful deletion
+        file_logger_->info("DELETE key '" + key + "': succeeded");
+        std::cout << "DELETE key '" << key << "': succeeded" << std::endl;
+    }
+    else
+    {
+        // Log a message indicating the key was not found
+        file_logger_->info("DELETE key '" + key + "': failed");
+        std::cout << "DELETE key: '" << key << "': failed" << std::endl;
+    }
+}
+
+/**
+ * @brief Adds to the integer value of a key, creating it from 0 if it does not exist.
+ *
+ * The read of the current value and the write of the sum happen under the writer lock, so concurrent increments
+ * are never lost.
+ *
+ * @param key The key.
+ * @param delta The amount to add.
+ * @return The new value.
+ * @throws std::invalid_argument If the value is not an integer.
+ * @throws std::out_of_range If the result would overflow.
+ */
+int64_t EpochCache::IncrBy(const std::string &key, int64_t delta)
+{
+    CheckEntry(key, std::string());
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    int64_t result;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+
+        Node *node = FindLiveLocked(key, hash);
+        int64_t current = 0;
+        if (node != nullptr && !CacheItem::ParseInt(node->value.View(), current))
+        {
+            throw std::invalid_argument("value of key '" + key + "' is not an integer");
+        }
+        if (__builtin_add_overflow(current, delta, &result))
+        {
+            throw std::out_of_range("increment of key '" + key + "' would overflow");
+        }
+
+        auto expiration = node != nullptr ? node->expiration : std::chrono::steady_clock::time_point::max();
+        SetLocked(key, hash, MakeValue(std::to_string(result)), expiration);
+    }
+
+    // Log a message indicating the new value
+    file_logger_->info("INCRBY key '" + key + "': " + std::to_string(result));
+    std::cout << "INCRBY key '" << key << "': " << result << std::endl;
+    return result;
+}
+
+/**
+ * @brief Adds to the floating-point value of a key, creating it from 0 if it does not exist.
+ *
+ * @param key The key.
+ * @param delta The amount to add.
+ * @return The new value, formatted as it is stored.
+ * @throws std::invalid_argument If the value is not a number or the result is not finite.
+ */
+std::string EpochCache::IncrByFloat(const std::string &key, double delta)
+{
+    CheckEntry(key, std::string());
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    // Large enough for any finite double in fixed-point notation
+    char digits[512];
+    std::string result;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+
+        Node *node = FindLiveLocked(key, hash);
+
+        double current = 0.0;
+        if (node != nullptr)
+        {
+            std::string_view value = node->value.View();
+            auto parsed = std::from_chars(value.data(), value.data() + value.size(), current);
+            if (value.empty() || parsed.ec != std::errc() || parsed.ptr != value.data() + value.size() ||
+                !std::isfinite(current))
+            {
+                throw std::invalid_argument("value of key '" + key + "' is not a valid float");
+            }
+        }
+
+        double sum = current + delta;
+        if (!std::isfinite(sum))
+        {
+            throw std::invalid_argument("increment of key '" + key + "' would produce NaN or Infinity");
+        }
+        auto formatted = std::to_chars(digits, digits + sizeof(digits), sum, std::chars_format::fixed);
+        result.assign(digits, formatted.ptr);
+
+        auto expiration = node != nullptr ? node->expiration : std::chrono::steady_clock::time_point::max();
+        SetLocked(key, hash, MakeValue(result), expiration);
+    }
+
+    // Log a message indicating the new value
+    file_logger_->info("INCRBYFLOAT key '" + key + "': " + result);
+    std::cout << "INCRBYFLOAT key '" << key << "': " << result << std::endl;
+    return result;
+}
+
+/**
+ * @brief Appends to the value of a key, creating it if it does not exist.
+ *
+ * Nodes are immutable, so the appended value is a new node holding a copy of the old value and the suffix.
+ *
+ * @param key The key.
+ * @param suffix The bytes to append.
+ * @return The length of the value after the append.
+ * @throws std::length_error If the key is too long or the entry would be larger than the byte budget.
+ */
+size_t EpochCache::Append(const std::string &key, const std::string &suffix)
+{
+    CheckEntry(key, suffix);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    size_t length;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+
+        Node *node = FindLiveLocked(key, hash);
+        std::string value;
+        if (node != nullptr)
+        {
+            value.reserve(node->value.Size() + suffix.size());
+            value.assign(node->value.View());
+        }
+        value.append(suffix);
+        length = value.size();
+        CheckEntry(key, value);
+
+        auto expiration = node != nullptr ? node->expiration : std::chrono::steady_clock::time_point::max();
+        SetLocked(key, hash, MakeValue(std::move(value)), expiration);
+    }
+
+    // Log a message indicating the new length
+    file_logger_->info("APPEND key '" + key + "': " + std::to_string(length) + " bytes");
+    std::cout << "APPEND key '" << key << "': " << length << " bytes" << std::endl;
+    return length;
+}
+
+/**
+ * @brief Replaces the value of a key, returning the previous one. The new entry never expires.
+ *
+ * @param key The key.
+ * @param value The new value.
+ * @param old_value Receives the previous value if the key existed.
+ * @return `true` if the key existed and had not expired.
+ * @throws std::length_error If the key is too long or the entry alone is larger than the byte budget.
+ */
+bool EpochCache::GetSet(const std::string &key, const std::string &value, std::string &old_value)
+{
+    CheckEntry(key, value);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    bool existed;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+
+        Node *node = FindLiveLocked(key, hash);
+        existed = node != nullptr;
+        if (existed)
+        {
+            old_value.assign(node->value.View());
+        }
+        SetLocked(key, hash, MakeValue(value), std::chrono::steady_clock::time_point::max());
+    }
+    stats_.Add(Stat::kSets);
+
+    // Log a message indicating the key has been set
+    file_logger_->info("GETSET key '" + key + "': " + (existed ? "replaced" : "created"));
+    std::cout << "GETSET key '" << key << "': " << (existed ? "replaced" : "created") << std::endl;
+    return existed;
+}
+
+/**
+ * @brief Stores a value only if the entry still has the expected version.
+ *
+ * The version check and the store happen under the writer lock, so of several writers that read the same version,
+ * exactly one succeeds.
+ *
+ * @param key The key.
+ * @param value The new value.
+ * @param version The version read by `GetVersioned`, or 0 to store only if the key does not exist.
+ * @param duration The new time-to-live; 0 means the entry never expires.
+ * @param new_version Receives the entry's version after a successful store.
+ * @return Whether the value was stored, and why not otherwise.
+ * @throws std::length_error If the key is too long or the entry alone is larger than the byte budget.
+ */
+CasResult EpochCache::CompareAndSet(const std::string &key,
+                                    const std::string &value,
+                                    uint64_t version,
+                                    std::chrono::seconds duration,
+                                    uint64_t &new_version)
+{
+    CheckEntry(key, value);
+    auto expiration = ExpirationAfter(duration);
+
+    // Hash the key before taking the lock
+    size_t hash = SwissIndex::Hash(key);
+    hot_keys_.Record(key, hash);
+
+    CasResult result;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+
+        Node *node = FindLiveLocked(key, hash);
+        if (node == nullptr)
+        {
+            result = version == 0 ? CasResult::kStored : CasResult::kNotFound;
+        }
+        else
+        {
+            result = node->version == version ? CasResult::kStored : CasResult::kConflict;
+        }
+
+        if (result == CasResult::kStored)
+        {
+            // The store stamps the entry with the newest version
+            SetLocked(key, hash, MakeValue(value), expiration);
+            new_version = version_clock_;
+        }
+    }
+    if (result == CasResult::kStored)
+    {
+        stats_.Add(Stat::kSets);
+    }
+
+    // Log a message indicating the outcome
+    const char *outcome = result == CasResult::kStored     ? "stored"
+                          : result == CasResult::kConflict ? "version mismatch"
+                                                           : "not found";
+    file_logger_->info("CAS key '" + key + "': " + outcome);
+    std::cout << "CAS key '" << key << "': " << outcome << std::endl;
+    return result;
+}
+
+/**
+ * @brief Stores several key-value pairs under one writer lock acquisition.
+ *
+ * Every pair is validated before the lock is taken, so either all of them are stored or none is. Readers may see
+ * some of the pairs before the others.
+ *
+ * @param entries The pairs to store, in order; a later pair for the same key wins.
+ * @throws std::length_error If a key is too long or an entry alone is larger than the byte budget.
+ */
+void EpochCache::MSet(const std::vector<CacheSetRequest> &entries)
+{
+    std::vector<size_t> hashes(entries.size());
+    std::vector<std::chrono::steady_clock::time_point> expirations(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        CheckEntry(entries[i].key, entries[i].value);
+        hashes[i] = SwissIndex::Hash(entries[i].key);
+        hot_keys_.Record(entries[i].key, hashes[i]);
+        expirations[i] = ExpirationAfter(entries[i].duration);
+    }
+
+    size_t inserted = 0;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            if (SetLocked(entries[i].key, hashes[i], MakeValue(entries[i].value), expirations[i]))
+            {
+                ++inserted;
+            }
+        }
+    }
+
+    stats_.Add(Stat::kSets, entries.size());
+
+    // Log one line for the whole batch
+    file_logger_->info("MSET " + std::to_string(entries.size()) + " keys: " + std::to_string(inserted) + " new");
+    std::cout << "MSET " << entries.size() << " keys: " << inserted << " new" << std::endl;
+}
+
+/**
+ * @brief Deletes several keys under one writer lock acquisition.
+ *
+ * @param keys The keys to delete.
+ * @param deleted Receives, for each key, whether it existed.
+ * @return The number of keys deleted.
+ */
+size_t EpochCache::MDelete(const std::vector<std::string> &keys, std::vector<bool> &deleted)
+{
+    // Hash the keys before taking the lock
+    std::vector<size_t> hashes(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        hashes[i] = SwissIndex::Hash(keys[i]);
+    }
+
+    deleted.assign(keys.size(), false);
+    size_t count = 0;
+    {
+        // Lock the mutex to serialize writers
+        std::lock_guard<TimedMutex> lock(write_mutex_);
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            if (DeleteLocked(keys[i], hashes[i]))
+            {
+                deleted[i] = true;
+                ++count;
+            }
+        }
+    }
+
+    // Log one line for the whole batch
+    file_logger_->info("MDEL " + std::to_string(keys.size()) + " keys: " + std::to_string(count) + " deleted");
+    std::cout << "MDEL " << keys.size() << " keys: " << count << " deleted" << std::endl;
+    return count;
+}
@@ -0,0 +1,214 @@
+#include <thread>
+
+#include "EpochManager.h"
+
+/**
+ * @brief Returns the process-wide manager.
+ *
+ * The manager is never destroyed, so threads that exit after `main` returns can still hand back their records.
+ */
+EpochManager &EpochManager::Instance()
+{
+    static EpochManager *instance = new EpochManager();
+    return *instance;
+}
+
+/**
+ * @brief Pins the calling thread to the current epoch, unless an enclosing guard already has.
+ *
+ * The fence orders the pin before every load of the traversal that follows. A thread advancing the epoch fences
+ * before reading the records, so either it sees this pin, or this traversal sees every unlink that preceded the
+ * advance and cannot reach the objects the advance makes freeable.
+ */
+EpochManager::Guard::Guard(EpochManager &manager) : record_(manager.LocalRecord())
+{
+    if (record_->depth++ == 0)
+    {
+        record_->epoch.store(manager.epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+/**
+ * @brief Unpins the calling thread when the outermost guard goes away.
+ */
+EpochManager::Guard::~Guard()
+{
+    if (--record_->depth == 0)
+    {
+        // Release, so that the traversal's loads complete before the thread is seen unpinned
+        record_->epoch.store(kInactive, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief Returns the calling thread's record, claiming one on first use.
+ *
+ * A record released by an exited thread is reused before a new one is allocated, so the list of records, which
+ * `TryAdvance` walks, is only as long as the largest number of threads that have pinned at the same time.
+ */
+EpochManager::Record *EpochManager::LocalRecord()
+{
+    /**
+     * @brief Hands the record back when its thread exits.
+     */
+    struct Owner
+    {
+        Record *record = nullptr;
+
+        ~Owner()
+        {
+            if (record != nullptr)
+            {
+                record->epoch.store(kInactive, std::memory_order_release);
+                record->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+    thread_local Owner owner;
+
+    if (owner.record != nullptr)
+    {
+        return owner.record;
+    }
+
+    for (Record *record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        bool expected = false;
+        if (!record->in_use.load(std::memory_order_relaxed) &&
+            record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            record->depth = 0;
+            owner.record = record;
+            return record;
+        }
+    }
+
+    Record *record = new Record();
+    record->in_use.store(true, std::memory_order_relaxed);
+    Record *head = records_.load(std::memory_order_relaxed);
+    do
+    {
+        record->next = head;
+    } while (!records_.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+    owner.record = record;
+    return record;
+}
+
+/**
+ * @brief Frees `object` with `deleter` once no pinned reader can still reach it.
+ *
+ * Every `kReclaimInterval` retirements, the call also tries to advance the epoch and frees the objects that have
+ * become unreachable, outside the mutex.
+ *
+ * @param object The unlinked object.
+ * @param deleter Frees the object.
+ */
+void EpochManager::Retire(void *object, void (*deleter)(void *))
+{
+    // The unlink must precede reading the epoch the object is tagged with
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::vector<Retired> freeable;
+    {
+        std::lock_guard<std::mutex> lock(retired_mutex_);
+        retired_.push_back({epoch_.load(), object, deleter});
+        if (++since_reclaim_ >= kReclaimInterval)
+        {
+            since_reclaim_ = 0;
+            TryAdvance();
+            CollectLocked(freeable);
+        }
+    }
+
+    for (const Retired &retired : freeable)
+    {
+        retired.deleter(retired.object);
+    }
+}
+
+/**
+ * @brief Waits until everything retired so far has been freed.
+ *
+ * Objects retired before the call carry at most the current epoch, so they are all freeable once the epoch has
+ * advanced twice more.
+ */
+void EpochManager::Synchronize()
+{
+    const uint64_t target = epoch_.load() + 2;
+
+    std::vector<Retired> freeable;
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(retired_mutex_);
+            TryAdvance();
+            if (epoch_.load() >= target)
+            {
+                CollectLocked(freeable);
+                break;
+            }
+        }
+
+        // Some thread is still pinned to an older epoch; let it finish its traversal
+        std::this_thread::yield();
+    }
+
+    for (const Retired &retired : freeable)
+    {
+        retired.deleter(retired.object);
+    }
+}
+
+/**
+ * @brief Returns the number of retired objects not freed yet.
+ */
+size_t EpochManager::Pending()
+{
+    std::lock_guard<std::mutex> lock(retired_mutex_);
+    return retired_.size();
+}
+
+/**
+ * @brief Advances the global epoch if every pinned thread has observed it.
+ *
+ * @return `true` if the epoch advanced.
+ */
+bool EpochManager::TryAdvance()
+{
+    uint64_t current = epoch_.load();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    for (Record *record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next)
+    {
+        uint64_t pinned = record->epoch.load(std::memory_order_acquire);
+        if (pinned != kInactive && pinned != current)
+        {
+            return false;
+        }
+    }
+
+    return epoch_.compare_exchange_strong(current, current + 1);
+}
+
+/**
+ * @brief Removes the objects that can no longer be reached from `retired_`. The caller holds `retired_mutex_`.
+ *
+ * Tags are read under the mutex, so `retired_` is ordered by epoch and the freeable objects are a prefix of it.
+ *
+ * @param freeable Receives the removed objects, to be freed after the mutex is released.
+ */
+void EpochManager::CollectLocked(std::vector<Retired> &freeable)
+{
+    const uint64_t current = epoch_.load();
+
+    size_t count = 0;
+    while (count < retired_.size() && retired_[count].epoch + 2 <= current)
+    {
+        ++count;
+    }
+
+    freeable.insert(freeable.end(), retired_.begin(), retired_.begin() + count);
+    retired_.erase(retired_.begin(), retired_.begin() + count);
+}
@@ -0,0 +1,140 @@
+#ifndef EPOCH_MANAGER_H
+#define EPOCH_MANAGER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class EpochManager
+ * @brief Epoch-based reclamation: frees objects unlinked from a lock-free structure once no reader can still hold
+ *        a pointer to them.
+ *
+ * A reader pins the current global epoch for the duration of a traversal with a `Guard`. A writer that unlinks an
+ * object hands it to `Retire`, which tags it with the global epoch. The global epoch only advances once every pinned
+ * thread has observed it, so an object retired in epoch `e` can no longer be reached by any reader once the epoch
+ * has reached `e + 2`, and is freed then.
+ *
+ * Pinning costs one store to a cache line owned by the calling thread, and unpinning one more; readers never write
+ * shared memory. Each thread gets its record on its first pin and hands it back when it exits, so threads may come
+ * and go. Retiring takes a mutex, which writers of the structures using this manager are expected to be serialized
+ * by anyway.
+ *
+ * The manager is process-wide: every structure shares the epoch and the records, so a thread reading several of them
+ * pins once.
+ */
+class EpochManager
+{
+    struct Record;
+
+public:
+    /**
+     * @brief Objects retired between two attempts to advance the epoch and free what has become unreachable.
+     */
+    static constexpr size_t kReclaimInterval = 64;
+
+    /**
+     * @class Guard
+     * @brief Pins the calling thread to the current epoch for its lifetime. Guards may nest.
+     */
+    class Guard
+    {
+    public:
+        explicit Guard(EpochManager &manager);
+        ~Guard();
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+    private:
+        Record *record_; ///< The calling thread's record.
+    };
+
+    /**
+     * @brief Returns the process-wide manager.
+     */
+    static EpochManager &Instance();
+
+    /**
+     * @brief Frees `object` with `deleter` once no pinned reader can still reach it.
+     *
+     * The caller must have made `object` unreachable from the shared structure before retiring it.
+     */
+    void Retire(void *object, void (*deleter)(void *));
+
+    /**
+     * @brief Deletes `object` once no pinned reader can still reach it.
+     */
+    template <typename T>
+    void Retire(T *object)
+    {
+        Retire(object, [](void *pointer) { delete static_cast<T *>(pointer); });
+    }
+
+    /**
+     * @brief Waits until everything retired so far has been freed.
+     *
+     * Blocks while other threads stay pinned; the calling thread must not hold a `Guard`.
+     */
+    void Synchronize();
+
+    /**
+     * @brief Returns the number of retired objects not freed yet.
+     */
+    size_t Pending();
+
+private:
+    static constexpr uint64_t kInactive = UINT64_MAX; ///< The epoch of a record whose thread is not pinned.
+
+    /**
+     * @brief One thread's pin. Records are never freed; a record released by an exiting thread is reused.
+     */
+    struct alignas(64) Record
+    {
+        std::atomic<uint64_t> epoch{kInactive}; ///< The epoch the thread is pinned to, or `kInactive`.
+        std::atomic<bool> in_use{false};        ///< Whether a live thread owns the record.
+        size_t depth = 0;                       ///< Nested guards of the owning thread.
+        Record *next = nullptr;                 ///< The next record; set once, before the record is published.
+    };
+
+    /**
+     * @brief An object waiting for the readers of its epoch to unpin.
+     */
+    struct Retired
+    {
+        uint64_t epoch;               ///< The global epoch when the object was retired.
+        void *object;                 ///< The object.
+        void (*deleter)(void *);      ///< Frees the object.
+    };
+
+    std::atomic<uint64_t> epoch_{0};         ///< The global epoch.
+    std::atomic<Record *> records_{nullptr}; ///< Every record, newest first.
+    std::mutex retired_mutex_;               ///< Guards `retired_` and `since_reclaim_`.
+    std::vector<Retired> retired_;           ///< Retired objects in retirement order, so by increasing epoch.
+    size_t since_reclaim_ = 0;               ///< Objects retired since the last reclaim.
+
+    EpochManager() = default;
+
+    /**
+     * @brief Returns the calling thread's record, claiming one on first use.
+     */
+    Record *LocalRecord();
+
+    /**
+     * @brief Advances the global epoch if every pinned thread has observed it.
+     *
+     * @return `true` if the epoch advanced.
+     */
+    bool TryAdvance();
+
+    /**
+     * @brief Removes the objects that can no longer be reached from `retired_`. The caller holds `retired_mutex_`.
+     *
+     * @param freeable Receives the removed objects, to be freed after the mutex is released.
+     */
+    void CollectLocked(std::vector<Retired> &freeable);
+};
+
+#endif // EPOCH_MANAGER_H
@@ -0,0 +1,93 @@
+#include <algorithm>
+
+#include "ArcPolicy.h"
+
+/**
+ * @brief Places a new entry, adapting the T1 target if its key is a ghost.
+ *
+ * A ghost hit means the key would have survived with a differently split cache, so the entry goes straight to
+ * T2 and `p_` moves towards the list that lost it. The step is larger when the other ghost list dominates.
+ */
+void ArcPolicy::OnInsert(CacheItem *item)
+{
+    size_t capacity = t1_.size + t2_.size + 1;
+
+    if (b1_.Contains(item->hash))
+    {
+        size_t step = std::max<size_t>(1, b2_.Size() / std::max<size_t>(1, b1_.Size()));
+        p_ = std::min(capacity, p_ + step);
+        b1_.Erase(item->hash);
+        item->queue = kFrequent;
+        t2_.PushFront(item);
+    }
+    else if (b2_.Contains(item->hash))
+    {
+        size_t step = std::max<size_t>(1, b1_.Size() / std::max<size_t>(1, b2_.Size()));
+        p_ = p_ > step ? p_ - step : 0;
+        b2_.Erase(item->hash);
+        item->queue = kFrequent;
+        t2_.PushFront(item);
+    }
+    else
+    {
+        item->queue = kRecent;
+        t1_.PushFront(item);
+    }
+
+    // Keep each ghost list no larger than the cache itself
+    b1_.Trim(capacity);
+    b2_.Trim(capacity);
+}
+
+/**
+ * @brief Moves a hit entry to the head of T2.
+ */
+void ArcPolicy::OnAccess(CacheItem *item)
+{
+    if (item->queue == kFrequent)
+    {
+        t2_.MoveToFront(item);
+        return;
+    }
+
+    t1_.Remove(item);
+    item->queue = kFrequent;
+    t2_.PushFront(item);
+}
+
+/**
+ * @brief Unlinks a deleted or expired entry without leaving a ghost.
+ */
+void ArcPolicy::OnRemove(CacheItem *item)
+{
+    if (item->queue == kFrequent)
+    {
+        t2_.Remove(item);
+    }
+    else
+    {
+        t1_.Remove(item);
+    }
+}
+
+/**
+ * @brief Evicts from T1 while it exceeds its target (or T2 is empty), otherwise from T2, remembering the ghost.
+ */
+CacheItem *ArcPolicy::Evict()
+{
+    if (!t1_.Empty() && (t1_.size > p_ || t2_.Empty()))
+    {
+        CacheItem *victim = t1_.Back();
+        t1_.Remove(victim);
+        b1_.Push(victim->hash);
+        return victim;
+    }
+
+    CacheItem *victim = t2_.Back();
+    if (victim != nullptr)
+    {
+        t2_.Remove(victim);
+        b2_.Push(victim->hash);
+    }
+    return victim;
+}
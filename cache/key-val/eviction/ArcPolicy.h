@@ -0,0 +1,45 @@
+#ifndef ARC_POLICY_H
+#define ARC_POLICY_H
+
+#include "IEvictionPolicy.h"
+#include "ItemList.h"
+#include "GhostList.h"
+
+/**
+ * @class ArcPolicy
+ * @brief Adaptive Replacement Cache.
+ *
+ * Resident entries are split between T1 (seen once recently) and T2 (seen at least twice). Hashes of entries
+ * evicted from each list are remembered in the ghost lists B1 and B2. A new key found in B1 means T1 was too
+ * small, so the target size `p_` of T1 grows; a key found in B2 shrinks it. Victims come from T1 while it is
+ * larger than its target, otherwise from T2. One-off scans therefore only churn T1.
+ *
+ * The capacity `c` used for ghost bounds is the current number of resident entries.
+ */
+class ArcPolicy : public IEvictionPolicy
+{
+public:
+    std::string Name() const override { return "arc"; }
+    void OnInsert(CacheItem *item) override;
+    void OnAccess(CacheItem *item) override;
+    void OnRemove(CacheItem *item) override;
+    CacheItem *Evict() override;
+
+private:
+    /**
+     * @brief The list an entry is linked into, stored in `CacheItem::queue`.
+     */
+    enum List : uint8_t
+    {
+        kRecent = 0,
+        kFrequent = 1
+    };
+
+    ItemList t1_;  ///< Resident entries seen once, LRU ordered.
+    ItemList t2_;  ///< Resident entries seen more than once, LRU ordered.
+    GhostList b1_; ///< Hashes recently evicted from T1.
+    GhostList b2_; ///< Hashes recently evicted from T2.
+    size_t p_ = 0; ///< Adaptive target size of T1.
+};
+
+#endif // ARC_POLICY_H
@@ -0,0 +1,53 @@
+#include "ClockPolicy.h"
+
+/**
+ * @brief Links a new entry with its reference bit cleared.
+ */
+void ClockPolicy::OnInsert(CacheItem *item)
+{
+    item->hits.store(0, std::memory_order_relaxed);
+    ring_.PushFront(item);
+}
+
+/**
+ * @brief Sets the entry's reference bit.
+ *
+ * The bit is only stored when it changes, so hot keys don't keep dirtying the cache line.
+ */
+void ClockPolicy::OnAccess(CacheItem *item)
+{
+    if (item->hits.load(std::memory_order_relaxed) == 0)
+    {
+        item->hits.store(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Unlinks a deleted or expired entry.
+ */
+void ClockPolicy::OnRemove(CacheItem *item)
+{
+    ring_.Remove(item);
+}
+
+/**
+ * @brief Sweeps from the tail, giving referenced entries a second chance, and returns the first unreferenced one.
+ *
+ * Every step clears a bit, so this terminates within one sweep of the ring.
+ */
+CacheItem *ClockPolicy::Evict()
+{
+    while (!ring_.Empty())
+    {
+        CacheItem *item = ring_.Back();
+        if (item->hits.load(std::memory_order_relaxed) == 0)
+        {
+            ring_.Remove(item);
+            return item;
+        }
+
+        item->hits.store(0, std::memory_order_relaxed);
+        ring_.MoveToFront(item);
+    }
+    return nullptr;
+}
@@ -0,0 +1,29 @@
+#ifndef CLOCK_POLICY_H
+#define CLOCK_POLICY_H
+
+#include "IEvictionPolicy.h"
+#include "ItemList.h"
+
+/**
+ * @class ClockPolicy
+ * @brief Approximate LRU using CLOCK (second chance) reference bits.
+ *
+ * A hit only sets the entry's reference bit with a relaxed store, so GETs can run under the shared lock.
+ * Entries are kept in insertion order; on eviction, referenced entries at the tail have their bit cleared
+ * and are moved to the head instead of being evicted.
+ */
+class ClockPolicy : public IEvictionPolicy
+{
+public:
+    std::string Name() const override { return "clock"; }
+    bool SharedAccess() const override { return true; }
+    void OnInsert(CacheItem *item) override;
+    void OnAccess(CacheItem *item) override;
+    void OnRemove(CacheItem *item) override;
+    CacheItem *Evict() override;
+
+private:
+    ItemList ring_; ///< Entries in the order the clock hand visits them, tail first.
+};
+
+#endif // CLOCK_POLICY_H
@@ -0,0 +1,43 @@
+#include <stdexcept>
+
+#include "EvictionPolicyFactory.h"
+#include "LruPolicy.h"
+#include "ClockPolicy.h"
+#include "LfuPolicy.h"
+#include "TinyLfuPolicy.h"
+#include "ArcPolicy.h"
+#include "S3FifoPolicy.h"
+
+std::unique_ptr<IEvictionPolicy> CreateEvictionPolicy(const std::string &name)
+{
+    if (name == "lru")
+    {
+        return std::make_unique<LruPolicy>();
+    }
+    if (name == "clock")
+    {
+        return std::make_unique<ClockPolicy>();
+    }
+    if (name == "lfu")
+    {
+        return std::make_unique<LfuPolicy>();
+    }
+    if (name == "tinylfu")
+    {
+        return std::make_unique<TinyLfuPolicy>();
+    }
+    if (name == "arc")
+    {
+        return std::make_unique<ArcPolicy>();
+    }
+    if (name == "s3fifo")
+    {
+        return std::make_unique<S3FifoPolicy>();
+    }
+    throw std::invalid_argument("Unknown eviction policy: " + name);
+}
+
+std::vector<std::string> EvictionPolicyNames()
+{
+    return {"lru", "clock", "lfu", "tinylfu", "arc", "s3fifo"};
+}
@@ -0,0 +1,24 @@
+#ifndef EVICTION_POLICY_FACTORY_H
+#define EVICTION_POLICY_FACTORY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IEvictionPolicy.h"
+
+/**
+ * @brief Creates the eviction policy selected by `eviction_policy` in config.ini.
+ *
+ * @param name One of the names returned by `EvictionPolicyNames()`.
+ * @return A new policy instance.
+ * @throws std::invalid_argument If the name is unknown.
+ */
+std::unique_ptr<IEvictionPolicy> CreateEvictionPolicy(const std::string &name);
+
+/**
+ * @brief Returns the names of all available eviction policies.
+ */
+std::vector<std::string> EvictionPolicyNames();
+
+#endif // EVICTION_POLICY_FACTORY_H
@@ -0,0 +1,97 @@
+#include <algorithm>
+
+#include "FrequencySketch.h"
+#include "CountMinSketch.h"
+
+/**
+ * @brief Grows the sketch to the next power of two at or above `capacity` counters per row.
+ */
+void FrequencySketch::EnsureCapacity(size_t capacity)
+{
+    size_t width = kCountersPerWord;
+    while (width < capacity)
+    {
+        width <<= 1;
+    }
+    if (width <= width_)
+    {
+        return;
+    }
+
+    width_ = width;
+    table_.assign(kDepth * (width_ / kCountersPerWord), 0);
+    additions_ = 0;
+}
+
+/**
+ * @brief Uses the row hashing of `CountMinSketch`, so both sketches are tuned in one place.
+ */
+size_t FrequencySketch::IndexOf(size_t hash, size_t row) const
+{
+    static_assert(kDepth == CountMinSketch::kDepth, "the sketches share their row hashing");
+    return CountMinSketch::RowIndex(static_cast<uint64_t>(hash), row, width_ - 1);
+}
+
+/**
+ * @brief Increments the key's counter in every row, saturating at 15, and ages the sketch periodically.
+ */
+void FrequencySketch::Increment(size_t hash)
+{
+    if (width_ == 0)
+    {
+        return;
+    }
+
+    const size_t words_per_row = width_ / kCountersPerWord;
+    bool added = false;
+    for (size_t row = 0; row < kDepth; ++row)
+    {
+        size_t index = IndexOf(hash, row);
+        uint64_t &word = table_[row * words_per_row + index / kCountersPerWord];
+        unsigned shift = static_cast<unsigned>(index % kCountersPerWord) * 4;
+        if (((word >> shift) & 0xF) != 0xF)
+        {
+            word += uint64_t{1} << shift;
+            added = true;
+        }
+    }
+
+    if (added && ++additions_ >= 10 * width_)
+    {
+        Reset();
+    }
+}
+
+/**
+ * @brief Returns the minimum of the key's counters across all rows.
+ */
+uint32_t FrequencySketch::Estimate(size_t hash) const
+{
+    if (width_ == 0)
+    {
+        return 0;
+    }
+
+    const size_t words_per_row = width_ / kCountersPerWord;
+    uint32_t estimate = 0xF;
+    for (size_t row = 0; row < kDepth; ++row)
+    {
+        size_t index = IndexOf(hash, row);
+        uint64_t word = table_[row * words_per_row + index / kCountersPerWord];
+        unsigned shift = static_cast<unsigned>(index % kCountersPerWord) * 4;
+        estimate = std::min<uint32_t>(estimate, static_cast<uint32_t>((word >> shift) & 0xF));
+    }
+    return estimate;
+}
+
+/**
+ * @brief Halves all counters at once by shifting each word and masking off the bits that crossed counters.
+ */
+void FrequencySketch::Reset()
+{
+    for (auto &word : table_)
+    {
+        word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    additions_ /= 2;
+}
@@ -0,0 +1,55 @@
+#ifndef FREQUENCY_SKETCH_H
+#define FREQUENCY_SKETCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class FrequencySketch
+ * @brief A count-min sketch of 4-bit counters used as the TinyLFU admission filter.
+ *
+ * Each key hash maps to one counter in each of four rows, by the same hashing as `CountMinSketch`; the estimate
+ * is the minimum of the four. Sixteen counters are packed per 64-bit word. After `10 * width` increments every
+ * counter is halved so that the sketch reflects recent popularity rather than all-time counts.
+ */
+class FrequencySketch
+{
+public:
+    /**
+     * @brief Sizes the sketch for roughly `capacity` distinct hot keys.
+     *
+     * The width only grows; growing clears the recorded history.
+     */
+    void EnsureCapacity(size_t capacity);
+
+    /**
+     * @brief Records one occurrence of a key.
+     */
+    void Increment(size_t hash);
+
+    /**
+     * @brief Estimates how often a key occurred since the last reset, capped at 15.
+     */
+    uint32_t Estimate(size_t hash) const;
+
+private:
+    static constexpr size_t kDepth = 4;            ///< Number of rows (hash functions), as in `CountMinSketch`.
+    static constexpr size_t kCountersPerWord = 16; ///< 4-bit counters packed per uint64_t.
+
+    std::vector<uint64_t> table_; ///< `kDepth` rows of `width_ / 16` words each.
+    size_t width_ = 0;            ///< Counters per row, a power of two.
+    size_t additions_ = 0;        ///< Increments since the last reset.
+
+    /**
+     * @brief Returns the counter index of a hash in the given row.
+     */
+    size_t IndexOf(size_t hash, size_t row) const;
+
+    /**
+     * @brief Halves every counter.
+     */
+    void Reset();
+};
+
+#endif // FREQUENCY_SKETCH_H
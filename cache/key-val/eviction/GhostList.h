@@ -0,0 +1,76 @@
+#ifndef GHOST_LIST_H
+#define GHOST_LIST_H
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+/**
+ * @class GhostList
+ * @brief A bounded FIFO of recently evicted key hashes.
+ *
+ * Adaptive policies remember what they evicted without keeping the keys or values around. Only the 64-bit hash
+ * is stored, so a collision may occasionally be mistaken for a ghost hit, which merely affects the policy's
+ * heuristics.
+ */
+class GhostList
+{
+public:
+    /**
+     * @brief Returns the number of remembered hashes.
+     */
+    size_t Size() const { return order_.size(); }
+
+    /**
+     * @brief Checks whether a hash is remembered.
+     */
+    bool Contains(size_t hash) const { return index_.count(hash) != 0; }
+
+    /**
+     * @brief Remembers a hash as the newest ghost.
+     */
+    void Push(size_t hash)
+    {
+        if (Contains(hash))
+        {
+            return;
+        }
+        order_.push_front(hash);
+        index_[hash] = order_.begin();
+    }
+
+    /**
+     * @brief Forgets a hash.
+     *
+     * @return true if the hash was remembered.
+     */
+    bool Erase(size_t hash)
+    {
+        auto it = index_.find(hash);
+        if (it == index_.end())
+        {
+            return false;
+        }
+        order_.erase(it->second);
+        index_.erase(it);
+        return true;
+    }
+
+    /**
+     * @brief Forgets the oldest hashes until at most `limit` remain.
+     */
+    void Trim(size_t limit)
+    {
+        while (order_.size() > limit)
+        {
+            index_.erase(order_.back());
+            order_.pop_back();
+        }
+    }
+
+private:
+    std::list<size_t> order_;                                       ///< Hashes, newest first.
+    std::unordered_map<size_t, std::list<size_t>::iterator> index_; ///< Position of each hash in `order_`.
+};
+
+#endif // GHOST_LIST_H
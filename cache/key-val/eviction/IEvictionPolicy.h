@@ -0,0 +1,75 @@
+#ifndef IEVICTION_POLICY_H
+#define IEVICTION_POLICY_H
+
+#include <string>
+
+#include "CacheItem.h"
+
+/**
+ * @class IEvictionPolicy
+ * @brief The interface for the replacement policy behind the key-value `Cache`.
+ *
+ * The cache owns the entries and the key index; a policy only orders the entries it is told about and picks
+ * victims. Every call is made with the cache's lock held exclusively, except `OnAccess`, which is made under a
+ * shared lock when `SharedAccess()` returns true. Such policies must only touch `CacheItem::hits` there.
+ */
+class IEvictionPolicy
+{
+public:
+    /**
+     * @brief Virtual destructor for the IEvictionPolicy interface.
+     */
+    virtual ~IEvictionPolicy() = default;
+
+    /**
+     * @brief Returns the name the policy is selected by in config.ini.
+     */
+    virtual std::string Name() const = 0;
+
+    /**
+     * @brief Checks whether `OnAccess` is safe to call while other readers hold the shared lock.
+     *
+     * @return true if hits may run under a shared lock, false if they need the exclusive lock.
+     */
+    virtual bool SharedAccess() const { return false; }
+
+    /**
+     * @brief Starts tracking a newly inserted entry.
+     *
+     * @param item The new entry. Its `key` and `hash` are already set.
+     */
+    virtual void OnInsert(CacheItem *item) = 0;
+
+    /**
+     * @brief Records a hit on (or an overwrite of) a tracked entry.
+     *
+     * @param item The accessed entry.
+     */
+    virtual void OnAccess(CacheItem *item) = 0;
+
+    /**
+     * @brief Records a lookup of a key that is not resident.
+     *
+     * Frequency-based admission uses this to learn about keys before they are inserted. It is only called
+     * with the exclusive lock held.
+     *
+     * @param key The missing key.
+     */
+    virtual void OnMiss(const std::string &key) { (void)key; }
+
+    /**
+     * @brief Stops tracking an entry that is being deleted or has expired.
+     *
+     * @param item The entry being removed.
+     */
+    virtual void OnRemove(CacheItem *item) = 0;
+
+    /**
+     * @brief Chooses the next entry to evict and stops tracking it.
+     *
+     * @return The victim, which the cache then erases, or nullptr if no entry is tracked.
+     */
+    virtual CacheItem *Evict() = 0;
+};
+
+#endif // IEVICTION_POLICY_H
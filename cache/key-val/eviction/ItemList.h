@@ -0,0 +1,121 @@
+#ifndef ITEM_LIST_H
+#define ITEM_LIST_H
+
+#include <cstddef>
+
+#include "CacheItem.h"
+
+/**
+ * @struct ItemList
+ * @brief An intrusive doubly linked list of cache entries threaded through `CacheItem::prev/next`.
+ *
+ * The head is the most recently inserted end and the tail is the end policies evict from. An entry can be a
+ * member of at most one list at a time. None of the operations allocate.
+ */
+struct ItemList
+{
+    CacheItem *head = nullptr; ///< The most recently pushed entry.
+    CacheItem *tail = nullptr; ///< The oldest entry.
+    size_t size = 0;           ///< The number of linked entries.
+
+    /**
+     * @brief Checks whether the list has no entries.
+     */
+    bool Empty() const { return head == nullptr; }
+
+    /**
+     * @brief Returns the entry at the tail of the list, or nullptr if it is empty.
+     */
+    CacheItem *Back() const { return tail; }
+
+    /**
+     * @brief Links an entry at the head of the list.
+     *
+     * @param item An entry that is not currently linked into any list.
+     */
+    void PushFront(CacheItem *item)
+    {
+        item->prev = nullptr;
+        item->next = head;
+        if (head != nullptr)
+        {
+            head->prev = item;
+        }
+        head = item;
+        if (tail == nullptr)
+        {
+            tail = item;
+        }
+        ++size;
+    }
+
+    /**
+     * @brief Unlinks an entry from the list.
+     *
+     * @param item An entry that is currently linked into this list.
+     */
+    void Remove(CacheItem *item)
+    {
+        if (item->prev != nullptr)
+        {
+            item->prev->next = item->next;
+        }
+        else
+        {
+            head = item->next;
+        }
+        if (item->next != nullptr)
+        {
+            item->next->prev = item->prev;
+        }
+        else
+        {
+            tail = item->prev;
+        }
+        item->prev = nullptr;
+        item->next = nullptr;
+        --size;
+    }
+
+    /**
+     * @brief Moves a linked entry to the head of the list.
+     *
+     * @param item An entry that is currently linked into this list.
+     */
+    void MoveToFront(CacheItem *item)
+    {
+        if (item != head)
+        {
+            Remove(item);
+            PushFront(item);
+        }
+    }
+
+    /**
+     * @brief Moves every entry of another list to the tail of this one, leaving the other list empty.
+     *
+     * @param other The list to drain.
+     */
+    void Splice(ItemList &other)
+    {
+        if (other.Empty())
+        {
+            return;
+        }
+        if (Empty())
+        {
+            head = other.head;
+        }
+        else
+        {
+            tail->next = other.head;
+            other.head->prev = tail;
+        }
+        tail = other.tail;
+        size += other.size;
+        other.head = other.tail = nullptr;
+        other.size = 0;
+    }
+};
+
+#endif // ITEM_LIST_H
@@ -0,0 +1,97 @@
+#include <algorithm>
+
+#include "LfuPolicy.h"
+
+/**
+ * @brief Computes an entry's bucket from its stored count and the halvings since it was stored.
+ */
+uint8_t LfuPolicy::BucketOf(const CacheItem *item) const
+{
+    // Entries only store the low 16 bits of the epoch, so the age may have wrapped. It only matters for a nonzero
+    // count, though, and `Tick` zeroes the count of every entry that decays into bucket 0, which takes at most 8
+    // halvings; nonzero counts are therefore never more than 8 epochs old.
+    uint32_t shift = std::min<uint32_t>(static_cast<uint16_t>(epoch_ - item->epoch), 8);
+    return static_cast<uint8_t>(item->freq >> shift);
+}
+
+/**
+ * @brief Records an access and, once enough accesses accumulated, halves all counts.
+ *
+ * Buckets are processed in increasing order: bucket `b / 2` has already been drained by the time bucket `b` is
+ * spliced into it, so each entry moves exactly once. Entries decaying from bucket 1 to bucket 0 have their count
+ * zeroed, so that their bucket no longer depends on their epoch.
+ */
+void LfuPolicy::Tick()
+{
+    uint64_t period = std::max<uint64_t>(kMinDecayPeriod, size_ * kDecayFactor);
+    if (++accesses_since_decay_ < period)
+    {
+        return;
+    }
+
+    accesses_since_decay_ = 0;
+    for (CacheItem *item = buckets_[1].head; item != nullptr; item = item->next)
+    {
+        item->freq = 0;
+    }
+    for (size_t b = 1; b < kBuckets; ++b)
+    {
+        buckets_[b / 2].Splice(buckets_[b]);
+    }
+    ++epoch_;
+}
+
+/**
+ * @brief Starts tracking a new entry with a count of one.
+ *
+ * New entries start above the decayed-to-zero bucket, so stale entries are evicted before fresh ones.
+ */
+void LfuPolicy::OnInsert(CacheItem *item)
+{
+    item->freq = 1;
+    item->epoch = static_cast<uint16_t>(epoch_);
+    buckets_[1].PushFront(item);
+    ++size_;
+    Tick();
+}
+
+/**
+ * @brief Increments an entry's count and moves it to the matching bucket.
+ */
+void LfuPolicy::OnAccess(CacheItem *item)
+{
+    uint8_t bucket = BucketOf(item);
+    buckets_[bucket].Remove(item);
+
+    item->freq = bucket == kBuckets - 1 ? bucket : bucket + 1;
+    item->epoch = static_cast<uint16_t>(epoch_);
+    buckets_[item->freq].PushFront(item);
+    Tick();
+}
+
+/**
+ * @brief Unlinks a deleted or expired entry.
+ */
+void LfuPolicy::OnRemove(CacheItem *item)
+{
+    buckets_[BucketOf(item)].Remove(item);
+    --size_;
+}
+
+/**
+ * @brief Evicts the least recently used entry among those with the lowest count.
+ */
+CacheItem *LfuPolicy::Evict()
+{
+    for (auto &bucket : buckets_)
+    {
+        if (!bucket.Empty())
+        {
+            CacheItem *victim = bucket.Back();
+            bucket.Remove(victim);
+            --size_;
+            return victim;
+        }
+    }
+    return nullptr;
+}
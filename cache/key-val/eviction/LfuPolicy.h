@@ -0,0 +1,51 @@
+#ifndef LFU_POLICY_H
+#define LFU_POLICY_H
+
+#include <array>
+#include <cstdint>
+
+#include "IEvictionPolicy.h"
+#include "ItemList.h"
+
+/**
+ * @class LfuPolicy
+ * @brief Least-frequently-used replacement with periodic decay.
+ *
+ * Entries carry an 8-bit access count and live in one intrusive list per count, so hits and evictions are
+ * O(1) (plus a scan over at most 256 bucket heads). Without decay, keys that were popular once would never
+ * leave, so every `kDecayFactor` accesses per resident entry all counts are halved. Halving splices bucket `b`
+ * into bucket `b / 2` and bumps an epoch instead of touching the entries: an entry's current bucket is its
+ * stored count shifted right by the number of epochs since it was last written. Entries that decay to zero have
+ * their stored count zeroed, so the 16-bit epoch they store may wrap.
+ */
+class LfuPolicy : public IEvictionPolicy
+{
+public:
+    std::string Name() const override { return "lfu"; }
+    void OnInsert(CacheItem *item) override;
+    void OnAccess(CacheItem *item) override;
+    void OnRemove(CacheItem *item) override;
+    CacheItem *Evict() override;
+
+private:
+    static constexpr size_t kBuckets = 256;        ///< One bucket per 8-bit count.
+    static constexpr uint64_t kDecayFactor = 16;   ///< Accesses per resident entry between two halvings.
+    static constexpr uint64_t kMinDecayPeriod = 1024; ///< Lower bound on accesses between halvings.
+
+    std::array<ItemList, kBuckets> buckets_; ///< Entries by count, most recently used first within a bucket.
+    size_t size_ = 0;                        ///< The number of tracked entries.
+    uint32_t epoch_ = 0;                     ///< The number of halvings performed so far.
+    uint64_t accesses_since_decay_ = 0;      ///< Accesses recorded since the last halving.
+
+    /**
+     * @brief Returns the bucket an entry currently lives in, accounting for halvings since it was written.
+     */
+    uint8_t BucketOf(const CacheItem *item) const;
+
+    /**
+     * @brief Counts one access and halves every count once the decay period has elapsed.
+     */
+    void Tick();
+};
+
+#endif // LFU_POLICY_H
@@ -0,0 +1,38 @@
+#include "LruPolicy.h"
+
+/**
+ * @brief Links a new entry as the most recently used.
+ */
+void LruPolicy::OnInsert(CacheItem *item)
+{
+    order_.PushFront(item);
+}
+
+/**
+ * @brief Promotes an entry to most recently used by relinking it at the head.
+ */
+void LruPolicy::OnAccess(CacheItem *item)
+{
+    order_.MoveToFront(item);
+}
+
+/**
+ * @brief Unlinks a deleted or expired entry.
+ */
+void LruPolicy::OnRemove(CacheItem *item)
+{
+    order_.Remove(item);
+}
+
+/**
+ * @brief Unlinks and returns the least recently used entry.
+ */
+CacheItem *LruPolicy::Evict()
+{
+    CacheItem *victim = order_.Back();
+    if (victim != nullptr)
+    {
+        order_.Remove(victim);
+    }
+    return victim;
+}
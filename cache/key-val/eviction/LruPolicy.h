@@ -0,0 +1,26 @@
+#ifndef LRU_POLICY_H
+#define LRU_POLICY_H
+
+#include "IEvictionPolicy.h"
+#include "ItemList.h"
+
+/**
+ * @class LruPolicy
+ * @brief Exact least-recently-used replacement.
+ *
+ * Every hit relinks the entry at the head of a single intrusive list, so hits need the exclusive lock.
+ */
+class LruPolicy : public IEvictionPolicy
+{
+public:
+    std::string Name() const override { return "lru"; }
+    void OnInsert(CacheItem *item) override;
+    void OnAccess(CacheItem *item) override;
+    void OnRemove(CacheItem *item) override;
+    CacheItem *Evict() override;
+
+private:
+    ItemList order_; ///< Entries from most (head) to least (tail) recently used.
+};
+
+#endif // LRU_POLICY_H
@@ -0,0 +1,97 @@
+#include <algorithm>
+
+#include "S3FifoPolicy.h"
+
+/**
+ * @brief Queues a new entry in the small FIFO, or in the main FIFO if it was recently evicted from the small one.
+ */
+void S3FifoPolicy::OnInsert(CacheItem *item)
+{
+    item->hits.store(0, std::memory_order_relaxed);
+
+    if (ghost_.Erase(item->hash))
+    {
+        item->queue = kMain;
+        main_.PushFront(item);
+    }
+    else
+    {
+        item->queue = kSmall;
+        small_.PushFront(item);
+    }
+}
+
+/**
+ * @brief Bumps the entry's saturating access counter.
+ *
+ * The load and store are not one atomic increment, so concurrent hits may be undercounted; the counter is only
+ * a hint for the next eviction sweep.
+ */
+void S3FifoPolicy::OnAccess(CacheItem *item)
+{
+    uint8_t hits = item->hits.load(std::memory_order_relaxed);
+    if (hits < kMaxHits)
+    {
+        item->hits.store(hits + 1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Unlinks a deleted or expired entry.
+ */
+void S3FifoPolicy::OnRemove(CacheItem *item)
+{
+    if (item->queue == kMain)
+    {
+        main_.Remove(item);
+    }
+    else
+    {
+        small_.Remove(item);
+    }
+}
+
+/**
+ * @brief Evicts from the small queue while it holds more than 10% of the entries, otherwise from the main queue.
+ *
+ * Small-queue entries hit since insertion move to the main queue instead; main-queue entries that were hit are
+ * reinserted with a decremented counter. Each step either moves an entry out of the small queue or lowers a
+ * counter, so the loop terminates.
+ */
+CacheItem *S3FifoPolicy::Evict()
+{
+    while (!small_.Empty() || !main_.Empty())
+    {
+        size_t total = small_.size + main_.size;
+        if (!small_.Empty() && (small_.size * 10 >= total || main_.Empty()))
+        {
+            CacheItem *item = small_.Back();
+            small_.Remove(item);
+
+            if (item->hits.load(std::memory_order_relaxed) > 0)
+            {
+                item->hits.store(0, std::memory_order_relaxed);
+                item->queue = kMain;
+                main_.PushFront(item);
+                continue;
+            }
+
+            ghost_.Push(item->hash);
+            ghost_.Trim(std::max<size_t>(1, main_.size));
+            return item;
+        }
+
+        CacheItem *item = main_.Back();
+        uint8_t hits = item->hits.load(std::memory_order_relaxed);
+        if (hits > 0)
+        {
+            item->hits.store(hits - 1, std::memory_order_relaxed);
+            main_.MoveToFront(item);
+            continue;
+        }
+
+        main_.Remove(item);
+        return item;
+    }
+    return nullptr;
+}
@@ -0,0 +1,44 @@
+#ifndef S3_FIFO_POLICY_H
+#define S3_FIFO_POLICY_H
+
+#include "IEvictionPolicy.h"
+#include "ItemList.h"
+#include "GhostList.h"
+
+/**
+ * @class S3FifoPolicy
+ * @brief S3-FIFO: a small probationary FIFO, a main FIFO and a ghost FIFO.
+ *
+ * New keys enter the small queue (about 10% of the entries); keys remembered by the ghost queue enter the main
+ * queue directly. Eviction from the small queue promotes entries hit while queued to the main queue and drops
+ * the rest into the ghost queue, so one-hit wonders from scans leave quickly. The main queue is a CLOCK with a
+ * 2-bit counter. Hits only bump `CacheItem::hits` with relaxed stores, so GETs run under the shared lock.
+ */
+class S3FifoPolicy : public IEvictionPolicy
+{
+public:
+    std::string Name() const override { return "s3fifo"; }
+    bool SharedAccess() const override { return true; }
+    void OnInsert(CacheItem *item) override;
+    void OnAccess(CacheItem *item) override;
+    void OnRemove(CacheItem *item) override;
+    CacheItem *Evict() override;
+
+private:
+    /**
+     * @brief The queue an entry is linked into, stored in `CacheItem::queue`.
+     */
+    enum Queue : uint8_t
+    {
+        kSmall = 0,
+        kMain = 1
+    };
+
+    static constexpr uint8_t kMaxHits = 3; ///< Saturation point of the access counter.
+
+    ItemList small_;   ///< Probationary FIFO for new keys.
+    ItemList main_;    ///< FIFO with reinsertion for keys that proved useful.
+    GhostList ghost_;  ///< Hashes of keys recently evicted from the small queue.
+};
+
+#endif // S3_FIFO_POLICY_H
@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <functional>
+
+#include "TinyLfuPolicy.h"
+
+ItemList &TinyLfuPolicy::SegmentOf(const CacheItem *item)
+{
+    switch (item->queue)
+    {
+    case kProbation:
+        return probation_;
+    case kProtected:
+        return protected_;
+    default:
+        return window_;
+    }
+}
+
+/**
+ * @brief Counts the key and admits the new entry into the window.
+ *
+ * While the cache has room, an overflowing window hands its LRU entry to probation without a contest.
+ */
+void TinyLfuPolicy::OnInsert(CacheItem *item)
+{
+    sketch_.EnsureCapacity(Size() + 1);
+    sketch_.Increment(item->hash);
+
+    item->queue = kWindow;
+    window_.PushFront(item);
+
+    size_t total = Size();
+    if (window_.size > std::max<size_t>(1, total / 100) && (capacity_ == 0 || total < capacity_))
+    {
+        CacheItem *spilled = window_.Back();
+        window_.Remove(spilled);
+        spilled->queue = kProbation;
+        probation_.PushFront(spilled);
+    }
+}
+
+/**
+ * @brief Counts the hit and promotes the entry within its segment.
+ *
+ * A hit on probation moves the entry to the protected segment; if that pushes the protected segment past 80% of
+ * the main space, its LRU entry is demoted back to probation.
+ */
+void TinyLfuPolicy::OnAccess(CacheItem *item)
+{
+    sketch_.Increment(item->hash);
+
+    if (item->queue != kProbation)
+    {
+        SegmentOf(item).MoveToFront(item);
+        return;
+    }
+
+    probation_.Remove(item);
+    item->queue = kProtected;
+    protected_.PushFront(item);
+
+    size_t protected_limit = (probation_.size + protected_.size) * 8 / 10;
+    if (protected_.size > std::max<size_t>(1, protected_limit))
+    {
+        CacheItem *demoted = protected_.Back();
+        protected_.Remove(demoted);
+        demoted->queue = kProbation;
+        probation_.PushFront(demoted);
+    }
+}
+
+/**
+ * @brief Counts a lookup of an absent key so it can win admission later.
+ */
+void TinyLfuPolicy::OnMiss(const std::string &key)
+{
+    sketch_.Increment(std::hash<std::string>{}(key));
+}
+
+/**
+ * @brief Unlinks a deleted or expired entry from its segment.
+ */
+void TinyLfuPolicy::OnRemove(CacheItem *item)
+{
+    SegmentOf(item).Remove(item);
+}
+
+CacheItem *TinyLfuPolicy::PopMainVictim()
+{
+    ItemList &segment = probation_.Empty() ? protected_ : probation_;
+    CacheItem *victim = segment.Back();
+    if (victim != nullptr)
+    {
+        segment.Remove(victim);
+    }
+    return victim;
+}
+
+/**
+ * @brief Picks a victim, running the admission contest when the window is over its share.
+ *
+ * The window's LRU entry (the candidate) is compared with the main space's LRU entry. The candidate moves to
+ * probation only if it is estimated to be strictly more popular; otherwise the candidate itself is evicted.
+ */
+CacheItem *TinyLfuPolicy::Evict()
+{
+    size_t total = Size();
+    size_t window_limit = std::max<size_t>(1, total / 100);
+    capacity_ = total;
+    bool main_empty = probation_.Empty() && protected_.Empty();
+
+    if (window_.size <= window_limit && !main_empty)
+    {
+        return PopMainVictim();
+    }
+
+    CacheItem *candidate = window_.Back();
+    if (candidate == nullptr)
+    {
+        return nullptr;
+    }
+    window_.Remove(candidate);
+
+    if (main_empty)
+    {
+        return candidate;
+    }
+
+    ItemList &victim_segment = probation_.Empty() ? protected_ : probation_;
+    CacheItem *victim = victim_segment.Back();
+    if (sketch_.Estimate(candidate->hash) > sketch_.Estimate(victim->hash))
+    {
+        victim_segment.Remove(victim);
+        candidate->queue = kProbation;
+        probation_.PushFront(candidate);
+        return victim;
+    }
+    return candidate;
+}
@@ -0,0 +1,65 @@
+#ifndef TINY_LFU_POLICY_H
+#define TINY_LFU_POLICY_H
+
+#include "IEvictionPolicy.h"
+#include "ItemList.h"
+#include "FrequencySketch.h"
+
+/**
+ * @class TinyLfuPolicy
+ * @brief W-TinyLFU: a small LRU window in front of a segmented LRU, guarded by a frequency admission filter.
+ *
+ * New entries enter the window (about 1% of the entries). When the window overflows, its LRU entry competes with
+ * the main space's LRU entry and only the one the `FrequencySketch` considers more popular stays. The main space
+ * is split into a probation segment and a protected segment (80% of the main space) for entries hit while on
+ * probation. Lookups of absent keys are counted too, so a key that keeps missing earns admission. Scans therefore
+ * pass through the window without flushing the frequently used working set.
+ *
+ * The policy is not told the cache's capacity. Until the first eviction, window overflow moves straight to
+ * probation; afterwards the entry count at the last eviction is taken as the capacity, and overflow only moves
+ * without a contest while the cache is below it (e.g. after deletions).
+ */
+class TinyLfuPolicy : public IEvictionPolicy
+{
+public:
+    std::string Name() const override { return "tinylfu"; }
+    void OnInsert(CacheItem *item) override;
+    void OnAccess(CacheItem *item) override;
+    void OnMiss(const std::string &key) override;
+    void OnRemove(CacheItem *item) override;
+    CacheItem *Evict() override;
+
+private:
+    /**
+     * @brief The segment an entry is linked into, stored in `CacheItem::queue`.
+     */
+    enum Segment : uint8_t
+    {
+        kWindow = 0,
+        kProbation = 1,
+        kProtected = 2
+    };
+
+    ItemList window_;    ///< Admission window, LRU ordered.
+    ItemList probation_; ///< Main-space entries not hit since admission, LRU ordered.
+    ItemList protected_; ///< Main-space entries hit at least once while on probation, LRU ordered.
+    FrequencySketch sketch_; ///< Popularity estimates for resident and recently missed keys.
+    size_t capacity_ = 0;    ///< Entry count at the last eviction, or 0 before the first one.
+
+    /**
+     * @brief Returns the number of tracked entries.
+     */
+    size_t Size() const { return window_.size + probation_.size + protected_.size; }
+
+    /**
+     * @brief Returns the list an entry is currently linked into.
+     */
+    ItemList &SegmentOf(const CacheItem *item);
+
+    /**
+     * @brief Removes and returns the least recently used entry of the main space, or nullptr if it is empty.
+     */
+    CacheItem *PopMainVictim();
+};
+
+#endif // TINY_LFU_POLICY_H
@@ -0,0 +1,159 @@
+#include "TimerWheel.h"
+
+TimerWheel::TimerWheel(std::chrono::steady_clock::duration resolution)
+    : origin_(std::chrono::steady_clock::now()), resolution_(resolution)
+{
+}
+
+uint64_t TimerWheel::TickOf(std::chrono::steady_clock::time_point expiration) const
+{
+    if (expiration <= origin_)
+    {
+        return 0;
+    }
+
+    // Round up, so that an entry is only reaped once its expiration has passed
+    auto elapsed = expiration - origin_;
+    return static_cast<uint64_t>((elapsed + resolution_ - std::chrono::steady_clock::duration(1)) / resolution_);
+}
+
+void TimerWheel::Schedule(CacheItem *item)
+{
+    if (item->expiration == std::chrono::steady_clock::time_point::max())
+    {
+        return;
+    }
+
+    Place(item);
+    ++size_;
+}
+
+void TimerWheel::Unschedule(CacheItem *item)
+{
+    if (item->timer_slot == CacheItem::kUnscheduled)
+    {
+        return;
+    }
+
+    if (item->timer_prev != nullptr)
+    {
+        item->timer_prev->timer_next = item->timer_next;
+    }
+    else
+    {
+        slots_[item->timer_slot / kSlots][item->timer_slot % kSlots] = item->timer_next;
+    }
+    if (item->timer_next != nullptr)
+    {
+        item->timer_next->timer_prev = item->timer_prev;
+    }
+
+    item->timer_prev = nullptr;
+    item->timer_next = nullptr;
+    item->timer_slot = CacheItem::kUnscheduled;
+    --size_;
+}
+
+void TimerWheel::Reschedule(CacheItem *item)
+{
+    Unschedule(item);
+    Schedule(item);
+}
+
+void TimerWheel::Place(CacheItem *item)
+{
+    // Entries that are already due go into the slot of the tick being expired
+    uint64_t tick = TickOf(item->expiration);
+    if (tick < current_tick_)
+    {
+        tick = current_tick_;
+    }
+
+    // Entries beyond the wheel's span are parked in the top level and re-placed when that slot cascades
+    uint64_t delta = tick - current_tick_;
+    if (delta >= kSpan)
+    {
+        tick = current_tick_ + kSpan - 1;
+        delta = kSpan - 1;
+    }
+
+    // Pick the lowest level whose span covers the delay
+    unsigned level = 0;
+    while (level + 1 < kLevels && delta >= (uint64_t(1) << (kBits * (level + 1))))
+    {
+        ++level;
+    }
+    size_t index = (tick >> (kBits * level)) & kMask;
+
+    CacheItem *&head = slots_[level][index];
+    item->timer_prev = nullptr;
+    item->timer_next = head;
+    if (head != nullptr)
+    {
+        head->timer_prev = item;
+    }
+    head = item;
+    item->timer_slot = static_cast<uint16_t>(level * kSlots + index);
+}
+
+void TimerWheel::Cascade()
+{
+    for (unsigned level = 1; level < kLevels; ++level)
+    {
+        // A level only cascades when every level below it has just wrapped around
+        if (((current_tick_ >> (kBits * (level - 1))) & kMask) != 0)
+        {
+            break;
+        }
+
+        size_t index = (current_tick_ >> (kBits * level)) & kMask;
+        CacheItem *item = slots_[level][index];
+        slots_[level][index] = nullptr;
+
+        while (item != nullptr)
+        {
+            CacheItem *next = item->timer_next;
+            Place(item);
+            item = next;
+        }
+    }
+}
+
+size_t TimerWheel::Advance(std::chrono::steady_clock::time_point now,
+                           size_t limit,
+                           const std::function<void(CacheItem *)> &expire)
+{
+    if (now < origin_)
+    {
+        return 0;
+    }
+    uint64_t target = static_cast<uint64_t>((now - origin_) / resolution_);
+
+    size_t expired = 0;
+    while (current_tick_ <= target)
+    {
+        if (cascaded_tick_ != current_tick_)
+        {
+            Cascade();
+            cascaded_tick_ = current_tick_;
+        }
+
+        // Every entry in this level-0 slot expires at exactly `current_tick_`
+        CacheItem *&head = slots_[0][current_tick_ & kMask];
+        while (head != nullptr)
+        {
+            if (expired == limit)
+            {
+                return expired;
+            }
+
+            CacheItem *item = head;
+            Unschedule(item);
+            ++expired;
+            expire(item);
+        }
+
+        ++current_tick_;
+    }
+    return expired;
+}
@@ -0,0 +1,115 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "CacheItem.h"
+
+/**
+ * @class TimerWheel
+ * @brief A hierarchical timer wheel indexing cache entries by expiration time.
+ *
+ * Time is divided into ticks of a fixed resolution. The wheel has `kLevels` levels of `kSlots` slots each; level 0
+ * holds entries due within the next `kSlots` ticks, one slot per tick, and every higher level covers `kSlots` times
+ * the span of the level below with coarser slots. When the lower level wraps around, the next slot of the level
+ * above is cascaded down, so each entry is moved at most `kLevels - 1` times before it expires.
+ *
+ * Entries are linked into slots intrusively through `CacheItem::timer_prev/timer_next`, so scheduling and
+ * unscheduling are O(1) and never allocate. Expiring is proportional to the number of entries actually due, and
+ * `Advance` takes a limit so the caller can do it in small increments.
+ *
+ * @note The wheel is not synchronized; the cache calls it under its exclusive lock.
+ */
+class TimerWheel
+{
+public:
+    /**
+     * @brief Constructs an empty wheel whose tick 0 starts now.
+     *
+     * @param resolution The length of one tick. Entries are reaped at most one tick after they expire.
+     */
+    explicit TimerWheel(std::chrono::steady_clock::duration resolution = std::chrono::milliseconds(100));
+
+    /**
+     * @brief Indexes an entry by its `expiration`.
+     *
+     * Entries expiring at `time_point::max()` never expire and are not indexed. Entries that are already due are
+     * reaped by the next `Advance`.
+     *
+     * @param item An entry that is not currently scheduled.
+     */
+    void Schedule(CacheItem *item);
+
+    /**
+     * @brief Removes an entry from the wheel. Does nothing if it is not scheduled.
+     *
+     * @param item The entry to remove.
+     */
+    void Unschedule(CacheItem *item);
+
+    /**
+     * @brief Moves an entry after its `expiration` changed.
+     *
+     * @param item The entry to move.
+     */
+    void Reschedule(CacheItem *item);
+
+    /**
+     * @brief Expires the entries that are due at `now`, up to `limit` of them.
+     *
+     * Each due entry is unscheduled and then passed to `expire`, which must not schedule or unschedule other
+     * entries. If the limit is reached, the remaining due entries are picked up by the next call.
+     *
+     * @param now The current time.
+     * @param limit The maximum number of entries to expire in this call.
+     * @param expire Called with each due entry.
+     * @return The number of entries expired.
+     */
+    size_t Advance(std::chrono::steady_clock::time_point now,
+                   size_t limit,
+                   const std::function<void(CacheItem *)> &expire);
+
+    /**
+     * @brief Returns the length of one tick.
+     */
+    std::chrono::steady_clock::duration Resolution() const { return resolution_; }
+
+    /**
+     * @brief Returns the number of scheduled entries.
+     */
+    size_t Size() const { return size_; }
+
+private:
+    static constexpr unsigned kBits = 6;             ///< log2 of the number of slots per level.
+    static constexpr size_t kSlots = 1u << kBits;    ///< Slots per level.
+    static constexpr uint64_t kMask = kSlots - 1;    ///< Mask selecting a slot index.
+    static constexpr unsigned kLevels = 4;           ///< Number of levels.
+    static constexpr uint64_t kSpan = uint64_t(1) << (kBits * kLevels); ///< Ticks covered by the whole wheel.
+
+    /**
+     * @brief Converts an expiration time to the first tick at or after it.
+     */
+    uint64_t TickOf(std::chrono::steady_clock::time_point expiration) const;
+
+    /**
+     * @brief Links an entry into the slot matching its expiration relative to `current_tick_`.
+     */
+    void Place(CacheItem *item);
+
+    /**
+     * @brief Re-places the entries of every higher-level slot that starts at `current_tick_`.
+     */
+    void Cascade();
+
+    std::chrono::steady_clock::time_point origin_;  ///< The start of tick 0.
+    std::chrono::steady_clock::duration resolution_; ///< The length of one tick.
+    uint64_t current_tick_ = 0;                      ///< The next tick to be expired.
+    uint64_t cascaded_tick_ = UINT64_MAX;            ///< The last tick for which `Cascade` ran.
+    size_t size_ = 0;                                ///< The number of scheduled entries.
+    CacheItem *slots_[kLevels][kSlots] = {};         ///< The head of each slot's list.
+};
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,334 @@
+#include "OrderedIndex.h"
+
+#include <algorithm>
+#include <cstring>
+
+OrderedIndex::Iterator::Iterator(const Leaf *leaf, size_t pos) : leaf_(leaf), pos_(pos)
+{
+    // Positions past the end of a leaf continue with the next one; only the root leaf of an empty tree is empty
+    if (leaf_ != nullptr && pos_ == leaf_->count)
+    {
+        leaf_ = leaf_->next;
+        pos_ = 0;
+    }
+}
+
+CacheItem *OrderedIndex::Iterator::operator*() const
+{
+    return leaf_->items[pos_];
+}
+
+OrderedIndex::Iterator &OrderedIndex::Iterator::operator++()
+{
+    if (++pos_ == leaf_->count)
+    {
+        leaf_ = leaf_->next;
+        pos_ = 0;
+    }
+    return *this;
+}
+
+OrderedIndex::OrderedIndex() : root_(new Leaf())
+{
+}
+
+OrderedIndex::~OrderedIndex()
+{
+    Free(root_);
+}
+
+void OrderedIndex::Free(Node *node)
+{
+    if (node->leaf)
+    {
+        delete static_cast<Leaf *>(node);
+        return;
+    }
+
+    Inner *inner = static_cast<Inner *>(node);
+    for (Node *child : inner->children)
+    {
+        Free(child);
+    }
+    delete inner;
+}
+
+size_t OrderedIndex::ChildFor(const Inner &inner, std::string_view key)
+{
+    // Keys equal to a separator live in the subtree to its right
+    auto it = std::upper_bound(inner.keys.begin(), inner.keys.end(), key,
+                               [](std::string_view k, const std::string &separator)
+                               { return k < std::string_view(separator); });
+    return static_cast<size_t>(it - inner.keys.begin());
+}
+
+size_t OrderedIndex::PositionIn(const Leaf &leaf, std::string_view key)
+{
+    auto it = std::lower_bound(leaf.items, leaf.items + leaf.count, key,
+                               [](const CacheItem *item, std::string_view k)
+                               { return item->Key() < k; });
+    return static_cast<size_t>(it - leaf.items);
+}
+
+OrderedIndex::Iterator OrderedIndex::LowerBound(std::string_view key) const
+{
+    const Node *node = root_;
+    while (!node->leaf)
+    {
+        const Inner *inner = static_cast<const Inner *>(node);
+        node = inner->children[ChildFor(*inner, key)];
+    }
+
+    const Leaf *leaf = static_cast<const Leaf *>(node);
+    return Iterator(leaf, PositionIn(*leaf, key));
+}
+
+void OrderedIndex::Insert(CacheItem *item)
+{
+    Split split;
+    if (InsertInto(root_, item, split))
+    {
+        // The root was split: grow the tree by one level
+        Inner *root = new Inner();
+        root->keys.push_back(std::move(split.key));
+        root->children.push_back(root_);
+        root->children.push_back(split.node);
+        root->count = 2;
+        root_ = root;
+        ++inners_;
+    }
+    ++size_;
+}
+
+/**
+ * @brief Splits full nodes only once an insert needs the room, moving the upper half into a new right sibling.
+ */
+bool OrderedIndex::InsertInto(Node *node, CacheItem *item, Split &split)
+{
+    std::string_view key = item->Key();
+
+    if (node->leaf)
+    {
+        Leaf *leaf = static_cast<Leaf *>(node);
+        Leaf *target = leaf;
+        Leaf *right = nullptr;
+
+        if (leaf->count == kFanout)
+        {
+            right = new Leaf();
+            ++leaves_;
+            right->count = kFanout - kFanout / 2;
+            std::memcpy(right->items, leaf->items + kFanout / 2, right->count * sizeof(CacheItem *));
+            leaf->count = kFanout / 2;
+
+            right->prev = leaf;
+            right->next = leaf->next;
+            if (leaf->next != nullptr)
+            {
+                leaf->next->prev = right;
+            }
+            leaf->next = right;
+
+            if (key >= right->items[0]->Key())
+            {
+                target = right;
+            }
+        }
+
+        size_t pos = PositionIn(*target, key);
+        std::memmove(target->items + pos + 1, target->items + pos, (target->count - pos) * sizeof(CacheItem *));
+        target->items[pos] = item;
+        ++target->count;
+
+        if (right == nullptr)
+        {
+            return false;
+        }
+        split.key.assign(right->items[0]->Key());
+        split.node = right;
+        return true;
+    }
+
+    Inner *inner = static_cast<Inner *>(node);
+    size_t index = ChildFor(*inner, key);
+    Split child_split;
+    if (!InsertInto(inner->children[index], item, child_split))
+    {
+        return false;
+    }
+
+    inner->keys.insert(inner->keys.begin() + index, std::move(child_split.key));
+    inner->children.insert(inner->children.begin() + index + 1, child_split.node);
+    if (++inner->count <= kFanout)
+    {
+        return false;
+    }
+
+    // Keep the lower half of the children; the separator between the halves moves up to the parent
+    size_t keep = inner->count / 2;
+    Inner *right = new Inner();
+    ++inners_;
+    split.key = std::move(inner->keys[keep - 1]);
+    right->keys.assign(std::make_move_iterator(inner->keys.begin() + keep), std::make_move_iterator(inner->keys.end()));
+    right->children.assign(inner->children.begin() + keep, inner->children.end());
+    right->count = right->children.size();
+    inner->keys.resize(keep - 1);
+    inner->children.resize(keep);
+    inner->count = keep;
+    split.node = right;
+    return true;
+}
+
+void OrderedIndex::Erase(const CacheItem *item)
+{
+    if (!EraseFrom(root_, item))
+    {
+        return;
+    }
+    --size_;
+
+    // A root left with a single child is replaced by it, shrinking the tree by one level
+    if (!root_->leaf && root_->count == 1)
+    {
+        Inner *root = static_cast<Inner *>(root_);
+        root_ = root->children[0];
+        root->children.clear();
+        delete root;
+        --inners_;
+    }
+}
+
+bool OrderedIndex::EraseFrom(Node *node, const CacheItem *item)
+{
+    std::string_view key = item->Key();
+
+    if (node->leaf)
+    {
+        Leaf *leaf = static_cast<Leaf *>(node);
+        size_t pos = PositionIn(*leaf, key);
+        if (pos == leaf->count || leaf->items[pos] != item)
+        {
+            return false;
+        }
+        std::memmove(leaf->items + pos, leaf->items + pos + 1, (leaf->count - pos - 1) * sizeof(CacheItem *));
+        --leaf->count;
+        return true;
+    }
+
+    Inner *inner = static_cast<Inner *>(node);
+    size_t index = ChildFor(*inner, key);
+    if (!EraseFrom(inner->children[index], item))
+    {
+        return false;
+    }
+    if (inner->children[index]->count < kMinFill)
+    {
+        Rebalance(*inner, index);
+    }
+    return true;
+}
+
+/**
+ * @brief Merges the child with a sibling when both fit in one node, and otherwise moves entries or children over
+ *        from the sibling. Separators are only ever copied from existing keys, so they stay valid.
+ */
+void OrderedIndex::Rebalance(Inner &parent, size_t index)
+{
+    size_t i = index > 0 ? index - 1 : index;
+    Node *left_node = parent.children[i];
+    Node *right_node = parent.children[i + 1];
+    bool merge = left_node->count + right_node->count <= kFanout;
+
+    if (left_node->leaf)
+    {
+        Leaf *left = static_cast<Leaf *>(left_node);
+        Leaf *right = static_cast<Leaf *>(right_node);
+
+        if (merge)
+        {
+            std::memcpy(left->items + left->count, right->items, right->count * sizeof(CacheItem *));
+            left->count += right->count;
+            left->next = right->next;
+            if (right->next != nullptr)
+            {
+                right->next->prev = left;
+            }
+            delete right;
+            --leaves_;
+        }
+        else
+        {
+            // Split the entries of both leaves evenly
+            size_t target = (left->count + right->count) / 2;
+            if (left->count > target)
+            {
+                size_t moved = left->count - target;
+                std::memmove(right->items + moved, right->items, right->count * sizeof(CacheItem *));
+                std::memcpy(right->items, left->items + target, moved * sizeof(CacheItem *));
+                left->count -= moved;
+                right->count += moved;
+            }
+            else
+            {
+                size_t moved = target - left->count;
+                std::memcpy(left->items + left->count, right->items, moved * sizeof(CacheItem *));
+                std::memmove(right->items, right->items + moved, (right->count - moved) * sizeof(CacheItem *));
+                left->count += moved;
+                right->count -= moved;
+            }
+            parent.keys[i].assign(right->items[0]->Key());
+            return;
+        }
+    }
+    else
+    {
+        Inner *left = static_cast<Inner *>(left_node);
+        Inner *right = static_cast<Inner *>(right_node);
+
+        if (merge)
+        {
+            left->keys.push_back(std::move(parent.keys[i]));
+            left->keys.insert(left->keys.end(), std::make_move_iterator(right->keys.begin()),
+                              std::make_move_iterator(right->keys.end()));
+            left->children.insert(left->children.end(), right->children.begin(), right->children.end());
+            left->count = left->children.size();
+            right->children.clear();
+            delete right;
+            --inners_;
+        }
+        else
+        {
+            // One child is enough: the underfull node is one short of half full, and the sibling has more than
+            // half, so neither ends up underfull
+            if (left->count > right->count)
+            {
+                right->keys.insert(right->keys.begin(), std::move(parent.keys[i]));
+                parent.keys[i] = std::move(left->keys.back());
+                left->keys.pop_back();
+                right->children.insert(right->children.begin(), left->children.back());
+                left->children.pop_back();
+            }
+            else
+            {
+                left->keys.push_back(std::move(parent.keys[i]));
+                parent.keys[i] = std::move(right->keys.front());
+                right->keys.erase(right->keys.begin());
+                left->children.push_back(right->children.front());
+                right->children.erase(right->children.begin());
+            }
+            left->count = left->children.size();
+            right->count = right->children.size();
+            return;
+        }
+    }
+
+    // The right node was merged into the left one
+    parent.keys.erase(parent.keys.begin() + i);
+    parent.children.erase(parent.children.begin() + i + 1);
+    --parent.count;
+}
+
+size_t OrderedIndex::MemoryBytes() const
+{
+    return leaves_ * sizeof(Leaf) + inners_ * (sizeof(Inner) + kFanout * (sizeof(std::string) + sizeof(Node *)));
+}
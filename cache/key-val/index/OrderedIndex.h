@@ -0,0 +1,195 @@
+#ifndef ORDERED_INDEX_H
+#define ORDERED_INDEX_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CacheItem.h"
+
+/**
+ * @class OrderedIndex
+ * @brief A B+-tree over cache entries ordered by key, for prefix and range queries.
+ *
+ * Leaves hold up to `kFanout` entry pointers in key order and are linked to their neighbours, so a range is read by
+ * one descent followed by a walk along the leaves: a query costs O(log n + matches). Leaves store only pointers and
+ * compare through `CacheItem::Key()`, so keys are not copied; inner nodes keep copies of their separator keys, which
+ * stay valid when the entries they were taken from are erased.
+ *
+ * Nodes below half full are refilled from a sibling or merged with it on erase, so the tree stays balanced and its
+ * leaves at least half full under any mix of inserts and erases.
+ *
+ * The index does not own the entries, and relies on entries never moving, like `SwissIndex`.
+ *
+ * @note The index is not synchronized; the cache calls it under its own lock.
+ */
+class OrderedIndex
+{
+private:
+    struct Leaf;
+
+public:
+    static constexpr size_t kFanout = 64; ///< The most entries per leaf and children per inner node.
+
+    /**
+     * @brief Bytes of index storage per entry: a leaf slot, with leaves about two thirds full on average.
+     */
+    static constexpr size_t kEntryBytes = sizeof(CacheItem *) * 3 / 2;
+
+    /**
+     * @class Iterator
+     * @brief A position in key order. Invalidated by any insert or erase.
+     */
+    class Iterator
+    {
+    public:
+        /**
+         * @brief Checks whether the iterator points at an entry rather than past the last one.
+         */
+        bool Valid() const { return leaf_ != nullptr; }
+
+        /**
+         * @brief Returns the entry the iterator points at. The iterator must be valid.
+         */
+        CacheItem *operator*() const;
+
+        /**
+         * @brief Moves to the entry with the next larger key.
+         */
+        Iterator &operator++();
+
+    private:
+        friend class OrderedIndex;
+
+        Iterator(const Leaf *leaf, size_t pos);
+
+        const Leaf *leaf_; ///< The leaf holding the entry, or nullptr past the end.
+        size_t pos_;       ///< The entry's position in `leaf_`.
+    };
+
+    OrderedIndex();
+    ~OrderedIndex();
+
+    OrderedIndex(const OrderedIndex &) = delete;
+    OrderedIndex &operator=(const OrderedIndex &) = delete;
+
+    /**
+     * @brief Indexes an entry under its key.
+     *
+     * @param item An entry whose key is not indexed yet.
+     */
+    void Insert(CacheItem *item);
+
+    /**
+     * @brief Removes an entry from the index. Does nothing if it is not indexed.
+     *
+     * @param item The entry to remove.
+     */
+    void Erase(const CacheItem *item);
+
+    /**
+     * @brief Returns the position of the first entry whose key is not less than `key`.
+     */
+    Iterator LowerBound(std::string_view key) const;
+
+    /**
+     * @brief Returns the number of indexed entries.
+     */
+    size_t Size() const { return size_; }
+
+    /**
+     * @brief Returns the bytes allocated for the tree's nodes, not counting separator key contents.
+     */
+    size_t MemoryBytes() const;
+
+private:
+    /**
+     * @brief The common header of leaves and inner nodes.
+     */
+    struct Node
+    {
+        bool leaf;       ///< Whether this is a `Leaf` or an `Inner` node.
+        size_t count = 0; ///< Entries of a leaf, or children of an inner node.
+
+        explicit Node(bool is_leaf) : leaf(is_leaf) {}
+    };
+
+    /**
+     * @brief A leaf: entries in key order, linked to the neighbouring leaves.
+     */
+    struct Leaf : Node
+    {
+        CacheItem *items[kFanout]; ///< The first `count` slots hold entries, by increasing key.
+        Leaf *prev = nullptr;      ///< The leaf holding the next smaller keys.
+        Leaf *next = nullptr;      ///< The leaf holding the next larger keys.
+
+        Leaf() : Node(true) {}
+    };
+
+    /**
+     * @brief An inner node: `count` children separated by `count - 1` keys.
+     *
+     * Every key under `children[i]` is less than `keys[i]`, and every key under `children[i + 1]` is at least
+     * `keys[i]`.
+     */
+    struct Inner : Node
+    {
+        std::vector<std::string> keys;
+        std::vector<Node *> children;
+
+        Inner() : Node(false) {}
+    };
+
+    /**
+     * @brief A node split off by an insert, to be linked into the parent after `key`.
+     */
+    struct Split
+    {
+        std::string key;
+        Node *node = nullptr;
+    };
+
+    static constexpr size_t kMinFill = kFanout / 2; ///< Nodes with fewer entries or children are refilled.
+
+    Node *root_;      ///< A leaf while the tree has at most `kFanout` entries.
+    size_t size_ = 0; ///< The number of indexed entries.
+    size_t leaves_ = 1; ///< The number of leaves.
+    size_t inners_ = 0; ///< The number of inner nodes.
+
+    /**
+     * @brief Returns the child of an inner node whose subtree covers `key`.
+     */
+    static size_t ChildFor(const Inner &inner, std::string_view key);
+
+    /**
+     * @brief Returns the first position in a leaf whose key is not less than `key`.
+     */
+    static size_t PositionIn(const Leaf &leaf, std::string_view key);
+
+    /**
+     * @brief Inserts into a subtree, splitting full nodes on the way back up.
+     *
+     * @return `true` if `node` was split, with the new right sibling in `split`.
+     */
+    bool InsertInto(Node *node, CacheItem *item, Split &split);
+
+    /**
+     * @brief Erases from a subtree, refilling underfull children on the way back up.
+     *
+     * @return `true` if the entry was found.
+     */
+    bool EraseFrom(Node *node, const CacheItem *item);
+
+    /**
+     * @brief Refills or merges the underfull child `index` of `parent` with a sibling.
+     */
+    void Rebalance(Inner &parent, size_t index);
+
+    /**
+     * @brief Frees a subtree's nodes.
+     */
+    static void Free(Node *node);
+};
+
+#endif // ORDERED_INDEX_H
@@ -0,0 +1,268 @@
+#include "SwissIndex.h"
+#include "ScanCursor.h"
+
+#include <functional>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief A view of sixteen control bytes that yields bitmasks of matching slots.
+     */
+    struct Group
+    {
+#ifdef __SSE2__
+        __m128i ctrl;
+
+        explicit Group(const int8_t *pos) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+        uint32_t Match(int8_t h2) const
+        {
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+        }
+
+        uint32_t MatchEmptyOrDeleted() const
+        {
+            // Empty and deleted are the only control bytes below -1
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl)));
+        }
+#else
+        const int8_t *ctrl;
+
+        explicit Group(const int8_t *pos) : ctrl(pos) {}
+
+        uint32_t Match(int8_t h2) const
+        {
+            uint32_t mask = 0;
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                mask |= static_cast<uint32_t>(ctrl[i] == h2) << i;
+            }
+            return mask;
+        }
+
+        uint32_t MatchEmptyOrDeleted() const
+        {
+            uint32_t mask = 0;
+            for (uint32_t i = 0; i < 16; ++i)
+            {
+                mask |= static_cast<uint32_t>(ctrl[i] < -1) << i;
+            }
+            return mask;
+        }
+#endif
+    };
+
+    /**
+     * @brief The seven hash bits stored in a full slot's control byte.
+     */
+    inline int8_t H2(size_t hash)
+    {
+        return static_cast<int8_t>(hash & 0x7F);
+    }
+
+    /**
+     * @brief The hash bits that pick the first group to probe.
+     */
+    inline size_t H1(size_t hash)
+    {
+        return hash >> 7;
+    }
+}
+
+size_t SwissIndex::Hash(std::string_view key)
+{
+    return std::hash<std::string_view>()(key);
+}
+
+CacheItem *SwissIndex::Find(std::string_view key, size_t hash) const
+{
+    if (slots_.empty())
+    {
+        return nullptr;
+    }
+
+    const size_t group_mask = slots_.size() / kGroupWidth - 1;
+    const int8_t h2 = H2(hash);
+    size_t group = H1(hash) & group_mask;
+
+    // Triangular probing over a power-of-two number of groups visits every group
+    for (size_t step = 1;; ++step)
+    {
+        size_t base = group * kGroupWidth;
+        Group g(&ctrl_[base]);
+
+        for (uint32_t match = g.Match(h2); match != 0; match &= match - 1)
+        {
+            CacheItem *item = slots_[base + __builtin_ctz(match)];
+            if (item->hash == hash && item->Key() == key)
+            {
+                return item;
+            }
+        }
+
+        // An empty slot ends the probe sequence: the key would have been placed there
+        if (g.Match(kEmpty) != 0)
+        {
+            return nullptr;
+        }
+
+        group = (group + step) & group_mask;
+    }
+}
+
+size_t SwissIndex::FindFreeSlot(size_t hash) const
+{
+    const size_t group_mask = slots_.size() / kGroupWidth - 1;
+    size_t group = H1(hash) & group_mask;
+
+    for (size_t step = 1;; ++step)
+    {
+        size_t base = group * kGroupWidth;
+        uint32_t free = Group(&ctrl_[base]).MatchEmptyOrDeleted();
+        if (free != 0)
+        {
+            return base + __builtin_ctz(free);
+        }
+        group = (group + step) & group_mask;
+    }
+}
+
+void SwissIndex::Insert(CacheItem *item)
+{
+    if (growth_left_ == 0)
+    {
+        // Reclaim deleted slots in place if they are the reason the table looks full, otherwise double it
+        size_t groups = slots_.size() / kGroupWidth;
+        if (groups == 0)
+        {
+            Rehash(1);
+        }
+        else if (size_ * 16 <= slots_.size() * 7)
+        {
+            Rehash(groups);
+        }
+        else
+        {
+            Rehash(groups * 2);
+        }
+    }
+
+    size_t pos = FindFreeSlot(item->hash);
+    if (ctrl_[pos] == kEmpty)
+    {
+        --growth_left_;
+    }
+    ctrl_[pos] = H2(item->hash);
+    slots_[pos] = item;
+    ++size_;
+}
+
+void SwissIndex::Erase(CacheItem *item)
+{
+    if (slots_.empty())
+    {
+        return;
+    }
+
+    const size_t group_mask = slots_.size() / kGroupWidth - 1;
+    const int8_t h2 = H2(item->hash);
+    size_t group = H1(item->hash) & group_mask;
+
+    for (size_t step = 1;; ++step)
+    {
+        size_t base = group * kGroupWidth;
+        Group g(&ctrl_[base]);
+
+        for (uint32_t match = g.Match(h2); match != 0; match &= match - 1)
+        {
+            size_t pos = base + __builtin_ctz(match);
+            if (slots_[pos] == item)
+            {
+                // A probe only passes through a group that has no empty slot, so if this group already has one,
+                // no probe sequence depends on this slot and it can become empty again
+                if (g.Match(kEmpty) != 0)
+                {
+                    ctrl_[pos] = kEmpty;
+                    ++growth_left_;
+                }
+                else
+                {
+                    ctrl_[pos] = kDeleted;
+                }
+                slots_[pos] = nullptr;
+                --size_;
+                return;
+            }
+        }
+
+        if (g.Match(kEmpty) != 0)
+        {
+            return;
+        }
+
+        group = (group + step) & group_mask;
+    }
+}
+
+size_t SwissIndex::Scan(size_t cursor, std::vector<CacheItem *> &out) const
+{
+    if (slots_.empty())
+    {
+        return 0;
+    }
+
+    const size_t group_mask = slots_.size() / kGroupWidth - 1;
+    const size_t home = cursor & group_mask;
+
+    // Every entry whose probe sequence starts at `home` sits in a group of that sequence before the first one with
+    // an empty slot, since lookups stop there
+    size_t group = home;
+    for (size_t step = 1;; ++step)
+    {
+        size_t base = group * kGroupWidth;
+        for (size_t i = base; i < base + kGroupWidth; ++i)
+        {
+            if (ctrl_[i] >= 0 && (H1(slots_[i]->hash) & group_mask) == home)
+            {
+                out.push_back(slots_[i]);
+            }
+        }
+
+        if (Group(&ctrl_[base]).Match(kEmpty) != 0)
+        {
+            break;
+        }
+        group = (group + step) & group_mask;
+    }
+
+    // Increment the reversed cursor, so the high group bits advance first and a scan survives the table doubling
+    return NextReverseCursor(cursor, group_mask);
+}
+
+void SwissIndex::Rehash(size_t groups)
+{
+    std::vector<int8_t> old_ctrl;
+    std::vector<CacheItem *> old_slots;
+    old_ctrl.swap(ctrl_);
+    old_slots.swap(slots_);
+
+    ctrl_.assign(groups * kGroupWidth, kEmpty);
+    slots_.assign(groups * kGroupWidth, nullptr);
+
+    // Keep the load factor at or below 7/8
+    growth_left_ = slots_.size() * 7 / 8 - size_;
+
+    for (size_t i = 0; i < old_slots.size(); ++i)
+    {
+        if (old_ctrl[i] >= 0)
+        {
+            size_t pos = FindFreeSlot(old_slots[i]->hash);
+            ctrl_[pos] = old_ctrl[i];
+            slots_[pos] = old_slots[i];
+        }
+    }
+}
@@ -0,0 +1,127 @@
+#ifndef SWISS_INDEX_H
+#define SWISS_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CacheItem.h"
+
+/**
+ * @class SwissIndex
+ * @brief An open-addressing hash index from keys to cache entries, in the style of a Swiss table.
+ *
+ * Slots are grouped by sixteen. Each slot has a one-byte control word that is either empty, deleted, or the low
+ * seven bits of the hash of the entry stored there. A lookup loads a whole group of control bytes at once (with
+ * SSE2 when available) and only follows the entry pointer for slots whose seven hash bits match, so most probes
+ * touch one control group and one entry. Entries carry their full hash, which is compared before the key and
+ * reused when the table grows, so keys are never rehashed.
+ *
+ * The index does not own the entries. Entries store their key inline right after the hash, and entries never move,
+ * so eviction policies can link them intrusively.
+ *
+ * @note The index is not synchronized; the cache calls it under its own lock.
+ */
+class SwissIndex
+{
+public:
+    /**
+     * @brief Bytes of index storage per slot: the entry pointer and the control byte.
+     */
+    static constexpr size_t kSlotBytes = sizeof(CacheItem *) + 1;
+
+    /**
+     * @brief Computes the hash the index uses for a key.
+     */
+    static size_t Hash(std::string_view key);
+
+    /**
+     * @brief Looks up the entry for a key.
+     *
+     * @param key The key to look up.
+     * @param hash `Hash(key)`.
+     * @return The entry, or nullptr if the key is not indexed.
+     */
+    CacheItem *Find(std::string_view key, size_t hash) const;
+
+    /**
+     * @brief Indexes an entry under its key.
+     *
+     * @param item An entry whose key is not indexed yet and whose `hash` is `Hash(item->Key())`.
+     */
+    void Insert(CacheItem *item);
+
+    /**
+     * @brief Removes an entry from the index. Does nothing if it is not indexed.
+     *
+     * @param item The entry to remove.
+     */
+    void Erase(CacheItem *item);
+
+    /**
+     * @brief Returns the number of indexed entries.
+     */
+    size_t Size() const { return size_; }
+
+    /**
+     * @brief Checks whether no entries are indexed.
+     */
+    bool Empty() const { return size_ == 0; }
+
+    /**
+     * @brief Returns the number of slots. Slot positions are stable until the table grows.
+     */
+    size_t SlotCount() const { return slots_.size(); }
+
+    /**
+     * @brief Returns the entry in a slot, or nullptr if the slot is empty or deleted.
+     *
+     * @param slot A slot position below `SlotCount()`.
+     */
+    CacheItem *At(size_t slot) const { return ctrl_[slot] >= 0 ? slots_[slot] : nullptr; }
+
+    /**
+     * @brief Collects the entries of one step of a cursor-based scan and returns the cursor of the next step.
+     *
+     * A scan starts and ends with cursor 0. Each step visits the entries whose home group (the group their probe
+     * sequence starts from) is the one the cursor names, by walking that group's probe sequence. Cursors advance
+     * through the groups in reverse-binary order, like Redis's SCAN: when the table doubles, the entries of an
+     * already visited group move to groups that are also already visited. So every entry indexed during the whole
+     * scan is returned at least once, and some may be returned more than once, even if the table grows mid-scan.
+     * The cursor carries no state, so the table may change freely between steps.
+     *
+     * @param cursor 0 to start a scan, or the value returned by the previous step.
+     * @param out Receives the entries of this step.
+     * @return The cursor of the next step, or 0 once the scan is complete.
+     */
+    size_t Scan(size_t cursor, std::vector<CacheItem *> &out) const;
+
+    /**
+     * @brief Returns the bytes allocated for slots and control bytes.
+     */
+    size_t MemoryBytes() const { return slots_.size() * kSlotBytes; }
+
+private:
+    static constexpr size_t kGroupWidth = 16; ///< Slots per control group, one SSE2 register.
+    static constexpr int8_t kEmpty = -128;    ///< Control byte of a never-used slot; stops probing.
+    static constexpr int8_t kDeleted = -2;    ///< Control byte of an erased slot; probing continues past it.
+
+    /**
+     * @brief Finds the first empty or deleted slot along `hash`'s probe sequence.
+     */
+    size_t FindFreeSlot(size_t hash) const;
+
+    /**
+     * @brief Rebuilds the table with `groups` control groups, dropping deleted markers.
+     */
+    void Rehash(size_t groups);
+
+    std::vector<int8_t> ctrl_; ///< One control byte per slot.
+    std::vector<CacheItem *> slots_; ///< The indexed entries, parallel to `ctrl_`.
+    size_t size_ = 0;          ///< The number of indexed entries.
+    size_t growth_left_ = 0;   ///< Empty slots that can still be filled before the table must be rebuilt.
+};
+
+#endif // SWISS_INDEX_H
@@ -0,0 +1,295 @@
+#include "SlabAllocator.h"
+
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr size_t kMinChunk = 16;    ///< The smallest chunk size.
+    constexpr size_t kAlignment = 8;    ///< Every chunk size is a multiple of this.
+    constexpr size_t kFineLimit = 128;  ///< Classes are `kAlignment` apart up to this size.
+    constexpr size_t kMinChunksPerSlab = 8; ///< Slabs grow with the chunk size to hold at least this many chunks.
+
+    /**
+     * @brief The chunk sizes: from `kMinChunk` in steps of `kAlignment` up to `kFineLimit`, then growing by about
+     *        25% per class up to `SlabAllocator::kMaxChunk`.
+     */
+    const std::vector<size_t> &ChunkSizes()
+    {
+        static const std::vector<size_t> sizes = []
+        {
+            std::vector<size_t> result;
+            for (size_t size = kMinChunk; size < SlabAllocator::kMaxChunk;)
+            {
+                result.push_back(size);
+                size = size < kFineLimit ? size + kAlignment
+                                         : (size + size / 4 + kAlignment - 1) / kAlignment * kAlignment;
+            }
+            result.push_back(SlabAllocator::kMaxChunk);
+            return result;
+        }();
+        return sizes;
+    }
+
+    /**
+     * @brief Maps `(size + 7) / 8` to a class index for every size up to `SlabAllocator::kMaxChunk`.
+     */
+    const std::vector<uint8_t> &ClassLookup()
+    {
+        static const std::vector<uint8_t> lookup = []
+        {
+            const std::vector<size_t> &chunk_sizes = ChunkSizes();
+            std::vector<uint8_t> result(SlabAllocator::kMaxChunk / kAlignment + 1);
+            size_t cls = 0;
+            for (size_t units = 0; units < result.size(); ++units)
+            {
+                while (chunk_sizes[cls] < units * kAlignment)
+                {
+                    ++cls;
+                }
+                result[units] = static_cast<uint8_t>(cls);
+            }
+            return result;
+        }();
+        return lookup;
+    }
+
+    /**
+     * @brief Rounds a size up to whole pages.
+     */
+    size_t PageRound(size_t size)
+    {
+        static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return (size + page - 1) / page * page;
+    }
+
+    /**
+     * @brief Maps `size` bytes of zeroed memory aligned to `alignment`, a power of two.
+     *
+     * Over-maps by `alignment` and unmaps the unaligned head and the excess tail.
+     *
+     * @throws std::bad_alloc If the mapping fails.
+     */
+    void *MapAligned(size_t size, size_t alignment)
+    {
+        size_t span = size + alignment;
+        void *raw = mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+
+        uintptr_t begin = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t start = (begin + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        size_t head = start - begin;
+        size_t tail = span - head - size;
+        if (head != 0)
+        {
+            munmap(raw, head);
+        }
+        if (tail != 0)
+        {
+            munmap(reinterpret_cast<void *>(start + size), tail);
+        }
+        return reinterpret_cast<void *>(start);
+    }
+}
+
+SlabAllocator::SlabAllocator()
+{
+    static_assert(sizeof(Slab) <= kHeaderSize, "slab header overlaps the first chunk");
+
+    for (size_t chunk_size : ChunkSizes())
+    {
+        SizeClass cls;
+        cls.chunk_size = chunk_size;
+        cls.slab_size = kMinSlabSize;
+        while (cls.slab_size - kHeaderSize < kMinChunksPerSlab * chunk_size)
+        {
+            cls.slab_size *= 2;
+        }
+        cls.capacity = (cls.slab_size - kHeaderSize) / chunk_size;
+        classes_.push_back(cls);
+    }
+}
+
+SlabAllocator::~SlabAllocator()
+{
+    // Slabs that are full are only reachable through their chunks; owners must have freed everything by now, so
+    // only the warm slab of each class remains
+    for (auto &cls : classes_)
+    {
+        while (cls.partial != nullptr)
+        {
+            ReleaseSlab(cls, cls.partial);
+        }
+    }
+}
+
+size_t SlabAllocator::ClassOf(size_t size)
+{
+    return ClassLookup()[(size + kAlignment - 1) / kAlignment];
+}
+
+size_t SlabAllocator::ClassSize(size_t size_class)
+{
+    return ChunkSizes()[size_class];
+}
+
+size_t SlabAllocator::ChunkSize(size_t size)
+{
+    if (size > kMaxChunk)
+    {
+        return PageRound(size);
+    }
+    return ChunkSizes()[ClassOf(size)];
+}
+
+void SlabAllocator::LinkPartial(SizeClass &cls, Slab *slab)
+{
+    slab->prev = nullptr;
+    slab->next = cls.partial;
+    if (cls.partial != nullptr)
+    {
+        cls.partial->prev = slab;
+    }
+    cls.partial = slab;
+    slab->in_partial = true;
+}
+
+void SlabAllocator::UnlinkPartial(SizeClass &cls, Slab *slab)
+{
+    if (slab->prev != nullptr)
+    {
+        slab->prev->next = slab->next;
+    }
+    else
+    {
+        cls.partial = slab->next;
+    }
+    if (slab->next != nullptr)
+    {
+        slab->next->prev = slab->prev;
+    }
+    slab->prev = nullptr;
+    slab->next = nullptr;
+    slab->in_partial = false;
+}
+
+SlabAllocator::Slab *SlabAllocator::NewSlab(SizeClass &cls)
+{
+    Slab *slab = static_cast<Slab *>(MapAligned(cls.slab_size, cls.slab_size));
+    slab->free_list = nullptr;
+    slab->used = 0;
+    slab->carved = 0;
+    LinkPartial(cls, slab);
+
+    ++cls.slabs;
+    slab_bytes_.fetch_add(cls.slab_size, std::memory_order_relaxed);
+    return slab;
+}
+
+void SlabAllocator::ReleaseSlab(SizeClass &cls, Slab *slab)
+{
+    UnlinkPartial(cls, slab);
+    munmap(slab, cls.slab_size);
+
+    --cls.slabs;
+    slab_bytes_.fetch_sub(cls.slab_size, std::memory_order_relaxed);
+}
+
+void *SlabAllocator::Allocate(size_t size)
+{
+    if (size > kMaxChunk)
+    {
+        size_t mapped = PageRound(size);
+        void *memory = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        large_bytes_.fetch_add(mapped, std::memory_order_relaxed);
+        return memory;
+    }
+
+    SizeClass &cls = classes_[ClassOf(size)];
+    Slab *slab = cls.partial != nullptr ? cls.partial : NewSlab(cls);
+
+    // Reuse a freed chunk first, otherwise carve the next untouched one
+    void *chunk;
+    if (slab->free_list != nullptr)
+    {
+        chunk = slab->free_list;
+        slab->free_list = *static_cast<void **>(chunk);
+    }
+    else
+    {
+        chunk = reinterpret_cast<char *>(slab) + kHeaderSize + static_cast<size_t>(slab->carved) * cls.chunk_size;
+        ++slab->carved;
+    }
+
+    ++slab->used;
+    ++cls.used;
+    if (slab->used == cls.capacity)
+    {
+        UnlinkPartial(cls, slab);
+    }
+    return chunk;
+}
+
+void SlabAllocator::Deallocate(void *ptr, size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    if (size > kMaxChunk)
+    {
+        size_t mapped = PageRound(size);
+        munmap(ptr, mapped);
+        large_bytes_.fetch_sub(mapped, std::memory_order_relaxed);
+        return;
+    }
+
+    // The size picks the class, and the class's slab size locates the slab header
+    SizeClass &cls = classes_[ClassOf(size)];
+    Slab *slab = reinterpret_cast<Slab *>(reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t(cls.slab_size) - 1));
+
+    *static_cast<void **>(ptr) = slab->free_list;
+    slab->free_list = ptr;
+    --slab->used;
+    --cls.used;
+
+    if (!slab->in_partial)
+    {
+        // A full slab has room again; put it first so the next allocation fills it back up
+        LinkPartial(cls, slab);
+    }
+    else if (slab->used == 0 && cls.slabs > 1)
+    {
+        // Give a drained slab back to the system, keeping the class's last slab warm
+        ReleaseSlab(cls, slab);
+    }
+}
+
+std::vector<SlabClassStats> SlabAllocator::Stats() const
+{
+    std::vector<SlabClassStats> stats;
+    for (const auto &cls : classes_)
+    {
+        if (cls.slabs == 0)
+        {
+            continue;
+        }
+
+        SlabClassStats entry;
+        entry.chunk_size = cls.chunk_size;
+        entry.slab_size = cls.slab_size;
+        entry.slabs = cls.slabs;
+        entry.used_chunks = cls.used;
+        entry.free_chunks = cls.slabs * cls.capacity - cls.used;
+        stats.push_back(entry);
+    }
+    return stats;
+}
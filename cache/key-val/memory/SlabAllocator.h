@@ -0,0 +1,152 @@
+#ifndef SLAB_ALLOCATOR_H
+#define SLAB_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct SlabClassStats
+ * @brief Usage of one slab allocator size class.
+ */
+struct SlabClassStats
+{
+    size_t chunk_size;  ///< Bytes per chunk in this class.
+    size_t slab_size;   ///< Bytes per slab in this class.
+    size_t slabs;       ///< Slabs currently held by this class.
+    size_t used_chunks; ///< Chunks handed out.
+    size_t free_chunks; ///< Chunks available in this class's slabs.
+};
+
+/**
+ * @class SlabAllocator
+ * @brief A size-class allocator that carves fixed-size slabs into equal chunks.
+ *
+ * Requests are rounded up to one of about fifty size classes, 8 bytes apart up to 128 bytes and roughly 25% apart
+ * above, so the internal waste per allocation is bounded and freed chunks are reused by allocations of similar size instead of fragmenting a
+ * general-purpose heap. Each slab serves a single class and holds at least eight chunks; slabs are a power of two
+ * of at least `kMinSlabSize` bytes, mapped directly from the system and aligned to their size, so the slab owning
+ * a chunk is found by masking the chunk's address. A slab whose chunks are all free is unmapped (each class keeps
+ * one slab warm), so resident memory tracks live data rather than the historical peak.
+ *
+ * Requests larger than `kMaxChunk` bypass the slabs and are mapped individually.
+ *
+ * @note The allocator is not synchronized; the cache uses it under its exclusive lock.
+ */
+class SlabAllocator
+{
+public:
+    static constexpr size_t kMinSlabSize = 64 * 1024; ///< Bytes per slab of the small classes.
+    static constexpr size_t kMaxChunk = 256 * 1024;   ///< The largest size served from slabs.
+
+    SlabAllocator();
+    ~SlabAllocator();
+
+    SlabAllocator(const SlabAllocator &) = delete;
+    SlabAllocator &operator=(const SlabAllocator &) = delete;
+
+    /**
+     * @brief Allocates at least `size` bytes, aligned to 8 bytes.
+     *
+     * @param size The number of bytes needed.
+     * @return The allocated memory.
+     * @throws std::bad_alloc If the system is out of memory.
+     */
+    void *Allocate(size_t size);
+
+    /**
+     * @brief Frees memory returned by `Allocate`.
+     *
+     * @param ptr The memory to free.
+     * @param size The size that was passed to `Allocate`.
+     */
+    void Deallocate(void *ptr, size_t size);
+
+    /**
+     * @brief Returns the number of bytes actually reserved for an allocation of `size` bytes.
+     */
+    static size_t ChunkSize(size_t size);
+
+    /**
+     * @brief Maps a request of at most `kMaxChunk` bytes to its size class index.
+     */
+    static size_t ClassOf(size_t size);
+
+    /**
+     * @brief Returns the chunk size of a class. Passing it to `Deallocate` frees any chunk of that class.
+     */
+    static size_t ClassSize(size_t size_class);
+
+    /**
+     * @brief Returns the bytes held from the system: all slabs plus the large allocations.
+     *
+     * Safe to call concurrently with allocations.
+     */
+    size_t ReservedBytes() const
+    {
+        return slab_bytes_.load(std::memory_order_relaxed) + large_bytes_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Reports the usage of every size class that currently holds slabs.
+     */
+    std::vector<SlabClassStats> Stats() const;
+
+private:
+    /**
+     * @struct Slab
+     * @brief The header at the start of every slab.
+     */
+    struct Slab
+    {
+        Slab *prev;            ///< The previous slab in the class's partial list.
+        Slab *next;            ///< The next slab in the class's partial list.
+        void *free_list;       ///< Freed chunks, linked through their first word.
+        uint32_t used;         ///< Chunks handed out.
+        uint32_t carved;       ///< Chunks ever handed out; the rest of the slab is untouched.
+        bool in_partial;       ///< Whether the slab is linked into the partial list.
+    };
+
+    /**
+     * @struct SizeClass
+     * @brief The slabs of one chunk size.
+     */
+    struct SizeClass
+    {
+        size_t chunk_size = 0;    ///< Bytes per chunk.
+        size_t slab_size = 0;     ///< Bytes per slab, also its alignment.
+        size_t capacity = 0;      ///< Chunks per slab.
+        Slab *partial = nullptr;  ///< Slabs with at least one free chunk; allocations come from the head.
+        size_t slabs = 0;         ///< Slabs held by this class.
+        size_t used = 0;          ///< Chunks handed out across this class's slabs.
+    };
+
+    static constexpr size_t kHeaderSize = 64; ///< Bytes reserved for the `Slab` header, keeping chunks aligned.
+
+    /**
+     * @brief Maps and links a fresh slab for a class.
+     */
+    Slab *NewSlab(SizeClass &cls);
+
+    /**
+     * @brief Unmaps a drained slab.
+     */
+    void ReleaseSlab(SizeClass &cls, Slab *slab);
+
+    /**
+     * @brief Links a slab at the head of its class's partial list.
+     */
+    void LinkPartial(SizeClass &cls, Slab *slab);
+
+    /**
+     * @brief Unlinks a slab from its class's partial list.
+     */
+    void UnlinkPartial(SizeClass &cls, Slab *slab);
+
+    std::vector<SizeClass> classes_; ///< The size classes, by increasing chunk size.
+    std::atomic<size_t> slab_bytes_{0};  ///< Bytes held by slabs across all classes.
+    std::atomic<size_t> large_bytes_{0}; ///< Bytes held by allocations above `kMaxChunk`.
+};
+
+#endif // SLAB_ALLOCATOR_H
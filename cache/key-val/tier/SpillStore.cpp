@@ -0,0 +1,214 @@
+#include "SpillStore.h"
+
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+    /**
+     * @brief Rounds a record size up to the 8-byte alignment of record headers.
+     */
+    inline size_t Align(size_t bytes)
+    {
+        return (bytes + 7) & ~size_t(7);
+    }
+}
+
+SpillStore::SpillStore(const std::string &path, size_t max_bytes)
+    : segment_bytes_(max_bytes / kSegments & ~size_t(7)),
+      segment_used_(kSegments, 0),
+      bloom_(max_bytes / kExpectedRecordBytes)
+{
+    if (segment_bytes_ < kMinSegmentBytes)
+    {
+        throw std::invalid_argument("the spill file must be at least " +
+                                    std::to_string(kSegments * kMinSegmentBytes) + " bytes");
+    }
+
+    // The index does not survive restarts, so neither does the file's content
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd_ < 0)
+    {
+        throw std::runtime_error("can't open spill file '" + path + "': " + std::strerror(errno));
+    }
+
+    size_t file_bytes = segment_bytes_ * kSegments;
+    if (ftruncate(fd_, static_cast<off_t>(file_bytes)) != 0)
+    {
+        int error = errno;
+        close(fd_);
+        throw std::runtime_error("can't size spill file '" + path + "': " + std::strerror(error));
+    }
+
+    void *map = mmap(nullptr, file_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (map == MAP_FAILED)
+    {
+        int error = errno;
+        close(fd_);
+        throw std::runtime_error("can't map spill file '" + path + "': " + std::strerror(error));
+    }
+    map_ = static_cast<char *>(map);
+
+    // Promotions read single records at random; readahead would only pull in neighbours nobody asked for
+    madvise(map_, file_bytes, MADV_RANDOM);
+}
+
+SpillStore::~SpillStore()
+{
+    munmap(map_, segment_bytes_ * kSegments);
+    close(fd_);
+}
+
+bool SpillStore::Put(const std::string &key,
+                     uint64_t hash,
+                     std::string_view value,
+                     std::chrono::steady_clock::time_point expiration,
+                     uint64_t version)
+{
+    size_t record_bytes = Align(sizeof(RecordHeader) + key.size() + value.size());
+    if (record_bytes > segment_bytes_)
+    {
+        return false;
+    }
+
+    auto existing = index_.find(key);
+    if (existing != index_.end())
+    {
+        Remove(existing);
+    }
+
+    // Move on to the next segment when the record does not fit, dropping what it held from the previous lap
+    if (segment_used_[current_] + record_bytes > segment_bytes_)
+    {
+        current_ = (current_ + 1) % kSegments;
+        Recycle(current_);
+    }
+
+    uint64_t offset = current_ * segment_bytes_ + segment_used_[current_];
+    RecordHeader header{static_cast<uint32_t>(key.size()), static_cast<uint32_t>(value.size())};
+    std::memcpy(map_ + offset, &header, sizeof(header));
+    std::memcpy(map_ + offset + sizeof(header), key.data(), key.size());
+    std::memcpy(map_ + offset + sizeof(header) + key.size(), value.data(), value.size());
+    segment_used_[current_] += record_bytes;
+
+    index_.emplace(key, Location{offset, static_cast<uint32_t>(value.size()), hash, expiration, version});
+    bloom_.Add(hash);
+    keys_.store(index_.size(), std::memory_order_relaxed);
+    bytes_.fetch_add(key.size() + value.size(), std::memory_order_relaxed);
+    return true;
+}
+
+bool SpillStore::Take(const std::string &key,
+                      uint64_t hash,
+                      std::string &value,
+                      std::chrono::steady_clock::time_point &expiration,
+                      uint64_t &version)
+{
+    if (!bloom_.MayContain(hash))
+    {
+        return false;
+    }
+
+    auto it = index_.find(key);
+    if (it == index_.end())
+    {
+        return false;
+    }
+
+    const Location &location = it->second;
+    value.assign(map_ + location.offset + sizeof(RecordHeader) + key.size(), location.value_size);
+    expiration = location.expiration;
+    version = location.version;
+    Remove(it);
+    return true;
+}
+
+bool SpillStore::Erase(const std::string &key, uint64_t hash)
+{
+    if (!bloom_.MayContain(hash))
+    {
+        return false;
+    }
+
+    auto it = index_.find(key);
+    if (it == index_.end())
+    {
+        return false;
+    }
+    Remove(it);
+    return true;
+}
+
+size_t SpillStore::ErasePrefix(std::string_view prefix, std::chrono::steady_clock::time_point now)
+{
+    size_t erased = 0;
+    for (auto it = index_.begin(); it != index_.end();)
+    {
+        auto next = std::next(it);
+        if (std::string_view(it->first).substr(0, prefix.size()) == prefix)
+        {
+            if (it->second.expiration > now)
+            {
+                ++erased;
+            }
+            Remove(it);
+        }
+        it = next;
+    }
+    return erased;
+}
+
+/**
+ * @brief Rebuilds the Bloom filter once removed keys outnumber the stored ones, so that its false positive rate
+ *        stays near the design rate at a cost amortized over the removals.
+ */
+void SpillStore::Remove(std::unordered_map<std::string, Location>::iterator it)
+{
+    bytes_.fetch_sub(it->first.size() + it->second.value_size, std::memory_order_relaxed);
+    index_.erase(it);
+    keys_.store(index_.size(), std::memory_order_relaxed);
+
+    if (++stale_ > index_.size() + 1024)
+    {
+        RebuildFilter();
+    }
+}
+
+/**
+ * @brief Walks the segment's records and drops the keys whose index entry still points at them; keys that were
+ *        removed or spilled again since then point elsewhere or nowhere.
+ */
+void SpillStore::Recycle(size_t segment)
+{
+    uint64_t offset = segment * segment_bytes_;
+    uint64_t end = offset + segment_used_[segment];
+    while (offset < end)
+    {
+        RecordHeader header;
+        std::memcpy(&header, map_ + offset, sizeof(header));
+
+        auto it = index_.find(std::string(map_ + offset + sizeof(header), header.key_size));
+        if (it != index_.end() && it->second.offset == offset)
+        {
+            Remove(it);
+        }
+        offset += Align(sizeof(header) + header.key_size + header.value_size);
+    }
+    segment_used_[segment] = 0;
+}
+
+void SpillStore::RebuildFilter()
+{
+    bloom_.Clear();
+    for (const auto &entry : index_)
+    {
+        bloom_.Add(entry.second.hash);
+    }
+    stale_ = 0;
+}
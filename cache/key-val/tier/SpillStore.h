@@ -0,0 +1,175 @@
+#ifndef SPILL_STORE_H
+#define SPILL_STORE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "BloomFilter.h"
+
+/**
+ * @class SpillStore
+ * @brief A second cache tier that keeps evicted values in a memory-mapped log file on local disk.
+ *
+ * The file is split into `kSegments` equal segments written in turn, like a ring. Values are appended to the current
+ * segment; when it is full, writing moves on to the next one, and whatever that segment still held from the
+ * previous lap is dropped. So the tier as a whole evicts in FIFO order and never needs compaction. Only the key,
+ * the record's file offset, its hash and its expiration stay in memory.
+ *
+ * Lookups of keys that were never spilled are answered by a Bloom filter without touching the index or the disk.
+ * The filter is rebuilt from the index when segments are recycled or when erased keys make up most of it.
+ *
+ * Reads and writes are plain copies from and to the mapping; the kernel pages the file in and writes it back, so
+ * a value read soon after it was spilled usually comes from the page cache.
+ *
+ * @note The store is not synchronized; the cache calls it under its own lock. Only `Size` and `Bytes` may be
+ *       called concurrently with the other methods.
+ */
+class SpillStore
+{
+public:
+    static constexpr size_t kSegments = 8;                  ///< The number of segments the file is split into.
+    static constexpr size_t kMinSegmentBytes = 1024 * 1024; ///< The smallest segment.
+    static constexpr size_t kExpectedRecordBytes = 256;     ///< Average record size the Bloom filter is sized for.
+
+    /**
+     * @brief Creates or truncates the log file and maps it.
+     *
+     * @param path The file. Anything it held is discarded, since the index does not survive restarts.
+     * @param max_bytes The file size, split evenly among the segments.
+     * @throws std::invalid_argument If `max_bytes` is below `kSegments * kMinSegmentBytes`.
+     * @throws std::runtime_error If the file cannot be created, sized or mapped.
+     */
+    SpillStore(const std::string &path, size_t max_bytes);
+
+    /**
+     * @brief Unmaps and closes the file.
+     */
+    ~SpillStore();
+
+    SpillStore(const SpillStore &) = delete;
+    SpillStore &operator=(const SpillStore &) = delete;
+
+    /**
+     * @brief Checks whether a key may be stored, without touching the index.
+     *
+     * @param hash The key's hash.
+     * @return `false` if the key is definitely not stored.
+     */
+    bool MayContain(uint64_t hash) const { return bloom_.MayContain(hash); }
+
+    /**
+     * @brief Appends a value to the log, replacing any value already stored for the key.
+     *
+     * @param key The key.
+     * @param hash The key's hash.
+     * @param value The value.
+     * @param expiration The entry's expiration time.
+     * @param version The entry's version, restored on promotion.
+     * @return `false` if the record is larger than a segment and was not stored.
+     */
+    bool Put(const std::string &key,
+             uint64_t hash,
+             std::string_view value,
+             std::chrono::steady_clock::time_point expiration,
+             uint64_t version);
+
+    /**
+     * @brief Reads a key's value and removes the key, to promote it back to memory.
+     *
+     * @param key The key.
+     * @param hash The key's hash.
+     * @param value Receives the value if the key is stored.
+     * @param expiration Receives the entry's expiration time if the key is stored; the caller checks it.
+     * @param version Receives the entry's version if the key is stored.
+     * @return `true` if the key was stored.
+     */
+    bool Take(const std::string &key,
+              uint64_t hash,
+              std::string &value,
+              std::chrono::steady_clock::time_point &expiration,
+              uint64_t &version);
+
+    /**
+     * @brief Removes a key.
+     *
+     * @param key The key.
+     * @param hash The key's hash.
+     * @return `true` if the key was stored.
+     */
+    bool Erase(const std::string &key, uint64_t hash);
+
+    /**
+     * @brief Removes every key starting with a prefix, visiting every stored key.
+     *
+     * @param prefix The prefix.
+     * @param now Keys expiring by then are removed but not counted.
+     * @return The number of unexpired keys removed.
+     */
+    size_t ErasePrefix(std::string_view prefix, std::chrono::steady_clock::time_point now);
+
+    /**
+     * @brief Returns the number of stored keys.
+     */
+    size_t Size() const { return keys_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns the bytes of keys and values stored in the file.
+     */
+    size_t Bytes() const { return bytes_.load(std::memory_order_relaxed); }
+
+private:
+    /**
+     * @brief Where a stored value lives, and what is needed to drop it.
+     */
+    struct Location
+    {
+        uint64_t offset;     ///< The record's offset in the file.
+        uint32_t value_size; ///< The value's size.
+        uint64_t hash;       ///< The key's hash, to rebuild the Bloom filter.
+        std::chrono::steady_clock::time_point expiration; ///< The entry's expiration time.
+        uint64_t version;    ///< The entry's version.
+    };
+
+    /**
+     * @brief The header of a record; the key and the value follow, and records are padded to 8 bytes.
+     */
+    struct RecordHeader
+    {
+        uint32_t key_size;
+        uint32_t value_size;
+    };
+
+    int fd_ = -1;                  ///< The log file.
+    char *map_ = nullptr;          ///< The whole file, mapped shared.
+    size_t segment_bytes_;         ///< The size of each segment.
+    size_t current_ = 0;           ///< The segment being appended to.
+    std::vector<size_t> segment_used_; ///< Bytes of records written in each segment since it was last recycled.
+    std::unordered_map<std::string, Location> index_; ///< The stored keys.
+    BloomFilter bloom_;            ///< The hashes of the stored keys, and of some removed ones.
+    size_t stale_ = 0;             ///< Keys removed since `bloom_` was last rebuilt.
+    std::atomic<size_t> keys_{0};  ///< Mirror of `index_.size()` readable without the cache lock.
+    std::atomic<size_t> bytes_{0}; ///< Key and value bytes of the stored keys.
+
+    /**
+     * @brief Removes an index entry and updates the counters.
+     */
+    void Remove(std::unordered_map<std::string, Location>::iterator it);
+
+    /**
+     * @brief Drops the keys whose records are still in a segment about to be overwritten.
+     */
+    void Recycle(size_t segment);
+
+    /**
+     * @brief Refills the Bloom filter from the index.
+     */
+    void RebuildFilter();
+};
+
+#endif // SPILL_STORE_H
@@ -0,0 +1,28 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Adds an item to a Bloom filter, creating the filter for `kDefaultBloomCapacity` items if needed.
+ *
+ * @param key The filter's key.
+ * @param item The item.
+ * @return `true` if the item was definitely not in the filter before.
+ * @throws std::length_error If the filter does not exist and the cache is full.
+ */
+bool ProbabilisticCache::BloomAdd(const std::string &key, const std::string &item)
+{
+    uint64_t hash = HashItem(item);
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = blooms_.find(key);
+    if (it == blooms_.end())
+    {
+        size_t bytes = BloomFilter::MemoryBytesFor(kDefaultBloomCapacity);
+        CheckCapacity(bytes);
+        it = blooms_.emplace(key, std::make_unique<BloomFilter>(kDefaultBloomCapacity)).first;
+        memory_used_ += bytes;
+    }
+
+    bool added = !it->second->MayContain(hash);
+    it->second->Add(hash);
+    return added;
+}
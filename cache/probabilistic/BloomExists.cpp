@@ -0,0 +1,17 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Checks whether an item may have been added to a Bloom filter.
+ *
+ * @param key The filter's key.
+ * @param item The item.
+ * @return `false` if the item was definitely never added or the filter does not exist.
+ */
+bool ProbabilisticCache::BloomExists(const std::string &key, const std::string &item)
+{
+    uint64_t hash = HashItem(item);
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = blooms_.find(key);
+    return it != blooms_.end() && it->second->MayContain(hash);
+}
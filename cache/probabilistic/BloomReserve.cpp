@@ -0,0 +1,29 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Creates an empty Bloom filter sized for an expected number of items.
+ *
+ * The filter takes ten bits per expected item, rounded up to a power of two, for about 1% false positives at that
+ * many items; beyond it, the false positive rate climbs.
+ *
+ * @param key The filter's key.
+ * @param capacity The expected number of items.
+ * @return `false` if a filter already exists under the key.
+ * @throws std::length_error If the cache is full or the filter would exceed the byte budget.
+ */
+bool ProbabilisticCache::BloomReserve(const std::string &key, size_t capacity)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    if (blooms_.count(key) != 0)
+    {
+        return false;
+    }
+    size_t bytes = BloomFilter::MemoryBytesFor(capacity);
+    CheckCapacity(bytes);
+    blooms_.emplace(key, std::make_unique<BloomFilter>(capacity));
+    memory_used_ += bytes;
+
+    file_logger_->info("BF.RESERVE " + key + " (capacity " + std::to_string(capacity) + ")");
+    return true;
+}
@@ -0,0 +1,40 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Adds to the counts of items in a count-min sketch, creating it if needed.
+ *
+ * @param key The sketch's key.
+ * @param items The items.
+ * @param increments The amount to add to each item's count, one per item.
+ * @return The estimated count of each item after the increment.
+ * @throws std::length_error If the sketch does not exist and the cache is full.
+ */
+std::vector<uint32_t> ProbabilisticCache::CmsIncrBy(const std::string &key,
+                                                    const std::vector<std::string> &items,
+                                                    const std::vector<uint32_t> &increments)
+{
+    std::vector<uint64_t> hashes;
+    hashes.reserve(items.size());
+    for (const auto &item : items)
+    {
+        hashes.push_back(HashItem(item));
+    }
+
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = sketches_.find(key);
+    if (it == sketches_.end())
+    {
+        CheckCapacity(kSketchBytes);
+        it = sketches_.emplace(key, std::make_unique<CountMinSketch>(kSketchWidth)).first;
+        memory_used_ += kSketchBytes;
+    }
+
+    std::vector<uint32_t> estimates;
+    estimates.reserve(hashes.size());
+    for (size_t i = 0; i < hashes.size(); ++i)
+    {
+        estimates.push_back(it->second->Add(hashes[i], increments[i]));
+    }
+    return estimates;
+}
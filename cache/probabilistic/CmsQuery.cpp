@@ -0,0 +1,31 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Estimates the counts of items in a count-min sketch.
+ *
+ * @param key The sketch's key.
+ * @param items The items.
+ * @return The estimated count of each item, never below the true count; zeros if the sketch does not exist.
+ */
+std::vector<uint32_t> ProbabilisticCache::CmsQuery(const std::string &key, const std::vector<std::string> &items)
+{
+    std::vector<uint64_t> hashes;
+    hashes.reserve(items.size());
+    for (const auto &item : items)
+    {
+        hashes.push_back(HashItem(item));
+    }
+
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    std::vector<uint32_t> counts(items.size(), 0);
+    auto it = sketches_.find(key);
+    if (it != sketches_.end())
+    {
+        for (size_t i = 0; i < hashes.size(); ++i)
+        {
+            counts[i] = it->second->Estimate(hashes[i]);
+        }
+    }
+    return counts;
+}
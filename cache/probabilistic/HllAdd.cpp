@@ -0,0 +1,40 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Adds elements to a HyperLogLog, creating it if needed.
+ *
+ * The elements are hashed before the lock is taken.
+ *
+ * @param key The HyperLogLog's key.
+ * @param elements The elements.
+ * @return `true` if the estimated cardinality may have changed.
+ * @throws std::length_error If the HyperLogLog does not exist and the cache is full.
+ */
+bool ProbabilisticCache::HllAdd(const std::string &key, const std::vector<std::string> &elements)
+{
+    std::vector<uint64_t> hashes;
+    hashes.reserve(elements.size());
+    for (const auto &element : elements)
+    {
+        hashes.push_back(HashItem(element));
+    }
+
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = hlls_.find(key);
+    bool changed = false;
+    if (it == hlls_.end())
+    {
+        // Creating a HyperLogLog counts as a change even without elements, like Redis's PFADD
+        CheckCapacity(HyperLogLog::MemoryBytes());
+        it = hlls_.emplace(key, std::make_unique<HyperLogLog>()).first;
+        memory_used_ += HyperLogLog::MemoryBytes();
+        changed = true;
+    }
+
+    for (uint64_t hash : hashes)
+    {
+        changed |= it->second->Add(hash);
+    }
+    return changed;
+}
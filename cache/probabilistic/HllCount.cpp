@@ -0,0 +1,31 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Estimates the number of distinct elements added to the union of HyperLogLogs.
+ *
+ * A single key is counted in place; several keys are merged into a scratch HyperLogLog first.
+ *
+ * @param keys The HyperLogLogs' keys; missing ones count as empty.
+ * @return The estimated cardinality of the union.
+ */
+uint64_t ProbabilisticCache::HllCount(const std::vector<std::string> &keys)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    if (keys.size() == 1)
+    {
+        auto it = hlls_.find(keys[0]);
+        return it == hlls_.end() ? 0 : it->second->Count();
+    }
+
+    HyperLogLog merged;
+    for (const auto &key : keys)
+    {
+        auto it = hlls_.find(key);
+        if (it != hlls_.end())
+        {
+            merged.Merge(*it->second);
+        }
+    }
+    return merged.Count();
+}
@@ -0,0 +1,34 @@
+#include "ProbabilisticCache.h"
+
+/**
+ * @brief Merges HyperLogLogs into another one, creating it if needed.
+ *
+ * The destination keeps its own elements, so merging into one of the sources accumulates the others into it.
+ *
+ * @param destination The key of the HyperLogLog receiving the union.
+ * @param sources The keys of the HyperLogLogs to merge; missing ones count as empty.
+ * @throws std::length_error If the destination does not exist and the cache is full.
+ */
+void ProbabilisticCache::HllMerge(const std::string &destination, const std::vector<std::string> &sources)
+{
+    std::lock_guard<TimedMutex> lock(mutex_);
+
+    auto it = hlls_.find(destination);
+    if (it == hlls_.end())
+    {
+        CheckCapacity(HyperLogLog::MemoryBytes());
+        it = hlls_.emplace(destination, std::make_unique<HyperLogLog>()).first;
+        memory_used_ += HyperLogLog::MemoryBytes();
+    }
+
+    for (const auto &source : sources)
+    {
+        auto src = hlls_.find(source);
+        if (src != hlls_.end() && src != it)
+        {
+            it->second->Merge(*src->second);
+        }
+    }
+
+    file_logger_->info("PFMERGE " + destination + " (" + std::to_string(sources.size()) + " sources)");
+}
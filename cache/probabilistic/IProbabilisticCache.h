@@ -0,0 +1,95 @@
+#ifndef IPROBABILISTIC_CACHE_H
+#define IPROBABILISTIC_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class IProbabilisticCache
+ * @brief An interface for a cache of probabilistic data structures: Bloom filters, HyperLogLogs and count-min
+ *        sketches, each stored under its own key.
+ *
+ * Each structure type has its own key space, so a Bloom filter and a HyperLogLog may share a name.
+ */
+class IProbabilisticCache
+{
+public:
+    virtual ~IProbabilisticCache() = default;
+
+    /**
+     * @brief Creates an empty Bloom filter sized for `capacity` items at about 1% false positives.
+     *
+     * @param key The filter's key.
+     * @param capacity The expected number of items.
+     * @return `false` if a filter already exists under the key.
+     */
+    virtual bool BloomReserve(const std::string &key, size_t capacity) = 0;
+
+    /**
+     * @brief Adds an item to a Bloom filter, creating the filter with the default capacity if needed.
+     *
+     * @param key The filter's key.
+     * @param item The item.
+     * @return `true` if the item was definitely not in the filter before.
+     */
+    virtual bool BloomAdd(const std::string &key, const std::string &item) = 0;
+
+    /**
+     * @brief Checks whether an item may have been added to a Bloom filter.
+     *
+     * @param key The filter's key.
+     * @param item The item.
+     * @return `false` if the item was definitely never added or the filter does not exist.
+     */
+    virtual bool BloomExists(const std::string &key, const std::string &item) = 0;
+
+    /**
+     * @brief Adds elements to a HyperLogLog, creating it if needed.
+     *
+     * @param key The HyperLogLog's key.
+     * @param elements The elements.
+     * @return `true` if the estimated cardinality may have changed.
+     */
+    virtual bool HllAdd(const std::string &key, const std::vector<std::string> &elements) = 0;
+
+    /**
+     * @brief Estimates the number of distinct elements added to the union of HyperLogLogs.
+     *
+     * @param keys The HyperLogLogs' keys; missing ones count as empty.
+     * @return The estimated cardinality of the union.
+     */
+    virtual uint64_t HllCount(const std::vector<std::string> &keys) = 0;
+
+    /**
+     * @brief Merges HyperLogLogs into another one, creating it if needed.
+     *
+     * @param destination The key of the HyperLogLog receiving the union.
+     * @param sources The keys of the HyperLogLogs to merge; missing ones count as empty.
+     */
+    virtual void HllMerge(const std::string &destination, const std::vector<std::string> &sources) = 0;
+
+    /**
+     * @brief Adds to the counts of items in a count-min sketch, creating it if needed.
+     *
+     * @param key The sketch's key.
+     * @param items The items.
+     * @param increments The amount to add to each item's count.
+     * @return The estimated count of each item after the increment.
+     */
+    virtual std::vector<uint32_t> CmsIncrBy(const std::string &key,
+                                            const std::vector<std::string> &items,
+                                            const std::vector<uint32_t> &increments) = 0;
+
+    /**
+     * @brief Estimates the counts of items in a count-min sketch.
+     *
+     * @param key The sketch's key.
+     * @param items The items.
+     * @return The estimated count of each item, never below the true count; zeros if the sketch does not exist.
+     */
+    virtual std::vector<uint32_t> CmsQuery(const std::string &key, const std::vector<std::string> &items) = 0;
+};
+
+#endif // IPROBABILISTIC_CACHE_H
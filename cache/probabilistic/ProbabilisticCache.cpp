@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "ProbabilisticCache.h"
+#include "LoggerManager.h"
+#include "FileLogger.h"
+
+ProbabilisticCache::ProbabilisticCache(size_t max_size, size_t max_memory)
+    : max_size_(max_size), max_memory_(max_memory)
+{
+    std::ostringstream oss;
+    oss << "cache_" << std::this_thread::get_id() << ".log";
+
+    file_logger_ = std::make_shared<FileLogger>(oss.str());
+    file_logger_->setLogLevel(ILogger::LogLevel::DEBUG);
+
+    // Register the file logger with the LoggerManager to handle logging
+    LoggerManager::getInstance().addLogger(file_logger_);
+}
+
+ProbabilisticCache::~ProbabilisticCache()
+{
+    file_logger_->info("Cache destroyed");
+    std::cout << "Cache destroyed" << std::endl;
+}
+
+/**
+ * @brief Finishes `std::hash` with the SplitMix64 mixer, since the sketches read positions from the high bits and
+ *        the standard library only promises a spread over the whole word.
+ */
+uint64_t ProbabilisticCache::HashItem(std::string_view item)
+{
+    uint64_t h = std::hash<std::string_view>()(item);
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h;
+}
+
+void ProbabilisticCache::CheckCapacity(size_t bytes) const
+{
+    if (blooms_.size() + hlls_.size() + sketches_.size() >= max_size_)
+    {
+        throw std::length_error("the probabilistic cache holds its maximum of " + std::to_string(max_size_) +
+                                " structures");
+    }
+    if (max_memory_ != 0 && bytes > max_memory_ - std::min(memory_used_, max_memory_))
+    {
+        throw std::length_error("OOM: the probabilistic cache would exceed its budget of " +
+                                std::to_string(max_memory_) + " bytes");
+    }
+}
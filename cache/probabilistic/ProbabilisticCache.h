@@ -0,0 +1,152 @@
+#ifndef PROBABILISTIC_CACHE_H
+#define PROBABILISTIC_CACHE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "IProbabilisticCache.h"
+#include "BloomFilter.h"
+#include "HyperLogLog.h"
+#include "CountMinSketch.h"
+#include "LoggerManager.h"
+#include "FileLogger.h"
+#include "TimedMutex.h"
+
+/**
+ * @class ProbabilisticCache
+ * @brief A cache of Bloom filters, HyperLogLogs and count-min sketches.
+ *
+ * Each structure has a fixed size chosen when it is created, whatever the number of items added: a HyperLogLog is
+ * 16 KiB, a count-min sketch `kSketchWidth * 4` counters of 4 bytes, and a Bloom filter ten bits per expected
+ * item. Items are hashed once to 64 bits and every structure derives its positions from that hash. Both the number
+ * of structures and the bytes they allocate are bounded, since a single BF.RESERVE can ask for hundreds of MiB.
+ */
+class ProbabilisticCache : public IProbabilisticCache
+{
+public:
+    static constexpr size_t kDefaultBloomCapacity = 10000; ///< Expected items of a filter created by `BloomAdd`.
+    static constexpr size_t kSketchWidth = 2048; ///< Counters per row; overestimates by at most 0.1% of the total.
+    static constexpr size_t kSketchBytes = CountMinSketch::kDepth * kSketchWidth * sizeof(uint32_t); ///< Per sketch.
+    static constexpr size_t kDefaultMaxMemory = size_t(1) << 30; ///< The default byte budget, 1 GiB.
+
+    /**
+     * @brief Constructs a ProbabilisticCache object with a specified maximum size.
+     *
+     * @param max_size The maximum number of structures, of all types, the cache can hold.
+     * @param max_memory The most bytes the structures may allocate in total; 0 disables the budget.
+     */
+    explicit ProbabilisticCache(size_t max_size = 10000, size_t max_memory = kDefaultMaxMemory);
+
+    /**
+     * @brief Destructor for the ProbabilisticCache class.
+     */
+    ~ProbabilisticCache() override;
+
+    /**
+     * @brief Creates an empty Bloom filter sized for `capacity` items at about 1% false positives.
+     *
+     * @param key The filter's key.
+     * @param capacity The expected number of items.
+     * @return `false` if a filter already exists under the key.
+     * @throws std::length_error If the cache is full or the filter would exceed the byte budget.
+     */
+    bool BloomReserve(const std::string &key, size_t capacity) override;
+
+    /**
+     * @brief Adds an item to a Bloom filter, creating the filter for `kDefaultBloomCapacity` items if needed.
+     *
+     * @param key The filter's key.
+     * @param item The item.
+     * @return `true` if the item was definitely not in the filter before.
+     * @throws std::length_error If the filter does not exist and the cache is full.
+     */
+    bool BloomAdd(const std::string &key, const std::string &item) override;
+
+    /**
+     * @brief Checks whether an item may have been added to a Bloom filter.
+     *
+     * @param key The filter's key.
+     * @param item The item.
+     * @return `false` if the item was definitely never added or the filter does not exist.
+     */
+    bool BloomExists(const std::string &key, const std::string &item) override;
+
+    /**
+     * @brief Adds elements to a HyperLogLog, creating it if needed.
+     *
+     * @param key The HyperLogLog's key.
+     * @param elements The elements.
+     * @return `true` if the estimated cardinality may have changed.
+     * @throws std::length_error If the HyperLogLog does not exist and the cache is full.
+     */
+    bool HllAdd(const std::string &key, const std::vector<std::string> &elements) override;
+
+    /**
+     * @brief Estimates the number of distinct elements added to the union of HyperLogLogs.
+     *
+     * @param keys The HyperLogLogs' keys; missing ones count as empty.
+     * @return The estimated cardinality of the union.
+     */
+    uint64_t HllCount(const std::vector<std::string> &keys) override;
+
+    /**
+     * @brief Merges HyperLogLogs into another one, creating it if needed.
+     *
+     * @param destination The key of the HyperLogLog receiving the union.
+     * @param sources The keys of the HyperLogLogs to merge; missing ones count as empty.
+     * @throws std::length_error If the destination does not exist and the cache is full.
+     */
+    void HllMerge(const std::string &destination, const std::vector<std::string> &sources) override;
+
+    /**
+     * @brief Adds to the counts of items in a count-min sketch, creating it if needed.
+     *
+     * @param key The sketch's key.
+     * @param items The items.
+     * @param increments The amount to add to each item's count.
+     * @return The estimated count of each item after the increment.
+     * @throws std::length_error If the sketch does not exist and the cache is full.
+     */
+    std::vector<uint32_t> CmsIncrBy(const std::string &key,
+                                    const std::vector<std::string> &items,
+                                    const std::vector<uint32_t> &increments) override;
+
+    /**
+     * @brief Estimates the counts of items in a count-min sketch.
+     *
+     * @param key The sketch's key.
+     * @param items The items.
+     * @return The estimated count of each item; zeros if the sketch does not exist.
+     */
+    std::vector<uint32_t> CmsQuery(const std::string &key, const std::vector<std::string> &items) override;
+
+private:
+    size_t max_size_;        ///< The maximum number of structures.
+    size_t max_memory_;      ///< The byte budget of the structures, or 0 if unlimited.
+    size_t memory_used_ = 0; ///< Bytes allocated by the structures.
+    std::unordered_map<std::string, std::unique_ptr<BloomFilter>> blooms_;   ///< Bloom filters by key.
+    std::unordered_map<std::string, std::unique_ptr<HyperLogLog>> hlls_;     ///< HyperLogLogs by key.
+    std::unordered_map<std::string, std::unique_ptr<CountMinSketch>> sketches_; ///< Count-min sketches by key.
+    TimedMutex mutex_; ///< A mutex to ensure thread-safe operations on the cache.
+    std::shared_ptr<FileLogger> file_logger_;
+
+    /**
+     * @brief Hashes an item to the 64 well-mixed bits the structures derive their positions from.
+     */
+    static uint64_t HashItem(std::string_view item);
+
+    /**
+     * @brief Refuses to create a structure once the cache holds `max_size_` of them or if its bytes would exceed
+     *        `max_memory_`.
+     *
+     * @param bytes The bytes the new structure allocates.
+     * @throws std::length_error If the cache is full.
+     */
+    void CheckCapacity(size_t bytes) const;
+};
+
+#endif // PROBABILISTIC_CACHE_H
@@ -25,6 +25,11 @@ public:
      */
     virtual void AddTimePoint(const std::string &series_name, const TimePoint &point) = 0;
 
+    /**
+     * @brief Returns the number of data points held across all series, without taking the cache's lock.
+     */
+    virtual size_t Size() const = 0;
+
 
     /**
      * @brief Cleans up old time series data based.
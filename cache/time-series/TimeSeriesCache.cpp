@@ -7,6 +7,7 @@
 #include "TimeSeriesCache.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
+#include "ServerStats.h"
 
 TimeSeriesCache::TimeSeriesCache(size_t max_size) : max_size_(max_size)
 {
@@ -31,14 +32,20 @@ TimeSeriesCache::~TimeSeriesCache()
 
 void TimeSeriesCache::AddTimePoint(const std::string &series_name, const TimePoint &point)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
+    std::lock_guard<TimedMutex> lock(mutex_);
     
     auto &series = time_data_[series_name];
     if (series.size() >= max_size_)
     {
         series.erase(series.begin()); // Remove the oldest data point
+        ServerStats::Instance().Add(Stat::kTimeSeriesEvictions);
+    }
+    else
+    {
+        point_count_.fetch_add(1, std::memory_order_relaxed);
     }
     series.push_back(point);
+    ServerStats::Instance().Add(Stat::kTimeSeriesPoints);
 }
 void TimeSeriesCache::Cleanup()
 {
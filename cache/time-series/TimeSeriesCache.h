@@ -8,11 +8,13 @@
 #include <mutex>
 #include <chrono>
 #include <memory>
+#include <atomic>
 
 #include "ITimeSeriesCache.h"
 #include "TimePoint.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
+#include "TimedMutex.h"
 
 /**
  * @class TimeSeriesCache
@@ -41,11 +43,17 @@ public:
      */
     void AddTimePoint(const std::string &series_name, const TimePoint &point) override;
 
+    /**
+     * @brief Returns the number of data points held across all series, without taking the cache's lock.
+     */
+    size_t Size() const override { return point_count_.load(std::memory_order_relaxed); }
+
 private:
     size_t max_size_; ///< The maximum number of entries the cache can hold.
     std::list<std::string> usage_order_; ///< A list to keep track of the usage order of keys, implementing LRU eviction.
     std::unordered_map<std::string, std::vector<TimePoint>> time_data_;
-    std::mutex mutex_; ///< Mutex for thread-safe operations.
+    TimedMutex mutex_; ///< Mutex for thread-safe operations.
+    std::atomic<size_t> point_count_{0}; ///< Mirror of the number of points in `time_data_`, readable without the lock.
     std::shared_ptr<FileLogger> file_logger_;
 
     /**
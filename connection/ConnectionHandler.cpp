@@ -16,6 +16,8 @@
 #include "ICache.h"
 #include "IGeoCache.h"
 #include "ITimeSeriesCache.h"
+#include "IProbabilisticCache.h"
+#include "ICollectionCache.h"
 
 /**
  * @class ConnectionHandler
@@ -27,11 +29,15 @@ ConnectionHandler::ConnectionHandler(
     std::shared_ptr<ICache> cache,
     std::shared_ptr<IGeoCache> geo_cache,
     std::shared_ptr<ITimeSeriesCache> time_series_cache,
+    std::shared_ptr<IProbabilisticCache> probabilistic_cache,
+    std::shared_ptr<ICollectionCache> collection_cache,
     int client_fd,
     const std::string &secret_key)
     : cache_(std::move(cache)),
       geo_cache_(std::move(geo_cache)),
       time_series_cache_(std::move(time_series_cache)),
+      probabilistic_cache_(std::move(probabilistic_cache)),
+      collection_cache_(std::move(collection_cache)),
       client_fd_(client_fd),
       secret_key_(secret_key)
 {
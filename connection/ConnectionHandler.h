@@ -1,6 +1,7 @@
 #ifndef CONNECTIONHANDLER_H
 #define CONNECTIONHANDLER_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,6 +11,8 @@
 #include "ICache.h"
 #include "IGeoCache.h"
 #include "ITimeSeriesCache.h"
+#include "IProbabilisticCache.h"
+#include "ICollectionCache.h"
 
 /**
  * @class ConnectionHandler
@@ -25,6 +28,8 @@ public:
             std::shared_ptr<ICache> cache, 
             std::shared_ptr<IGeoCache> geo_cache, 
             std::shared_ptr<ITimeSeriesCache> time_series_cache, 
+            std::shared_ptr<IProbabilisticCache> probabilistic_cache,
+            std::shared_ptr<ICollectionCache> collection_cache,
             int client_fd, 
             const std::string &secret_key
     );
@@ -40,6 +45,8 @@ private:
     std::shared_ptr<ICache> cache_;           ///< A shared pointer to an `ICache` instance used for caching data.
     std::shared_ptr<IGeoCache> geo_cache_;           ///< A shared pointer to an `ICache` instance used for caching data.
     std::shared_ptr<ITimeSeriesCache> time_series_cache_; ///< A shared pointer to an `ICache` instance used for caching data.
+    std::shared_ptr<IProbabilisticCache> probabilistic_cache_; ///< A shared pointer to the cache of probabilistic data structures.
+    std::shared_ptr<ICollectionCache> collection_cache_; ///< A shared pointer to the cache of hashes, lists and sorted sets.
     int client_fd_;                           ///< The file descriptor for the client connection.
     std::string secret_key_;                  ///< The secret key used for verifying message signatures.
     std::shared_ptr<FileLogger> file_logger_; ///< A shared pointer to a `FileLogger` instance for logging connection activities.
@@ -62,8 +69,9 @@ private:
      *
      * @param message The message payload that needs to be processed.
      * @param response A reference to a string where the processed response will be stored.
+     * @param command Receives the name of the command the message held, used to label its latency.
      */
-    void ProcessMessage(const std::string &message, std::string &response);
+    void ProcessMessage(const std::string &message, std::string &response, std::string &command);
 
     /**
      * @brief Sends a response to the client over the socket.
@@ -73,6 +81,17 @@ private:
      * @param response The response message to be sent to the client.
      */
     void SendResponse(const std::string &response);
+
+    /**
+     * @brief Records a command in the slow log.
+     *
+     * Called once a command is known to have run for longer than the slow log's threshold.
+     *
+     * @param payload The message payload that held the command.
+     * @param duration_ns The command's latency from parsing to sending.
+     * @param lock_wait_ns The part of it spent waiting for contended cache locks.
+     */
+    void RecordSlowCommand(const std::string &payload, uint64_t duration_ns, uint64_t lock_wait_ns);
 };
 
 #endif // CONNECTIONHANDLER_H
\ No newline at end of file
@@ -6,12 +6,17 @@
 #include <string>
 #include <sstream>
 #include <memory>
+#include <chrono>
 
 #include "ConnectionHandler.h"
 #include "MessageProcessor.h"
 #include "HMACUtil.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
+#include "ServerStats.h"
+#include "LatencyTracker.h"
+#include "RequestTiming.h"
+#include "SlowLog.h"
 
 /**
  * @brief Handles the communication with the connected client.
@@ -23,13 +28,18 @@
  * 2. Accumulates the received data in a buffer.
  * 3. Extracts message length and processes messages once fully received.
  * 4. Verifies message signatures and processes valid messages.
- * 5. Sends appropriate responses to the client.
+ * 5. Sends appropriate responses to the client, recording the time from processing to sending per command and,
+ *    when stage timing is enabled, the time spent in each stage of the request. Commands over the slow log's
+ *    threshold are also recorded in the slow log.
  * 6. Logs errors and disconnections.
  */
 void ConnectionHandler::HandleClient()
 {
     LoggerManager::getInstance().info("Client connected");
 
+    ServerStats &stats = ServerStats::Instance();
+    stats.Add(Stat::kConnectedClients);
+
     std::vector<char> buffer;     ///< Buffer to accumulate incoming data from the client.
     uint32_t expected_length = 0; ///< Length of the next expected message (in bytes).
 
@@ -56,11 +66,16 @@ void ConnectionHandler::HandleClient()
             break; // Exit the loop when there is an error or the client disconnects.
         }
 
+        stats.Add(Stat::kNetInputBytes, static_cast<uint64_t>(bytes_received));
+
         // Append the received chunk of data to the buffer.
         buffer.insert(buffer.end(), chunk, chunk + bytes_received);
 
         while (!buffer.empty())
         {
+            // Time the stages of the request, if enabled; discarded unless the message is complete and valid
+            RequestTiming timing;
+
             // If the expected length of the message is not known, extract it from the buffer.
             if (expected_length == 0)
             {
@@ -94,15 +109,36 @@ void ConnectionHandler::HandleClient()
             // Extract the signature and payload from the message.
             std::string signature = message.substr(0, delimiter_pos);
             std::string payload = message.substr(delimiter_pos + 1);
+            timing.Stamp(Stage::kFraming);
 
             // Verify the signature of the payload to ensure its integrity.
-            if (VerifySignature(payload, signature))
+            bool verified = VerifySignature(payload, signature);
+            timing.Stamp(Stage::kVerify);
+            if (verified)
             {
+                auto start = std::chrono::steady_clock::now();
+
                 // Process the valid message and prepare a response.
                 std::string response;
-                ProcessMessage(payload, response);
+                std::string command;
+                ProcessMessage(payload, response, command);
                 // Send the response back to the client.
                 SendResponse(response);
+                timing.Stamp(Stage::kSend);
+
+                // Record the latency from parsing to sending under the command's name.
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                uint64_t elapsed_ns =
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+                LatencyTracker::Instance().Record(command, elapsed_ns);
+                if (SlowLog::Instance().IsSlow(elapsed_ns))
+                {
+                    RecordSlowCommand(payload, elapsed_ns, timing.LockWait());
+                }
+                if (timing.Active())
+                {
+                    LatencyTracker::Instance().RecordStages(command, timing.Durations());
+                }
             }
             else
             {
@@ -115,4 +151,5 @@ void ConnectionHandler::HandleClient()
 
     // Close the client connection once the communication loop ends.
     close(client_fd_);
+    stats.Subtract(Stat::kConnectedClients);
 }
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "HMACUtil.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
+#include "ServerStats.h"
 
 
 /**
@@ -21,11 +22,14 @@
  *
  * @param message The message payload that needs to be processed.
  * @param response A reference to a string where the processed response will be stored.
+ * @param command Receives the name of the command the message held, or "UNKNOWN".
  */
-void ConnectionHandler::ProcessMessage(const std::string &message, std::string &response)
+void ConnectionHandler::ProcessMessage(const std::string &message, std::string &response, std::string &command)
 {
     // Create a MessageProcessor instance to handle the message.
-    MessageProcessor processor(cache_, geo_cache_, time_series_cache_);
+    MessageProcessor processor(cache_, geo_cache_, time_series_cache_, probabilistic_cache_, collection_cache_);
     // Process the message and generate the response.
     processor.HandleMessage(message, response);
+    command = processor.Command();
+    ServerStats::Instance().Add(Stat::kCommandsProcessed);
 }
\ No newline at end of file
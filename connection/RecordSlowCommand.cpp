@@ -0,0 +1,68 @@
+#include <string>
+#include <vector>
+
+#include "ConnectionHandler.h"
+#include "CommandParser.h"
+#include "SlowLog.h"
+
+/**
+ * @brief Records a command in the slow log.
+ *
+ * Only called for commands over the slow log's threshold, so the payload is parsed a second time here rather than
+ * kept from the first parse for every command. Each argument is cut to 32 bytes and the text to
+ * `SlowLog::kTextBytes`; the slow log is meant to identify a command, not to replay it.
+ *
+ * @param payload The message payload that held the command.
+ * @param duration_ns The command's latency from parsing to sending.
+ * @param lock_wait_ns The part of it spent waiting for contended cache locks.
+ */
+void ConnectionHandler::RecordSlowCommand(const std::string &payload, uint64_t duration_ns, uint64_t lock_wait_ns)
+{
+    static constexpr size_t kMaxArgumentBytes = 32;
+
+    std::string text;
+    try
+    {
+        std::string input = payload;
+        CommandParser parser;
+        MESPObject obj = parser.parse(input);
+
+        std::vector<MESPObject> args = obj.type == MESPType::Array ? obj.arrayValue : std::vector<MESPObject>{obj};
+        for (const auto &arg : args)
+        {
+            std::string value;
+            if (arg.type == MESPType::Integer)
+            {
+                value = std::to_string(arg.intValue);
+            }
+            else if (arg.type == MESPType::Float)
+            {
+                value = std::to_string(arg.floatValue);
+            }
+            else if (arg.type == MESPType::Array)
+            {
+                value = "(array)";
+            }
+            else
+            {
+                value = arg.stringValue;
+            }
+            if (value.size() > kMaxArgumentBytes)
+            {
+                value = value.substr(0, kMaxArgumentBytes) + "...";
+            }
+
+            text += text.empty() ? value : " " + value;
+            if (text.size() >= SlowLog::kTextBytes)
+            {
+                break;
+            }
+        }
+    }
+    catch (const std::exception &)
+    {
+        text = "(unparsable)";
+    }
+
+    SlowLog::Instance().Record(text, duration_ns, lock_wait_ns, client_fd_);
+}
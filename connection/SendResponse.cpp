@@ -12,6 +12,7 @@
 #include "HMACUtil.h"
 #include "LoggerManager.h"
 #include "FileLogger.h"
+#include "ServerStats.h"
 
 /**
  * @brief Sends a response to the client over the socket.
@@ -25,7 +26,11 @@ void ConnectionHandler::SendResponse(const std::string &response)
     // Convert the length of the response to network byte order for transmission.
     uint32_t response_length = htonl(static_cast<uint32_t>(response.size()));
     // Send the length of the response.
-    send(client_fd_, &response_length, sizeof(response_length), 0);
+    ssize_t sent = send(client_fd_, &response_length, sizeof(response_length), 0);
     // Send the actual response data.
-    send(client_fd_, response.c_str(), response.size(), 0);
+    ssize_t body_sent = send(client_fd_, response.c_str(), response.size(), 0);
+
+    // Count what actually went out, not what failed to
+    uint64_t bytes = (sent > 0 ? sent : 0) + (body_sent > 0 ? body_sent : 0);
+    ServerStats::Instance().Add(Stat::kNetOutputBytes, bytes);
 }
\ No newline at end of file
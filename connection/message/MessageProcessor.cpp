@@ -7,6 +7,7 @@
 
 #include "GeoPoint.h"
 #include "CommandParser.h"
+#include "RequestTiming.h"
 
 /**
  * @brief Constructs a MessageProcessor object with a given cache.
@@ -15,14 +16,20 @@
  * This allows the MessageProcessor to interact with the cache for storing, retrieving, and deleting data.
  *
  * @param cache A shared pointer to an ICache object used for caching data.
+ * @param probabilistic_cache A shared pointer to the cache of Bloom filters, HyperLogLogs and count-min sketches.
+ * @param collection_cache A shared pointer to the cache of hashes, lists and sorted sets.
  */
 MessageProcessor::MessageProcessor(
     std::shared_ptr<ICache> cache,
     std::shared_ptr<IGeoCache> geo_cache,
-    std::shared_ptr<ITimeSeriesCache> time_series_cache
+    std::shared_ptr<ITimeSeriesCache> time_series_cache,
+    std::shared_ptr<IProbabilisticCache> probabilistic_cache,
+    std::shared_ptr<ICollectionCache> collection_cache
 ) : cache_(std::move(cache)),
     geo_cache_(std::move(geo_cache)),
-    time_series_cache_(std::move(time_series_cache)) {}
+    time_series_cache_(std::move(time_series_cache)),
+    probabilistic_cache_(std::move(probabilistic_cache)),
+    collection_cache_(std::move(collection_cache)) {}
 
 /**
  * @brief Handles an incoming message and generates an appropriate response.
@@ -40,8 +47,8 @@ void MessageProcessor::HandleMessage(const std::string &message, std::string &re
         std::string input = message; // Create a copy of the input message
         CommandParser parser;
         MESPObject MESPObject = parser.parse(input); // Parse the message
+        RequestTiming::StampCurrent(Stage::kParse);
 
-        
         // Handle the parsed RESP object
         HandleCommand(MESPObject, response);
     }
@@ -50,6 +57,13 @@ void MessageProcessor::HandleMessage(const std::string &message, std::string &re
         // Handle parsing or processing errors
         response = "ERROR: " + std::string(e.what());
     }
+    RequestTiming::StampCurrent(Stage::kExecute);
+
+    // Label unparsable messages and unknown commands alike, so clients cannot create arbitrary command names
+    if (command_.empty())
+    {
+        command_ = "UNKNOWN";
+    }
 }
 
 
@@ -79,6 +93,22 @@ void MessageProcessor::HandleMessage(const std::string &message, std::string &re
  *   - **Command Execution**:
  *     - **"SET" Command**: Delegates to `HandleSet` for handling the "SET" command.
  *     - **"GET" Command**: Delegates to `HandleGet` for handling the "GET" command.
+ *     - **Counter and in-place commands**: "INCR", "INCRBY", "DECR", "DECRBY", "INCRBYFLOAT", "APPEND" and "GETSET" delegate to their handlers.
+ *     - **"GETV" and "CAS" Commands**: Delegate to `HandleGetV` and `HandleCas` for versioned reads and writes.
+ *     - **"MGET", "MSET" and "MDEL" Commands**: Delegate to `HandleMGet`, `HandleMSet` and `HandleMDel` for batches of keys.
+ *     - **"SCAN" Command**: Delegates to `HandleScan` for cursor-based iteration over the keys.
+ *     - **"MEMORY" Command**: Delegates to `HandleMemory` for memory statistics.
+ *     - **"HOTKEYS" Command**: Delegates to `HandleHotKeys` for hot-key tracking.
+ *     - **"INFO" Command**: Delegates to `HandleInfo` for the server's operation counters.
+ *     - **"LATENCY" Command**: Delegates to `HandleLatency` for the per-command latency histograms.
+ *     - **"SLOWLOG" Command**: Delegates to `HandleSlowLog` for the log of commands slower than a threshold.
+ *     - **"KEYS" Command**: Delegates to `HandleKeys` for listing the keys matching a pattern.
+ *     - **"RANGE" Command**: Delegates to `HandleRange` for listing the keys between two bounds.
+ *     - **"DELPREFIX" Command**: Delegates to `HandleDelPrefix` for deleting the keys under a prefix.
+ *     - **Probabilistic commands**: "BF.RESERVE", "BF.ADD", "BF.EXISTS", "PFADD", "PFCOUNT", "PFMERGE", "CMS.INCRBY"
+ *       and "CMS.QUERY" delegate to their handlers, which use the probabilistic cache.
+ *     - **Collection commands**: "HSET", "HGET", "HDEL", "LPUSH", "RPUSH", "LPOP", "RPOP", "LRANGE", "ZADD", "ZREM"
+ *       and "ZRANGE" delegate to their handlers, which use the collection cache.
  *     - **Invalid Commands**: Calls `HandleInvalidCommand` for unknown commands or invalid formats.
  * - **Error Handling**: If the object type is not recognized or the format is invalid, it calls `HandleInvalidRespType` to generate an error response.
  */
@@ -87,6 +117,7 @@ void MessageProcessor::HandleCommand(const MESPObject &obj, std::string &respons
     // Handle SimpleString type
     if (obj.type == MESPType::SimpleString)
     {
+        command_ = "PING";
         HandlePing(response);
     }
     // Handle Array type
@@ -111,6 +142,7 @@ void MessageProcessor::HandleCommand(const MESPObject &obj, std::string &respons
 
         // Get the command string and delegate to appropriate handler
         std::string command = commandObj.stringValue;
+        command_ = command;
         if (command == "SET")
         {
             HandleSet(obj, response);
@@ -123,6 +155,78 @@ void MessageProcessor::HandleCommand(const MESPObject &obj, std::string &respons
         {
             HandleDelete(obj, response);
         }
+        else if (command == "INCR" || command == "INCRBY" || command == "DECR" || command == "DECRBY")
+        {
+            HandleIncrBy(obj, response);
+        }
+        else if (command == "INCRBYFLOAT")
+        {
+            HandleIncrByFloat(obj, response);
+        }
+        else if (command == "APPEND")
+        {
+            HandleAppend(obj, response);
+        }
+        else if (command == "GETSET")
+        {
+            HandleGetSet(obj, response);
+        }
+        else if (command == "GETV")
+        {
+            HandleGetV(obj, response);
+        }
+        else if (command == "CAS")
+        {
+            HandleCas(obj, response);
+        }
+        else if (command == "MGET")
+        {
+            HandleMGet(obj, response);
+        }
+        else if (command == "MSET")
+        {
+            HandleMSet(obj, response);
+        }
+        else if (command == "MDEL")
+        {
+            HandleMDel(obj, response);
+        }
+        else if (command == "SCAN")
+        {
+            HandleScan(obj, response);
+        }
+        else if (command == "MEMORY")
+        {
+            HandleMemory(obj, response);
+        }
+        else if (command == "HOTKEYS")
+        {
+            HandleHotKeys(obj, response);
+        }
+        else if (command == "INFO")
+        {
+            HandleInfo(obj, response);
+        }
+        else if (command == "LATENCY")
+        {
+            HandleLatency(obj, response);
+        }
+        else if (command == "SLOWLOG")
+        {
+            HandleSlowLog(obj, response);
+        }
+        else if (command == "KEYS")
+        {
+            HandleKeys(obj, response);
+        }
+        else if (command == "RANGE")
+        {
+            HandleRange(obj, response);
+        }
+        else if (command == "DELPREFIX")
+        {
+            HandleDelPrefix(obj, response);
+        }
         else if (command == "GEOSET")
         {
             HandleGeoSet(obj, response);
@@ -139,8 +243,77 @@ void MessageProcessor::HandleCommand(const MESPObject &obj, std::string &respons
         {
             HandleGeoPath(obj, response);
         }
+        else if (command == "BF.RESERVE")
+        {
+            HandleBfReserve(obj, response);
+        }
+        else if (command == "BF.ADD")
+        {
+            HandleBfAdd(obj, response);
+        }
+        else if (command == "BF.EXISTS")
+        {
+            HandleBfExists(obj, response);
+        }
+        else if (command == "PFADD")
+        {
+            HandlePfAdd(obj, response);
+        }
+        else if (command == "PFCOUNT")
+        {
+            HandlePfCount(obj, response);
+        }
+        else if (command == "PFMERGE")
+        {
+            HandlePfMerge(obj, response);
+        }
+        else if (command == "CMS.INCRBY")
+        {
+            HandleCmsIncrBy(obj, response);
+        }
+        else if (command == "CMS.QUERY")
+        {
+            HandleCmsQuery(obj, response);
+        }
+        else if (command == "HSET")
+        {
+            HandleHSet(obj, response);
+        }
+        else if (command == "HGET")
+        {
+            HandleHGet(obj, response);
+        }
+        else if (command == "HDEL")
+        {
+            HandleHDel(obj, response);
+        }
+        else if (command == "LPUSH" || command == "RPUSH")
+        {
+            HandleListPush(obj, response, command == "LPUSH");
+        }
+        else if (command == "LPOP" || command == "RPOP")
+        {
+            HandleListPop(obj, response, command == "LPOP");
+        }
+        else if (command == "LRANGE")
+        {
+            HandleLRange(obj, response);
+        }
+        else if (command == "ZADD")
+        {
+            HandleZAdd(obj, response);
+        }
+        else if (command == "ZREM")
+        {
+            HandleZRem(obj, response);
+        }
+        else if (command == "ZRANGE")
+        {
+            HandleZRange(obj, response);
+        }
         else
         {
+            command_.clear();
             HandleInvalidCommand(response);
         }
     }
@@ -9,6 +9,8 @@
 #include <ICache.h>
 #include <IGeoCache.h>
 #include <ITimeSeriesCache.h>
+#include <IProbabilisticCache.h>
+#include <ICollectionCache.h>
 
 #include "CommandParser.h"
 
@@ -30,11 +32,15 @@ public:
      * This allows the MessageProcessor to use the cache for storing, retrieving, and managing data.
      *
      * @param cache A shared pointer to an ICache object used for caching purposes.
+     * @param probabilistic_cache A shared pointer to the cache of Bloom filters, HyperLogLogs and count-min sketches.
+     * @param collection_cache A shared pointer to the cache of hashes, lists and sorted sets.
      */
     explicit MessageProcessor(
         std::shared_ptr<ICache> cache,
         std::shared_ptr<IGeoCache> geo_cache,
-        std::shared_ptr<ITimeSeriesCache> time_series_cache);
+        std::shared_ptr<ITimeSeriesCache> time_series_cache,
+        std::shared_ptr<IProbabilisticCache> probabilistic_cache,
+        std::shared_ptr<ICollectionCache> collection_cache);
 
     /**
      * @brief Processes an incoming message and generates a response.
@@ -47,10 +53,20 @@ public:
      */
     void HandleMessage(const std::string &message, std::string &response);
 
+    /**
+     * @brief Returns the name of the command the last message held.
+     *
+     * @return The command, such as "GET", or "UNKNOWN" if the message could not be parsed or named no known command.
+     */
+    const std::string &Command() const { return command_; }
+
 private:
     std::shared_ptr<ICache> cache_; /**< Shared pointer to an ICache object for managing cached data. */
     std::shared_ptr<IGeoCache> geo_cache_; /**< Shared pointer to an IGeoCache object for managing cached data. */
     std::shared_ptr<ITimeSeriesCache> time_series_cache_; /**< Shared pointer to an IGeoCache object for managing cached data. */
+    std::shared_ptr<IProbabilisticCache> probabilistic_cache_; /**< Shared pointer to the cache of probabilistic data structures. */
+    std::shared_ptr<ICollectionCache> collection_cache_; /**< Shared pointer to the cache of hashes, lists and sorted sets. */
+    std::string command_; /**< The name of the command being handled, used to label its latency. */
 
     /**
      * @brief Processes the parsed RESP object and handles the specific command.
@@ -117,6 +133,183 @@ private:
      */
     void HandleDelete(const MESPObject &obj, std::string &response);
 
+    /**
+     * @brief Handles the "INCR", "INCRBY", "DECR" and "DECRBY" commands.
+     *
+     * Adds to an integer value in place in the cache; a missing key counts from 0.
+     *
+     * @param obj The parsed RESP object containing the command, the key and, for the BY forms, the delta.
+     * @param response The response string to be set to the new value.
+     */
+    void HandleIncrBy(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "INCRBYFLOAT" command.
+     *
+     * Adds to a floating-point value in the cache; a missing key counts from 0.
+     *
+     * @param obj The parsed RESP object containing the INCRBYFLOAT command, the key and the delta.
+     * @param response The response string to be set to the new value.
+     */
+    void HandleIncrByFloat(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "APPEND" command.
+     *
+     * Appends to a value in place in the cache; a missing key is created.
+     *
+     * @param obj The parsed RESP object containing the APPEND command, the key and the suffix.
+     * @param response The response string to be set to the new length of the value.
+     */
+    void HandleAppend(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "GETSET" command.
+     *
+     * Replaces a value in the cache and returns the previous one.
+     *
+     * @param obj The parsed RESP object containing the GETSET command, the key and the new value.
+     * @param response The response string to be set to the previous value or "NOT FOUND".
+     */
+    void HandleGetSet(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "GETV" command.
+     *
+     * Retrieves a value together with its entry's version, for a later "CAS".
+     *
+     * @param obj The parsed MESP object containing the GETV command and the key.
+     * @param response The response string to be set to the value and version, or "NOT FOUND".
+     */
+    void HandleGetV(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "CAS" command.
+     *
+     * Stores a value only if its entry still has the version the client read.
+     *
+     * @param obj The parsed MESP object containing the CAS command, the key, the value, the version and an
+     *            optional duration.
+     * @param response The response string to be set to the new version, "CONFLICT" or "NOT FOUND".
+     */
+    void HandleCas(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "MGET" command.
+     *
+     * Retrieves the values of several keys under a single cache lock acquisition.
+     *
+     * @param obj The parsed RESP object containing the MGET command and its keys.
+     * @param response The response string to be set to an array of values or "NOT FOUND", one per key.
+     */
+    void HandleMGet(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "MSET" command.
+     *
+     * Stores several key-value pairs, each with its own duration, under a single cache lock acquisition.
+     *
+     * @param obj The parsed RESP object containing the MSET command and its key-value-duration triples.
+     * @param response The response string to be set to an array of "SUCCESS", one per pair.
+     */
+    void HandleMSet(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "MDEL" command.
+     *
+     * Deletes several keys under a single cache lock acquisition.
+     *
+     * @param obj The parsed RESP object containing the MDEL command and its keys.
+     * @param response The response string to be set to an array of "SUCCESS" or "NOT FOUND", one per key.
+     */
+    void HandleMDel(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "SCAN" command.
+     *
+     * Returns the next keys of a cursor-based iteration over the keyspace, optionally filtered by a glob pattern.
+     *
+     * @param obj The parsed RESP object containing the SCAN command, the cursor and the MATCH and COUNT options.
+     * @param response The response string to be set to the next cursor and the keys found.
+     */
+    void HandleScan(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "MEMORY" command.
+     *
+     * Reports the cache's memory accounting ("MEMORY STATS"), the bytes accounted to one key
+     * ("MEMORY USAGE <key>") or the slab allocator's size classes ("MEMORY SLABS").
+     *
+     * @param obj The parsed RESP object containing the MEMORY command and its arguments.
+     * @param response The response string to be set to the statistics, the key's usage or "NOT FOUND".
+     */
+    void HandleMemory(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "HOTKEYS" command.
+     *
+     * Reports the most frequently accessed keys ("HOTKEYS [count]"), reads or sets the access sample rate
+     * ("HOTKEYS SAMPLE [rate]") or forgets the counts so far ("HOTKEYS RESET").
+     *
+     * @param obj The parsed RESP object containing the HOTKEYS command and its arguments.
+     * @param response The response string to be set to the hot keys, the sample rate or "SUCCESS".
+     */
+    void HandleHotKeys(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "INFO" command.
+     *
+     * Reports the server's uptime and operation counters, read without taking any cache lock.
+     *
+     * @param obj The parsed RESP object containing the INFO command.
+     * @param response The response string to be set to the counters.
+     */
+    void HandleInfo(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "LATENCY" command.
+     *
+     * Reports, queries or resets the per-command latency histograms.
+     *
+     * @param obj The parsed RESP object containing the LATENCY command and its arguments.
+     * @param response The response string to be set to the latencies.
+     */
+    void HandleLatency(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "SLOWLOG" command.
+     *
+     * Reads, resets or configures the log of commands slower than a threshold.
+     *
+     * @param obj The parsed RESP object containing the SLOWLOG command and its arguments.
+     * @param response The response string to be set to the slow commands.
+     */
+    void HandleSlowLog(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "KEYS" command.
+     *
+     * @param obj The parsed RESP object containing the KEYS command and a glob-style pattern.
+     * @param response The response string to be set to the matching keys.
+     */
+    void HandleKeys(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "RANGE" command.
+     *
+     * @param obj The parsed RESP object containing the RANGE command, the bounds and the LIMIT option.
+     * @param response The response string to be set to the keys in the range, in key order.
+     */
+    void HandleRange(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "DELPREFIX" command.
+     *
+     * @param obj The parsed RESP object containing the DELPREFIX command and the prefix.
+     * @param response The response string to be set to the number of keys deleted.
+     */
+    void HandleDelPrefix(const MESPObject &obj, std::string &response);
+
 
 
 
@@ -171,6 +364,144 @@ private:
      */
     void HandleGeoPath(const MESPObject &obj, std::string &response);
 
+    /**
+     * @brief Handles the "BF.RESERVE" command by creating a Bloom filter for an expected number of items.
+     *
+     * @param obj The parsed MESP object containing the BF.RESERVE command, the key and the capacity.
+     * @param response The response string to be set to "SUCCESS" or "ALREADY EXISTS".
+     */
+    void HandleBfReserve(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "BF.ADD" command by adding an item to a Bloom filter.
+     *
+     * @param obj The parsed MESP object containing the BF.ADD command, the key and the item.
+     * @param response The response string to be set to 1 if the item is new, otherwise 0.
+     */
+    void HandleBfAdd(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "BF.EXISTS" command by checking an item against a Bloom filter.
+     *
+     * @param obj The parsed MESP object containing the BF.EXISTS command, the key and the item.
+     * @param response The response string to be set to 1 if the item may have been added, otherwise 0.
+     */
+    void HandleBfExists(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "PFADD" command by adding elements to a HyperLogLog.
+     *
+     * @param obj The parsed MESP object containing the PFADD command, the key and the elements.
+     * @param response The response string to be set to 1 if the estimate may have changed, otherwise 0.
+     */
+    void HandlePfAdd(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "PFCOUNT" command by estimating the distinct elements of HyperLogLogs.
+     *
+     * @param obj The parsed MESP object containing the PFCOUNT command and the keys.
+     * @param response The response string to be set to the estimated cardinality of their union.
+     */
+    void HandlePfCount(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "PFMERGE" command by merging HyperLogLogs into another one.
+     *
+     * @param obj The parsed MESP object containing the PFMERGE command, the destination and the sources.
+     * @param response The response string to be set to "SUCCESS".
+     */
+    void HandlePfMerge(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "CMS.INCRBY" command by adding to item counts in a count-min sketch.
+     *
+     * @param obj The parsed MESP object containing the CMS.INCRBY command, the key and item/increment pairs.
+     * @param response The response string to be set to the items' estimated counts.
+     */
+    void HandleCmsIncrBy(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "CMS.QUERY" command by estimating item counts in a count-min sketch.
+     *
+     * @param obj The parsed MESP object containing the CMS.QUERY command, the key and the items.
+     * @param response The response string to be set to the items' estimated counts.
+     */
+    void HandleCmsQuery(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "HSET" command by setting fields of a hash.
+     *
+     * @param obj The parsed MESP object containing the HSET command, the key and field/value pairs.
+     * @param response The response string to be set to the number of new fields.
+     */
+    void HandleHSet(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "HGET" command by reading one field of a hash.
+     *
+     * @param obj The parsed MESP object containing the HGET command, the key and the field.
+     * @param response The response string to be set to the field's value or "NOT FOUND".
+     */
+    void HandleHGet(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "HDEL" command by erasing fields of a hash.
+     *
+     * @param obj The parsed MESP object containing the HDEL command, the key and the fields.
+     * @param response The response string to be set to the number of fields erased.
+     */
+    void HandleHDel(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "LPUSH" and "RPUSH" commands by pushing elements to one end of a list.
+     *
+     * @param obj The parsed MESP object containing the command, the key and the elements.
+     * @param response The response string to be set to the list's new length.
+     * @param front `true` to push to the front, `false` to push to the back.
+     */
+    void HandleListPush(const MESPObject &obj, std::string &response, bool front);
+
+    /**
+     * @brief Handles the "LPOP" and "RPOP" commands by removing elements from one end of a list.
+     *
+     * @param obj The parsed MESP object containing the command, the key and an optional count.
+     * @param response The response string to be set to the removed element or elements.
+     * @param front `true` to pop from the front, `false` to pop from the back.
+     */
+    void HandleListPop(const MESPObject &obj, std::string &response, bool front);
+
+    /**
+     * @brief Handles the "LRANGE" command by reading the elements of a list between two indexes.
+     *
+     * @param obj The parsed MESP object containing the LRANGE command, the key and the indexes.
+     * @param response The response string to be set to the elements.
+     */
+    void HandleLRange(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "ZADD" command by adding members to a sorted set.
+     *
+     * @param obj The parsed MESP object containing the ZADD command, the key and score/member pairs.
+     * @param response The response string to be set to the number of new members.
+     */
+    void HandleZAdd(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "ZREM" command by removing members from a sorted set.
+     *
+     * @param obj The parsed MESP object containing the ZREM command, the key and the members.
+     * @param response The response string to be set to the number of members removed.
+     */
+    void HandleZRem(const MESPObject &obj, std::string &response);
+
+    /**
+     * @brief Handles the "ZRANGE" command by reading the members of a sorted set between two ranks.
+     *
+     * @param obj The parsed MESP object containing the ZRANGE command, the key, the ranks and an optional WITHSCORES.
+     * @param response The response string to be set to the members, and their scores if requested.
+     */
+    void HandleZRange(const MESPObject &obj, std::string &response);
+
 
 
 
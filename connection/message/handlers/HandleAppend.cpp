@@ -0,0 +1,27 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "APPEND" command by appending to a value in place in the cache.
+ *
+ * The expected command format is "APPEND key suffix", where both are `BulkString`s. A missing key is created with
+ * the value `suffix`. The reply is the length of the value after the append as an `Integer`.
+ *
+ * @param obj The parsed MESP object containing the APPEND command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleAppend(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and the suffix, both of type BulkString
+    if (obj.arrayValue.size() != 3 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    size_t length = cache_->Append(obj.arrayValue[1].stringValue, obj.arrayValue[2].stringValue);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(length));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,50 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "CAS" command by storing a value only if its entry still has the expected version.
+ *
+ * The expected command format is "CAS key value version [duration]", where the key and value are `BulkString`s,
+ * the version is a non-negative `Integer` read by "GETV", or 0 to store only if the key does not exist, and the
+ * optional duration is a TTL in seconds as for "SET". The reply is the entry's new version as an `Integer` on
+ * success, "CONFLICT" if another write got there first, or "NOT FOUND" if the key does not exist.
+ *
+ * @param obj The parsed MESP object containing the CAS command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleCas(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key, the value, the version and an optional duration
+    if (obj.arrayValue.size() < 4 || obj.arrayValue.size() > 5 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::BulkString || obj.arrayValue[3].type != MESPType::Integer ||
+        obj.arrayValue[3].intValue < 0 ||
+        (obj.arrayValue.size() == 5 &&
+         (obj.arrayValue[4].type != MESPType::Integer || obj.arrayValue[4].intValue < 0)))
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::chrono::seconds duration(obj.arrayValue.size() == 5 ? obj.arrayValue[4].intValue : 0);
+    uint64_t new_version = 0;
+    CasResult result = cache_->CompareAndSet(obj.arrayValue[1].stringValue,
+                                             obj.arrayValue[2].stringValue,
+                                             static_cast<uint64_t>(obj.arrayValue[3].intValue),
+                                             duration,
+                                             new_version);
+
+    MESPObject resObj;
+    switch (result)
+    {
+    case CasResult::kStored:
+        resObj = MESPObject(MESPType::Integer, static_cast<long long>(new_version));
+        break;
+    case CasResult::kConflict:
+        resObj = MESPObject(MESPType::SimpleString, "CONFLICT");
+        break;
+    default:
+        resObj = MESPObject(MESPType::BulkString, "NOT FOUND");
+        break;
+    }
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,26 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "DELPREFIX" command by deleting every key starting with a prefix.
+ *
+ * The expected command format is "DELPREFIX prefix", where `prefix` is a `BulkString`. The reply is the number of
+ * keys deleted as an `Integer`. Requires the ordered index; otherwise the reply is an error.
+ *
+ * @param obj The parsed MESP object containing the DELPREFIX command and its prefix.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleDelPrefix(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains exactly the prefix
+    if (obj.arrayValue.size() != 2 || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    size_t deleted = cache_->DeletePrefix(obj.arrayValue[1].stringValue);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(deleted));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -38,13 +38,14 @@ void MessageProcessor::HandleGet(const MESPObject &obj, std::string &response)
     if (keyObj.type == MESPType::BulkString)
     {
         std::string key = keyObj.stringValue;
-        std::string value;
+        CacheValue value;
 
-        // Retrieve the value associated with the key from the cache
+        // Retrieve a handle to the value associated with the key from the cache; it is copied into the reply
+        // outside the cache lock
         if (cache_->Get(key, value))
         {
             // Create a MESPObject with the retrieved value and serialize it
-            MESPObject resObj(MESPType::BulkString, value);
+            MESPObject resObj(MESPType::BulkString, std::string(value.View()));
             std::string serializedResponse = CommandParser::serializeResponse(resObj);
             response = serializedResponse;
             return;
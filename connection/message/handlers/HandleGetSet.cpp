@@ -0,0 +1,28 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "GETSET" command by replacing a value in the cache and returning the previous one.
+ *
+ * The expected command format is "GETSET key value", where both are `BulkString`s. The key no longer expires
+ * afterwards. The reply is the previous value, or "NOT FOUND" if the key did not exist.
+ *
+ * @param obj The parsed MESP object containing the GETSET command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleGetSet(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and the value, both of type BulkString
+    if (obj.arrayValue.size() != 3 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::string old_value;
+    bool existed = cache_->GetSet(obj.arrayValue[1].stringValue, obj.arrayValue[2].stringValue, old_value);
+
+    MESPObject resObj(MESPType::BulkString, existed ? old_value : "NOT FOUND");
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,36 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "GETV" command by retrieving a value together with its entry's version.
+ *
+ * The expected command format is "GETV key", where the key is a `BulkString`. The reply is an array of the value
+ * as a `BulkString` and the version as an `Integer`, to be passed back to "CAS"; or "NOT FOUND", like "GET", if the
+ * key does not exist.
+ *
+ * @param obj The parsed MESP object containing the GETV command and the key.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleGetV(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains exactly the key, of type BulkString
+    if (obj.arrayValue.size() != 2 || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    CacheValue value;
+    uint64_t version;
+    if (!cache_->GetVersioned(obj.arrayValue[1].stringValue, value, version))
+    {
+        MESPObject resObj(MESPType::BulkString, "NOT FOUND");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    std::vector<MESPObject> results = {MESPObject(MESPType::BulkString, std::string(value.View())),
+                                       MESPObject(MESPType::Integer, static_cast<long long>(version))};
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,84 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the hot-key tracking command.
+ *
+ * The expected command formats are:
+ *  - "HOTKEYS" or "HOTKEYS <count>": replies with an array of key/count pairs for the most frequently accessed
+ *    keys, by decreasing estimated access count. `count` is a positive `Integer` and defaults to 10. The reply is
+ *    empty while tracking is disabled.
+ *  - "HOTKEYS SAMPLE": replies with the sample rate as an `Integer`, 0 if tracking is disabled.
+ *  - "HOTKEYS SAMPLE <rate>": counts one access in `rate` from now on, 0 disabling tracking, forgets the counts so
+ *    far and replies "SUCCESS".
+ *  - "HOTKEYS RESET": forgets the counts so far and replies "SUCCESS".
+ *
+ * @param obj The parsed MESP object containing the HOTKEYS command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleHotKeys(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains between one and three elements
+    if (obj.arrayValue.size() > 3)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    if (obj.arrayValue.size() <= 2 && (obj.arrayValue.size() == 1 || obj.arrayValue[1].type == MESPType::Integer))
+    {
+        long long count = obj.arrayValue.size() == 2 ? obj.arrayValue[1].intValue : 10;
+        if (count <= 0)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+
+        std::vector<MESPObject> fields;
+        for (const auto &hot : cache_->HotKeys(static_cast<size_t>(count)))
+        {
+            fields.emplace_back(MESPType::BulkString, hot.key);
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(hot.count));
+        }
+
+        MESPObject resObj(MESPType::Array, fields);
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+    const std::string &subcommand = obj.arrayValue[1].stringValue;
+
+    if (subcommand == "SAMPLE" && obj.arrayValue.size() == 2)
+    {
+        MESPObject resObj(MESPType::Integer, static_cast<long long>(cache_->HotKeysSampleRate()));
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "SAMPLE" && obj.arrayValue[2].type == MESPType::Integer && obj.arrayValue[2].intValue >= 0 &&
+        obj.arrayValue[2].intValue <= UINT32_MAX)
+    {
+        cache_->ConfigureHotKeys(static_cast<uint32_t>(obj.arrayValue[2].intValue));
+
+        MESPObject resObj(MESPType::BulkString, "SUCCESS");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "RESET" && obj.arrayValue.size() == 2)
+    {
+        cache_->ResetHotKeys();
+
+        MESPObject resObj(MESPType::BulkString, "SUCCESS");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    // Handle invalid command format for unknown subcommands or arguments
+    HandleInvalidCommandFormat(response);
+}
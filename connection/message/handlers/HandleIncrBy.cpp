@@ -0,0 +1,56 @@
+#include "MessageProcessor.h"
+#include <iostream>
+#include <limits>
+
+/**
+ * @brief Handles the integer counter commands by updating the value in place in the cache.
+ *
+ * The expected command formats are:
+ *  - "INCR key" and "DECR key": add 1 or -1.
+ *  - "INCRBY key delta" and "DECRBY key delta": add `delta` or its negation, where `delta` is an `Integer`.
+ *
+ * A missing key counts from 0. The reply is the new value as an `Integer`. A value that is not an integer or an
+ * overflowing result is reported as an error by the cache.
+ *
+ * @param obj The parsed MESP object containing the command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleIncrBy(const MESPObject &obj, std::string &response)
+{
+    const std::string &command = obj.arrayValue[0].stringValue;
+    bool by = command == "INCRBY" || command == "DECRBY";
+
+    // Check the argument count and that the key is of type BulkString
+    if (obj.arrayValue.size() != (by ? 3u : 2u) || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    long long delta = 1;
+    if (by)
+    {
+        if (obj.arrayValue[2].type != MESPType::Integer)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        delta = obj.arrayValue[2].intValue;
+    }
+
+    if (command[0] == 'D')
+    {
+        // The negation of the smallest integer does not fit
+        if (delta == std::numeric_limits<long long>::min())
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        delta = -delta;
+    }
+
+    int64_t value = cache_->IncrBy(obj.arrayValue[1].stringValue, delta);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(value));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,61 @@
+#include "MessageProcessor.h"
+#include <charconv>
+#include <cmath>
+#include <iostream>
+
+/**
+ * @brief Handles the "INCRBYFLOAT" command by adding to a floating-point value in the cache.
+ *
+ * The expected command format is "INCRBYFLOAT key delta", where `delta` is an `Integer`, a `Float`, or a
+ * `BulkString` holding a decimal number; the latter keeps full double precision, which the `Float` type does not.
+ * A missing key counts from 0. The reply is the new value as a `BulkString`.
+ *
+ * @param obj The parsed MESP object containing the INCRBYFLOAT command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleIncrByFloat(const MESPObject &obj, std::string &response)
+{
+    // Check the argument count and that the key is of type BulkString
+    if (obj.arrayValue.size() != 3 || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    const MESPObject &deltaObj = obj.arrayValue[2];
+    double delta;
+    if (deltaObj.type == MESPType::Integer)
+    {
+        delta = static_cast<double>(deltaObj.intValue);
+    }
+    else if (deltaObj.type == MESPType::Float)
+    {
+        delta = deltaObj.floatValue;
+    }
+    else if (deltaObj.type == MESPType::BulkString)
+    {
+        const std::string &text = deltaObj.stringValue;
+        auto parsed = std::from_chars(text.data(), text.data() + text.size(), delta);
+        if (text.empty() || parsed.ec != std::errc() || parsed.ptr != text.data() + text.size())
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+    }
+    else
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    if (!std::isfinite(delta))
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::string value = cache_->IncrByFloat(obj.arrayValue[1].stringValue, delta);
+
+    MESPObject resObj(MESPType::BulkString, value);
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,39 @@
+#include "MessageProcessor.h"
+#include "ServerStats.h"
+
+/**
+ * @brief Handles the server statistics command.
+ *
+ * The expected command format is "INFO". The reply is an array of name/value pairs: the uptime in seconds, then
+ * every counter of `ServerStats` in the order of `Stat`, such as "keyspace_hits", "keyspace_misses",
+ * "evicted_keys", "expired_keys", "connected_clients" and "total_net_input_bytes". The counters are summed from
+ * their shards without taking any cache lock, so INFO can be polled while the caches are under load. The hit ratio
+ * is keyspace_hits / (keyspace_hits + keyspace_misses).
+ *
+ * @param obj The parsed MESP object containing the INFO command.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleInfo(const MESPObject &obj, std::string &response)
+{
+    // Check if the command has no arguments
+    if (obj.arrayValue.size() != 1)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    ServerStats &stats = ServerStats::Instance();
+
+    std::vector<MESPObject> fields;
+    fields.emplace_back(MESPType::BulkString, "uptime_in_seconds");
+    fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.UptimeSeconds()));
+    for (size_t i = 0; i < static_cast<size_t>(Stat::kCount); ++i)
+    {
+        Stat stat = static_cast<Stat>(i);
+        fields.emplace_back(MESPType::BulkString, ServerStats::Name(stat));
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.Load(stat)));
+    }
+
+    MESPObject resObj(MESPType::Array, fields);
+    response = CommandParser::serializeResponse(resObj);
+}
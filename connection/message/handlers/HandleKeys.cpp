@@ -0,0 +1,36 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "KEYS" command by returning every key matching a pattern.
+ *
+ * The expected command format is "KEYS pattern", where `pattern` is a glob-style `BulkString`. The reply is an
+ * array of the matching keys, in key order if the ordered index is enabled. With the ordered index, a pattern with
+ * a literal prefix such as "tenant:123:*" only visits the keys under that prefix.
+ *
+ * @param obj The parsed MESP object containing the KEYS command and its pattern.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleKeys(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains exactly the pattern
+    if (obj.arrayValue.size() != 2 || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    const std::string &pattern = obj.arrayValue[1].stringValue;
+    std::vector<std::string> keys;
+    cache_->Keys(pattern == "*" ? std::string() : pattern, keys);
+
+    std::vector<MESPObject> keyObjs;
+    keyObjs.reserve(keys.size());
+    for (const auto &key : keys)
+    {
+        keyObjs.emplace_back(MESPType::BulkString, key);
+    }
+
+    MESPObject resObj(MESPType::Array, keyObjs);
+    response = CommandParser::serializeResponse(resObj);
+}
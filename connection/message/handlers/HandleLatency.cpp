@@ -0,0 +1,227 @@
+#include "MessageProcessor.h"
+#include "LatencyTracker.h"
+#include "LoggerManager.h"
+#include <charconv>
+#include <cmath>
+
+namespace
+{
+    /**
+     * @brief Reads a percentile argument given as an `Integer`, a `Float` or a `BulkString` such as "99.9".
+     *
+     * @return `true` if the argument is a number from 0 to 100.
+     */
+    bool ParsePercentile(const MESPObject &arg, double &percentile)
+    {
+        if (arg.type == MESPType::Integer)
+        {
+            percentile = static_cast<double>(arg.intValue);
+        }
+        else if (arg.type == MESPType::Float)
+        {
+            percentile = arg.floatValue;
+        }
+        else if (arg.type == MESPType::BulkString)
+        {
+            const std::string &text = arg.stringValue;
+            auto parsed = std::from_chars(text.data(), text.data() + text.size(), percentile);
+            if (text.empty() || parsed.ec != std::errc() || parsed.ptr != text.data() + text.size())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+        return std::isfinite(percentile) && percentile >= 0.0 && percentile <= 100.0;
+    }
+}
+
+/**
+ * @brief Handles the command latency command.
+ *
+ * Latencies run from the parsing of a request to the sending of its response, in nanoseconds, and are kept per
+ * command name; unparsable requests and unknown commands are counted as "UNKNOWN". The expected command formats are:
+ *  - "LATENCY" or "LATENCY STATS": replies with one array per command run since the last reset, holding the command
+ *    name followed by name/value pairs for the number of calls, the 50th, 99th and 99.9th percentiles, the maximum
+ *    and the mean.
+ *  - "LATENCY PERCENTILE <command> <percentile> [<percentile> ...]": replies with an array holding the latency at
+ *    each percentile, from 0 to 100 and given as an `Integer`, a `Float` or a `BulkString`, or "NOT FOUND" if the
+ *    command never ran.
+ *  - "LATENCY RESET" or "LATENCY RESET <command>": forgets the latencies and stage times so far, of every command
+ *    or of one, and replies "SUCCESS", or "NOT FOUND" if the command never ran.
+ *  - "LATENCY STAGES": replies with one array per command timed since the last reset, holding the command name
+ *    followed by the number of requests timed and, for each stage (see `Stage`), the mean nanoseconds spent in it,
+ *    such as "verify_ns" for the HMAC check or "lock_wait_ns" for waits on contended cache locks.
+ *  - "LATENCY TIMING": replies "ON" or "OFF", whether stage timing is enabled.
+ *  - "LATENCY TIMING ON|OFF": enables or disables stage timing for the requests that start from now on and replies
+ *    "SUCCESS".
+ *  - "LATENCY DUMP": writes the stage breakdown to the log, one line per command, and replies with the number of
+ *    lines written.
+ *
+ * @param obj The parsed MESP object containing the LATENCY command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleLatency(const MESPObject &obj, std::string &response)
+{
+    std::string subcommand = "STATS";
+    if (obj.arrayValue.size() > 1)
+    {
+        if (obj.arrayValue[1].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        subcommand = obj.arrayValue[1].stringValue;
+    }
+
+    LatencyTracker &tracker = LatencyTracker::Instance();
+
+    if (subcommand == "STATS" && obj.arrayValue.size() <= 2)
+    {
+        std::vector<MESPObject> commands;
+        for (const auto &entry : tracker.Snapshot())
+        {
+            const LatencySnapshot &latency = entry.second;
+
+            std::vector<MESPObject> fields;
+            fields.emplace_back(MESPType::BulkString, entry.first);
+            fields.emplace_back(MESPType::BulkString, "calls");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(latency.count));
+            fields.emplace_back(MESPType::BulkString, "p50_ns");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(latency.ValueAtPercentile(50.0)));
+            fields.emplace_back(MESPType::BulkString, "p99_ns");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(latency.ValueAtPercentile(99.0)));
+            fields.emplace_back(MESPType::BulkString, "p999_ns");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(latency.ValueAtPercentile(99.9)));
+            fields.emplace_back(MESPType::BulkString, "max_ns");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(latency.max));
+            fields.emplace_back(MESPType::BulkString, "mean_ns");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(latency.Mean()));
+            commands.emplace_back(MESPType::Array, fields);
+        }
+
+        MESPObject resObj(MESPType::Array, commands);
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "PERCENTILE" && obj.arrayValue.size() >= 4 && obj.arrayValue[2].type == MESPType::BulkString)
+    {
+        std::vector<double> percentiles(obj.arrayValue.size() - 3);
+        for (size_t i = 3; i < obj.arrayValue.size(); ++i)
+        {
+            if (!ParsePercentile(obj.arrayValue[i], percentiles[i - 3]))
+            {
+                HandleInvalidCommandFormat(response);
+                return;
+            }
+        }
+
+        LatencySnapshot latency;
+        if (!tracker.Snapshot(obj.arrayValue[2].stringValue, latency))
+        {
+            MESPObject resObj(MESPType::BulkString, "NOT FOUND");
+            response = CommandParser::serializeResponse(resObj);
+            return;
+        }
+
+        std::vector<MESPObject> values;
+        for (double percentile : percentiles)
+        {
+            values.emplace_back(MESPType::Integer, static_cast<long long>(latency.ValueAtPercentile(percentile)));
+        }
+
+        MESPObject resObj(MESPType::Array, values);
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "RESET" && obj.arrayValue.size() <= 3)
+    {
+        bool found = true;
+        if (obj.arrayValue.size() == 2)
+        {
+            tracker.Reset();
+        }
+        else if (obj.arrayValue[2].type == MESPType::BulkString)
+        {
+            found = tracker.Reset(obj.arrayValue[2].stringValue);
+        }
+        else
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+
+        MESPObject resObj(MESPType::BulkString, found ? "SUCCESS" : "NOT FOUND");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "STAGES" && obj.arrayValue.size() == 2)
+    {
+        std::vector<MESPObject> commands;
+        for (const auto &entry : tracker.Stages())
+        {
+            const StageBreakdown &breakdown = entry.second;
+
+            std::vector<MESPObject> fields;
+            fields.emplace_back(MESPType::BulkString, entry.first);
+            fields.emplace_back(MESPType::BulkString, "requests");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(breakdown.requests));
+            for (size_t i = 0; i < RequestTiming::kStages; ++i)
+            {
+                fields.emplace_back(MESPType::BulkString,
+                                    std::string(RequestTiming::Name(static_cast<Stage>(i))) + "_ns");
+                fields.emplace_back(MESPType::Integer,
+                                    static_cast<long long>(breakdown.nanoseconds[i] / breakdown.requests));
+            }
+            commands.emplace_back(MESPType::Array, fields);
+        }
+
+        MESPObject resObj(MESPType::Array, commands);
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "TIMING" && obj.arrayValue.size() == 2)
+    {
+        MESPObject resObj(MESPType::BulkString, RequestTiming::Enabled() ? "ON" : "OFF");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "TIMING" && obj.arrayValue.size() == 3 && obj.arrayValue[2].type == MESPType::BulkString &&
+        (obj.arrayValue[2].stringValue == "ON" || obj.arrayValue[2].stringValue == "OFF"))
+    {
+        RequestTiming::SetEnabled(obj.arrayValue[2].stringValue == "ON");
+
+        MESPObject resObj(MESPType::BulkString, "SUCCESS");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "DUMP" && obj.arrayValue.size() == 2)
+    {
+        auto breakdowns = tracker.Stages();
+        for (const auto &entry : breakdowns)
+        {
+            std::string line = "LATENCY STAGES " + entry.first + " requests=" + std::to_string(entry.second.requests);
+            for (size_t i = 0; i < RequestTiming::kStages; ++i)
+            {
+                line += " " + std::string(RequestTiming::Name(static_cast<Stage>(i))) + "_ns=" +
+                        std::to_string(entry.second.nanoseconds[i] / entry.second.requests);
+            }
+            LoggerManager::getInstance().info(line);
+        }
+
+        MESPObject resObj(MESPType::Integer, static_cast<long long>(breakdowns.size()));
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    // Handle invalid command format for unknown subcommands or arguments
+    HandleInvalidCommandFormat(response);
+}
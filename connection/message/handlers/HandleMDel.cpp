@@ -0,0 +1,49 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "MDEL" command by deleting several keys in one cache call.
+ *
+ * The expected command format is "MDEL key [key ...]", where every key is a `BulkString`. The reply is an array
+ * holding, for each key in order, "SUCCESS" if it was deleted or "NOT FOUND", like `HandleDelete` replies for a
+ * single key.
+ *
+ * @param obj The parsed MESP object containing the MDEL command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleMDel(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains at least one key
+    if (obj.arrayValue.size() < 2)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::string> keys;
+    keys.reserve(obj.arrayValue.size() - 1);
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if every key is of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        keys.push_back(obj.arrayValue[i].stringValue);
+    }
+
+    // Delete all keys under a single lock acquisition
+    std::vector<bool> deleted;
+    cache_->MDelete(keys, deleted);
+
+    std::vector<MESPObject> results;
+    results.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        results.emplace_back(MESPType::BulkString, deleted[i] ? "SUCCESS" : "NOT FOUND");
+    }
+
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,54 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "MSET" command by storing several key-value pairs in one cache call.
+ *
+ * The expected command format is "MSET key value duration [key value duration ...]": each key and value is a
+ * `BulkString` and each duration an `Integer` TTL in seconds, 0 for a pair that never expires. Either all pairs
+ * are stored or, if the cache refuses one of them, none is. The reply is an array of "SUCCESS", one per pair.
+ *
+ * @param obj The parsed MESP object containing the MSET command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleMSet(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains at least one key-value-duration triple
+    if (obj.arrayValue.size() < 4 || (obj.arrayValue.size() - 1) % 3 != 0)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<CacheSetRequest> entries;
+    entries.reserve((obj.arrayValue.size() - 1) / 3);
+    for (size_t i = 1; i < obj.arrayValue.size(); i += 3)
+    {
+        const MESPObject &keyObj = obj.arrayValue[i];
+        const MESPObject &valueObj = obj.arrayValue[i + 1];
+        const MESPObject &durationObj = obj.arrayValue[i + 2];
+
+        // Check if the key and value are of type BulkString
+        if (keyObj.type != MESPType::BulkString || valueObj.type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+
+        // Check if the duration is a non-negative Integer
+        if (durationObj.type != MESPType::Integer || durationObj.intValue < 0)
+        {
+            response = "INVALID DURATION FORMAT";
+            return;
+        }
+
+        entries.push_back({keyObj.stringValue, valueObj.stringValue, std::chrono::seconds(durationObj.intValue)});
+    }
+
+    // Store all pairs under a single lock acquisition
+    cache_->MSet(entries);
+
+    std::vector<MESPObject> results(entries.size(), MESPObject(MESPType::BulkString, "SUCCESS"));
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
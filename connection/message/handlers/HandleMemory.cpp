@@ -0,0 +1,102 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the memory introspection command.
+ *
+ * The expected command formats are:
+ *  - "MEMORY" or "MEMORY STATS": replies with an array of name/value pairs for the accounted bytes, the byte
+ *    budget, the number of keys, the entry limit, the bytes held by the slab allocator, the bytes of removed
+ *    values still waiting to be freed in the background, and the keys and bytes held by the disk tier.
+ *  - "MEMORY USAGE <key>": replies with the bytes accounted to the key, or "NOT FOUND".
+ *  - "MEMORY SLABS": replies with one array per slab allocator size class in use, holding the chunk size, the slab
+ *    size, the number of slabs, and the used and free chunks.
+ *
+ * @param obj The parsed MESP object containing the MEMORY command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleMemory(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains between one and three elements
+    if (obj.arrayValue.size() > 3)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::string subcommand = "STATS";
+    if (obj.arrayValue.size() > 1)
+    {
+        if (obj.arrayValue[1].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        subcommand = obj.arrayValue[1].stringValue;
+    }
+
+    if (subcommand == "STATS" && obj.arrayValue.size() <= 2)
+    {
+        CacheMemoryStats stats = cache_->MemoryStats();
+
+        std::vector<MESPObject> fields;
+        fields.emplace_back(MESPType::BulkString, "used_memory");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.used_memory));
+        fields.emplace_back(MESPType::BulkString, "maxmemory");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.max_memory));
+        fields.emplace_back(MESPType::BulkString, "keys");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.keys));
+        fields.emplace_back(MESPType::BulkString, "max_keys");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.max_keys));
+        fields.emplace_back(MESPType::BulkString, "allocated_memory");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.allocated_memory));
+        fields.emplace_back(MESPType::BulkString, "lazy_free_pending");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.lazy_free_pending));
+        fields.emplace_back(MESPType::BulkString, "spilled_keys");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.spilled_keys));
+        fields.emplace_back(MESPType::BulkString, "spilled_bytes");
+        fields.emplace_back(MESPType::Integer, static_cast<long long>(stats.spilled_bytes));
+
+        MESPObject resObj(MESPType::Array, fields);
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "SLABS" && obj.arrayValue.size() == 2)
+    {
+        std::vector<MESPObject> classes;
+        for (const auto &cls : cache_->SlabStats())
+        {
+            std::vector<MESPObject> fields;
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(cls.chunk_size));
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(cls.slab_size));
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(cls.slabs));
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(cls.used_chunks));
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(cls.free_chunks));
+            classes.emplace_back(MESPType::Array, fields);
+        }
+
+        MESPObject resObj(MESPType::Array, classes);
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "USAGE" && obj.arrayValue.size() == 3 && obj.arrayValue[2].type == MESPType::BulkString)
+    {
+        size_t bytes = 0;
+        if (cache_->MemoryUsage(obj.arrayValue[2].stringValue, bytes))
+        {
+            MESPObject resObj(MESPType::Integer, static_cast<long long>(bytes));
+            response = CommandParser::serializeResponse(resObj);
+        }
+        else
+        {
+            MESPObject resObj(MESPType::BulkString, "NOT FOUND");
+            response = CommandParser::serializeResponse(resObj);
+        }
+        return;
+    }
+
+    // Handle invalid command format for unknown subcommands or arguments
+    HandleInvalidCommandFormat(response);
+}
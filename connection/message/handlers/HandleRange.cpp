@@ -0,0 +1,50 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "RANGE" command by returning the keys between two bounds in key order.
+ *
+ * The expected command format is "RANGE start end [LIMIT count]", where `start` and `end` are `BulkString`s and
+ * `count` a positive `Integer`. The reply is an array of the keys in `[start, end)`; an empty `end` leaves the
+ * range unbounded above. Requires the ordered index; otherwise the reply is an error.
+ *
+ * @param obj The parsed MESP object containing the RANGE command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleRange(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains both bounds and, optionally, the limit
+    if ((obj.arrayValue.size() != 3 && obj.arrayValue.size() != 5) ||
+        obj.arrayValue[1].type != MESPType::BulkString || obj.arrayValue[2].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    size_t limit = 0;
+    if (obj.arrayValue.size() == 5)
+    {
+        const MESPObject &option = obj.arrayValue[3];
+        const MESPObject &argument = obj.arrayValue[4];
+        if (option.type != MESPType::BulkString || option.stringValue != "LIMIT" ||
+            argument.type != MESPType::Integer || argument.intValue <= 0)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        limit = static_cast<size_t>(argument.intValue);
+    }
+
+    std::vector<std::string> keys;
+    cache_->Range(obj.arrayValue[1].stringValue, obj.arrayValue[2].stringValue, limit, keys);
+
+    std::vector<MESPObject> keyObjs;
+    keyObjs.reserve(keys.size());
+    for (const auto &key : keys)
+    {
+        keyObjs.emplace_back(MESPType::BulkString, key);
+    }
+
+    MESPObject resObj(MESPType::Array, keyObjs);
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,71 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "SCAN" command by returning the next few keys of a cursor-based iteration.
+ *
+ * The expected command format is "SCAN cursor [MATCH pattern] [COUNT count]", where `cursor` and `count` are
+ * non-negative `Integer`s and `pattern` a glob-style `BulkString`. A scan starts with cursor 0 and is complete when
+ * the returned cursor is 0. `COUNT` defaults to 10.
+ *
+ * The reply is an array holding the next cursor as an `Integer` and an array of the keys found by this call.
+ *
+ * @param obj The parsed MESP object containing the SCAN command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleScan(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the cursor and complete option pairs
+    if (obj.arrayValue.size() < 2 || obj.arrayValue.size() % 2 != 0 || obj.arrayValue[1].type != MESPType::Integer ||
+        obj.arrayValue[1].intValue < 0)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    size_t cursor = static_cast<size_t>(obj.arrayValue[1].intValue);
+    std::string pattern;
+    size_t count = 10;
+
+    for (size_t i = 2; i < obj.arrayValue.size(); i += 2)
+    {
+        const MESPObject &option = obj.arrayValue[i];
+        const MESPObject &argument = obj.arrayValue[i + 1];
+        if (option.type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+
+        if (option.stringValue == "MATCH" && argument.type == MESPType::BulkString)
+        {
+            pattern = argument.stringValue == "*" ? std::string() : argument.stringValue;
+        }
+        else if (option.stringValue == "COUNT" && argument.type == MESPType::Integer && argument.intValue > 0)
+        {
+            count = static_cast<size_t>(argument.intValue);
+        }
+        else
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+    }
+
+    std::vector<std::string> keys;
+    size_t next = cache_->Scan(cursor, pattern, count, keys);
+
+    std::vector<MESPObject> keyObjs;
+    keyObjs.reserve(keys.size());
+    for (const auto &key : keys)
+    {
+        keyObjs.emplace_back(MESPType::BulkString, key);
+    }
+
+    std::vector<MESPObject> fields;
+    fields.emplace_back(MESPType::Integer, static_cast<long long>(next));
+    fields.emplace_back(MESPType::Array, keyObjs);
+
+    MESPObject resObj(MESPType::Array, fields);
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,98 @@
+#include "MessageProcessor.h"
+#include "SlowLog.h"
+
+/**
+ * @brief Handles the slow log command.
+ *
+ * The slow log keeps the last `SlowLog::kCapacity` commands whose latency from parsing to sending reached the
+ * threshold. The expected command formats are:
+ *  - "SLOWLOG GET" or "SLOWLOG GET <count>": replies with one array per entry, newest first, holding name/value
+ *    pairs for the entry's id, its Unix timestamp in seconds, its duration and its wait on contended cache locks in
+ *    microseconds, the client's socket and the command with its arguments truncated. `count` is a positive
+ *    `Integer` and defaults to 10.
+ *  - "SLOWLOG LEN": replies with the number of entries as an `Integer`.
+ *  - "SLOWLOG RESET": forgets the entries and replies "SUCCESS".
+ *  - "SLOWLOG THRESHOLD": replies with the threshold in microseconds as an `Integer`.
+ *  - "SLOWLOG THRESHOLD <microseconds>": records the commands at least that slow from now on, 0 recording every
+ *    command, and replies "SUCCESS".
+ *
+ * @param obj The parsed MESP object containing the SLOWLOG command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleSlowLog(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains a subcommand and at most one argument
+    if (obj.arrayValue.size() < 2 || obj.arrayValue.size() > 3 || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+    const std::string &subcommand = obj.arrayValue[1].stringValue;
+
+    SlowLog &slow_log = SlowLog::Instance();
+
+    if (subcommand == "GET" &&
+        (obj.arrayValue.size() == 2 || (obj.arrayValue[2].type == MESPType::Integer && obj.arrayValue[2].intValue > 0)))
+    {
+        long long count = obj.arrayValue.size() == 3 ? obj.arrayValue[2].intValue : 10;
+
+        std::vector<MESPObject> entries;
+        for (const auto &entry : slow_log.Get(static_cast<size_t>(count)))
+        {
+            std::vector<MESPObject> fields;
+            fields.emplace_back(MESPType::BulkString, "id");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(entry.id));
+            fields.emplace_back(MESPType::BulkString, "timestamp");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(entry.timestamp));
+            fields.emplace_back(MESPType::BulkString, "duration_us");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(entry.duration_ns / 1000));
+            fields.emplace_back(MESPType::BulkString, "lock_wait_us");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(entry.lock_wait_ns / 1000));
+            fields.emplace_back(MESPType::BulkString, "client_fd");
+            fields.emplace_back(MESPType::Integer, static_cast<long long>(entry.client_fd));
+            fields.emplace_back(MESPType::BulkString, "command");
+            fields.emplace_back(MESPType::BulkString, entry.command);
+            entries.emplace_back(MESPType::Array, fields);
+        }
+
+        MESPObject resObj(MESPType::Array, entries);
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "LEN" && obj.arrayValue.size() == 2)
+    {
+        MESPObject resObj(MESPType::Integer, static_cast<long long>(slow_log.Length()));
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "RESET" && obj.arrayValue.size() == 2)
+    {
+        slow_log.Reset();
+
+        MESPObject resObj(MESPType::BulkString, "SUCCESS");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "THRESHOLD" && obj.arrayValue.size() == 2)
+    {
+        MESPObject resObj(MESPType::Integer, static_cast<long long>(slow_log.Threshold() / 1000));
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    if (subcommand == "THRESHOLD" && obj.arrayValue[2].type == MESPType::Integer && obj.arrayValue[2].intValue >= 0 &&
+        obj.arrayValue[2].intValue <= static_cast<long long>(UINT64_MAX / 1000))
+    {
+        slow_log.SetThreshold(static_cast<uint64_t>(obj.arrayValue[2].intValue) * 1000);
+
+        MESPObject resObj(MESPType::BulkString, "SUCCESS");
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    // Handle invalid command format for unknown subcommands or arguments
+    HandleInvalidCommandFormat(response);
+}
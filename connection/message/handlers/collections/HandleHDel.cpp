@@ -0,0 +1,43 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "HDEL" command by erasing fields of a hash.
+ *
+ * The expected command format is "HDEL key field [field ...]", where every argument is a `BulkString`. The hash is
+ * removed once its last field is. The reply is the number of fields that existed, as an `Integer`.
+ *
+ * @param obj The parsed MESP object containing the HDEL command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleHDel(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and at least one field
+    if (obj.arrayValue.size() < 3)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if every argument is of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+    }
+
+    std::vector<std::string> fields;
+    fields.reserve(obj.arrayValue.size() - 2);
+    for (size_t i = 2; i < obj.arrayValue.size(); ++i)
+    {
+        fields.push_back(obj.arrayValue[i].stringValue);
+    }
+
+    size_t erased = collection_cache_->HashDelete(obj.arrayValue[1].stringValue, fields);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(erased));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,31 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "HGET" command by reading one field of a hash.
+ *
+ * The expected command format is "HGET key field", where both arguments are `BulkString`s. The reply is the
+ * field's value as a `BulkString`, or "NOT FOUND" if the hash or the field does not exist, like "GET".
+ *
+ * @param obj The parsed MESP object containing the HGET command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleHGet(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains exactly the key and the field, both of type BulkString
+    if (obj.arrayValue.size() != 3 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::string value;
+    if (!collection_cache_->HashGet(obj.arrayValue[1].stringValue, obj.arrayValue[2].stringValue, value))
+    {
+        value = "NOT FOUND";
+    }
+
+    MESPObject resObj(MESPType::BulkString, value);
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,44 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "HSET" command by setting fields of a hash.
+ *
+ * The expected command format is "HSET key field value [field value ...]", where every argument is a
+ * `BulkString`. The hash is created if it does not exist, and only the named fields are written. The reply is the
+ * number of fields that were new, as an `Integer`.
+ *
+ * @param obj The parsed MESP object containing the HSET command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleHSet(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and complete field/value pairs
+    if (obj.arrayValue.size() < 4 || obj.arrayValue.size() % 2 != 0)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if every argument is of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+    }
+
+    std::vector<std::pair<std::string, std::string>> fields;
+    fields.reserve(obj.arrayValue.size() / 2 - 1);
+    for (size_t i = 2; i < obj.arrayValue.size(); i += 2)
+    {
+        fields.emplace_back(obj.arrayValue[i].stringValue, obj.arrayValue[i + 1].stringValue);
+    }
+
+    size_t added = collection_cache_->HashSet(obj.arrayValue[1].stringValue, fields);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(added));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,37 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "LRANGE" command by reading the elements of a list between two indexes.
+ *
+ * The expected command format is "LRANGE key start stop", where the key is a `BulkString` and both indexes are
+ * `Integer`s. The range is inclusive, negative indexes count from the end, -1 being the last element, and
+ * out-of-range indexes are clamped, so "LRANGE key 0 -1" reads the whole list. The reply is an array of
+ * `BulkString`s, empty if the list does not exist.
+ *
+ * @param obj The parsed MESP object containing the LRANGE command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleLRange(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and both indexes
+    if (obj.arrayValue.size() != 4 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::Integer || obj.arrayValue[3].type != MESPType::Integer)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::string> elements = collection_cache_->ListRange(
+        obj.arrayValue[1].stringValue, obj.arrayValue[2].intValue, obj.arrayValue[3].intValue);
+
+    std::vector<MESPObject> results;
+    results.reserve(elements.size());
+    for (auto &element : elements)
+    {
+        results.emplace_back(MESPType::BulkString, element);
+    }
+
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
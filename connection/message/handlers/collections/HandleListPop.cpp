@@ -0,0 +1,47 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "LPOP" and "RPOP" commands by removing elements from the front or the back of a list.
+ *
+ * The expected command format is "LPOP key [count]" or the same with "RPOP", where the key is a `BulkString` and
+ * the count a positive `Integer`. Without a count, the reply is the removed element as a `BulkString`, or
+ * "NOT FOUND" if the list does not exist; with a count, it is an array of up to `count` removed elements. The list
+ * is removed once its last element is.
+ *
+ * @param obj The parsed MESP object containing the command and its arguments.
+ * @param response The response string to be set.
+ * @param front `true` for "LPOP", `false` for "RPOP".
+ */
+void MessageProcessor::HandleListPop(const MESPObject &obj, std::string &response, bool front)
+{
+    // Check if the command contains the key and an optional positive count
+    if (obj.arrayValue.size() < 2 || obj.arrayValue.size() > 3 || obj.arrayValue[1].type != MESPType::BulkString ||
+        (obj.arrayValue.size() == 3 &&
+         (obj.arrayValue[2].type != MESPType::Integer || obj.arrayValue[2].intValue <= 0)))
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    bool with_count = obj.arrayValue.size() == 3;
+    size_t count = with_count ? static_cast<size_t>(obj.arrayValue[2].intValue) : 1;
+    std::vector<std::string> elements = collection_cache_->ListPop(obj.arrayValue[1].stringValue, count, front);
+
+    if (!with_count)
+    {
+        MESPObject resObj(MESPType::BulkString, elements.empty() ? std::string("NOT FOUND") : elements.front());
+        response = CommandParser::serializeResponse(resObj);
+        return;
+    }
+
+    std::vector<MESPObject> results;
+    results.reserve(elements.size());
+    for (auto &element : elements)
+    {
+        results.emplace_back(MESPType::BulkString, element);
+    }
+
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
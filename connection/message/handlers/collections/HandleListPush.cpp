@@ -0,0 +1,45 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "LPUSH" and "RPUSH" commands by pushing elements to the front or the back of a list.
+ *
+ * The expected command format is "LPUSH key element [element ...]" or the same with "RPUSH", where every argument
+ * is a `BulkString`. Elements are pushed one by one, so "LPUSH key a b c" leaves "c" first. The list is created if
+ * it does not exist. The reply is the length of the list after the push, as an `Integer`.
+ *
+ * @param obj The parsed MESP object containing the command and its arguments.
+ * @param response The response string to be set.
+ * @param front `true` for "LPUSH", `false` for "RPUSH".
+ */
+void MessageProcessor::HandleListPush(const MESPObject &obj, std::string &response, bool front)
+{
+    // Check if the command contains the key and at least one element
+    if (obj.arrayValue.size() < 3)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if every argument is of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+    }
+
+    std::vector<std::string> elements;
+    elements.reserve(obj.arrayValue.size() - 2);
+    for (size_t i = 2; i < obj.arrayValue.size(); ++i)
+    {
+        elements.push_back(obj.arrayValue[i].stringValue);
+    }
+
+    size_t length = collection_cache_->ListPush(obj.arrayValue[1].stringValue, elements, front);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(length));
+    response = CommandParser::serializeResponse(resObj);
+}
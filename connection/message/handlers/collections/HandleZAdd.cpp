@@ -0,0 +1,70 @@
+#include "MessageProcessor.h"
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * @brief Reads a sorted set score from an `Integer`, a `Float`, or a `BulkString` holding a decimal number, the
+ *        last being the only way to send a score with more precision than a `Float` has.
+ *
+ * @return `false` if the argument is not a number.
+ */
+static bool ParseScore(const MESPObject &arg, double &score)
+{
+    switch (arg.type)
+    {
+    case MESPType::Integer:
+        score = static_cast<double>(arg.intValue);
+        return true;
+    case MESPType::Float:
+        score = arg.floatValue;
+        return true;
+    case MESPType::BulkString:
+    {
+        const char *begin = arg.stringValue.c_str();
+        char *end = nullptr;
+        score = std::strtod(begin, &end);
+        return !arg.stringValue.empty() && end == begin + arg.stringValue.size();
+    }
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Handles the "ZADD" command by adding members to a sorted set.
+ *
+ * The expected command format is "ZADD key score member [score member ...]", where the key and members are
+ * `BulkString`s and every score is an `Integer`, a `Float` or a `BulkString` holding a number. Members already in
+ * the set have their score updated. The set is created if it does not exist. The reply is the number of members
+ * that were new, as an `Integer`.
+ *
+ * @param obj The parsed MESP object containing the ZADD command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleZAdd(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and complete score/member pairs
+    if (obj.arrayValue.size() < 4 || obj.arrayValue.size() % 2 != 0 || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::pair<double, std::string>> members;
+    members.reserve(obj.arrayValue.size() / 2 - 1);
+    for (size_t i = 2; i < obj.arrayValue.size(); i += 2)
+    {
+        double score;
+        if (!ParseScore(obj.arrayValue[i], score) || obj.arrayValue[i + 1].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        members.emplace_back(score, obj.arrayValue[i + 1].stringValue);
+    }
+
+    size_t added = collection_cache_->SortedSetAdd(obj.arrayValue[1].stringValue, members);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(added));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,47 @@
+#include "MessageProcessor.h"
+#include <cstdio>
+#include <iostream>
+
+/**
+ * @brief Handles the "ZRANGE" command by reading the members of a sorted set between two ranks.
+ *
+ * The expected command format is "ZRANGE key start stop [WITHSCORES]", where the key is a `BulkString` and both
+ * ranks are `Integer`s. Ranks count from 0 in increasing score order, ties ordered by member; the range is
+ * inclusive and negative ranks count from the end, as for "LRANGE". The reply is an array of members, each
+ * followed by its score when WITHSCORES is given. Scores are sent as `BulkString`s with 17 significant digits,
+ * enough to read back as the same `double`, since a `Float` would round them.
+ *
+ * @param obj The parsed MESP object containing the ZRANGE command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleZRange(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key, both ranks and an optional WITHSCORES
+    if (obj.arrayValue.size() < 4 || obj.arrayValue.size() > 5 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::Integer || obj.arrayValue[3].type != MESPType::Integer ||
+        (obj.arrayValue.size() == 5 && obj.arrayValue[4].stringValue != "WITHSCORES"))
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    bool with_scores = obj.arrayValue.size() == 5;
+    std::vector<std::pair<std::string, double>> members = collection_cache_->SortedSetRange(
+        obj.arrayValue[1].stringValue, obj.arrayValue[2].intValue, obj.arrayValue[3].intValue);
+
+    std::vector<MESPObject> results;
+    results.reserve(members.size() * (with_scores ? 2 : 1));
+    for (auto &member : members)
+    {
+        results.emplace_back(MESPType::BulkString, member.first);
+        if (with_scores)
+        {
+            char score[32];
+            std::snprintf(score, sizeof(score), "%.17g", member.second);
+            results.emplace_back(MESPType::BulkString, std::string(score));
+        }
+    }
+
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
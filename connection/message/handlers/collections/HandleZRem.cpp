@@ -0,0 +1,43 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "ZREM" command by removing members from a sorted set.
+ *
+ * The expected command format is "ZREM key member [member ...]", where every argument is a `BulkString`. The set
+ * is removed once its last member is. The reply is the number of members that were in the set, as an `Integer`.
+ *
+ * @param obj The parsed MESP object containing the ZREM command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleZRem(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and at least one member
+    if (obj.arrayValue.size() < 3)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if every argument is of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+    }
+
+    std::vector<std::string> members;
+    members.reserve(obj.arrayValue.size() - 2);
+    for (size_t i = 2; i < obj.arrayValue.size(); ++i)
+    {
+        members.push_back(obj.arrayValue[i].stringValue);
+    }
+
+    size_t removed = collection_cache_->SortedSetRemove(obj.arrayValue[1].stringValue, members);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(removed));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,27 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "BF.ADD" command by adding an item to a Bloom filter.
+ *
+ * The expected command format is "BF.ADD key item", where both are `BulkString`s. The reply is the `Integer`
+ * 1 if the item was definitely not in the filter before, otherwise 0. The filter is created with the default capacity if it does not exist.
+ *
+ * @param obj The parsed MESP object containing the BF.ADD command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleBfAdd(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains exactly the key and the item
+    if (obj.arrayValue.size() != 3 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    bool result = probabilistic_cache_->BloomAdd(obj.arrayValue[1].stringValue, obj.arrayValue[2].stringValue);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(result ? 1 : 0));
+    response = CommandParser::serializeResponse(resObj);
+}
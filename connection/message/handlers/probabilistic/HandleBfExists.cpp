@@ -0,0 +1,27 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "BF.EXISTS" command by checking whether an item may be in a Bloom filter.
+ *
+ * The expected command format is "BF.EXISTS key item", where both are `BulkString`s. The reply is the `Integer`
+ * 0 if the item was definitely never added or the filter does not exist, otherwise 1.
+ *
+ * @param obj The parsed MESP object containing the BF.EXISTS command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleBfExists(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains exactly the key and the item
+    if (obj.arrayValue.size() != 3 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    bool result = probabilistic_cache_->BloomExists(obj.arrayValue[1].stringValue, obj.arrayValue[2].stringValue);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(result ? 1 : 0));
+    response = CommandParser::serializeResponse(resObj);
+}
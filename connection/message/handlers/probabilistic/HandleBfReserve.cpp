@@ -0,0 +1,31 @@
+#include "MessageProcessor.h"
+#include "BloomFilter.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "BF.RESERVE" command by creating an empty Bloom filter.
+ *
+ * The expected command format is "BF.RESERVE key capacity", where `key` is a `BulkString` and `capacity` a positive
+ * `Integer` of at most `BloomFilter::kMaxExpectedKeys` giving the number of items the filter is sized for. The reply
+ * is "SUCCESS", or "ALREADY EXISTS" if a filter already exists under the key.
+ *
+ * @param obj The parsed MESP object containing the BF.RESERVE command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleBfReserve(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains exactly the key and a capacity the filter can be allocated for
+    if (obj.arrayValue.size() != 3 || obj.arrayValue[1].type != MESPType::BulkString ||
+        obj.arrayValue[2].type != MESPType::Integer || obj.arrayValue[2].intValue <= 0 ||
+        static_cast<uint64_t>(obj.arrayValue[2].intValue) > BloomFilter::kMaxExpectedKeys)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    bool created = probabilistic_cache_->BloomReserve(obj.arrayValue[1].stringValue,
+                                                      static_cast<size_t>(obj.arrayValue[2].intValue));
+
+    MESPObject resObj(MESPType::BulkString, created ? "SUCCESS" : "ALREADY EXISTS");
+    response = CommandParser::serializeResponse(resObj);
+}
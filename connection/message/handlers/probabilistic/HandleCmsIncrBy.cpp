@@ -0,0 +1,51 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "CMS.INCRBY" command by adding to the counts of items in a count-min sketch.
+ *
+ * The expected command format is "CMS.INCRBY key item increment [item increment ...]", where the key and items are
+ * `BulkString`s and every increment a positive `Integer` that fits in 32 bits. The sketch is created if it does
+ * not exist. The reply is an array holding, for each item in order, its estimated count after the increment;
+ * counts stop at `UINT32_MAX` rather than wrap.
+ *
+ * @param obj The parsed MESP object containing the CMS.INCRBY command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleCmsIncrBy(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and complete item/increment pairs
+    if (obj.arrayValue.size() < 4 || obj.arrayValue.size() % 2 != 0 || obj.arrayValue[1].type != MESPType::BulkString)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::string> items;
+    std::vector<uint32_t> increments;
+    for (size_t i = 2; i < obj.arrayValue.size(); i += 2)
+    {
+        const MESPObject &item = obj.arrayValue[i];
+        const MESPObject &increment = obj.arrayValue[i + 1];
+        if (item.type != MESPType::BulkString || increment.type != MESPType::Integer || increment.intValue <= 0 ||
+            increment.intValue > UINT32_MAX)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        items.push_back(item.stringValue);
+        increments.push_back(static_cast<uint32_t>(increment.intValue));
+    }
+
+    std::vector<uint32_t> estimates = probabilistic_cache_->CmsIncrBy(obj.arrayValue[1].stringValue, items, increments);
+
+    std::vector<MESPObject> results;
+    results.reserve(estimates.size());
+    for (uint32_t estimate : estimates)
+    {
+        results.emplace_back(MESPType::Integer, static_cast<long long>(estimate));
+    }
+
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
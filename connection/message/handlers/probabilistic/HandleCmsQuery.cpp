@@ -0,0 +1,50 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "CMS.QUERY" command by estimating the counts of items in a count-min sketch.
+ *
+ * The expected command format is "CMS.QUERY key item [item ...]", where every argument is a `BulkString`. The
+ * reply is an array holding, for each item in order, its estimated count, which is never below the true count;
+ * all zeros if the sketch does not exist.
+ *
+ * @param obj The parsed MESP object containing the CMS.QUERY command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandleCmsQuery(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key and at least one item
+    if (obj.arrayValue.size() < 3)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::string> items;
+    items.reserve(obj.arrayValue.size() - 2);
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if the key and every item are of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        if (i > 1)
+        {
+            items.push_back(obj.arrayValue[i].stringValue);
+        }
+    }
+
+    std::vector<uint32_t> counts = probabilistic_cache_->CmsQuery(obj.arrayValue[1].stringValue, items);
+
+    std::vector<MESPObject> results;
+    results.reserve(counts.size());
+    for (uint32_t count : counts)
+    {
+        results.emplace_back(MESPType::Integer, static_cast<long long>(count));
+    }
+
+    MESPObject resObj(MESPType::Array, results);
+    response = CommandParser::serializeResponse(resObj);
+}
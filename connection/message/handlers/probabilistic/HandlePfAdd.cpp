@@ -0,0 +1,43 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "PFADD" command by adding elements to a HyperLogLog.
+ *
+ * The expected command format is "PFADD key [element ...]", where every argument is a `BulkString`. The
+ * HyperLogLog is created if it does not exist. The reply is the `Integer` 1 if its estimated cardinality may have
+ * changed, otherwise 0.
+ *
+ * @param obj The parsed MESP object containing the PFADD command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandlePfAdd(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the key
+    if (obj.arrayValue.size() < 2)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::string> elements;
+    elements.reserve(obj.arrayValue.size() - 2);
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if the key and every element are of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        if (i > 1)
+        {
+            elements.push_back(obj.arrayValue[i].stringValue);
+        }
+    }
+
+    bool changed = probabilistic_cache_->HllAdd(obj.arrayValue[1].stringValue, elements);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(changed ? 1 : 0));
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -0,0 +1,39 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "PFCOUNT" command by estimating the number of distinct elements in HyperLogLogs.
+ *
+ * The expected command format is "PFCOUNT key [key ...]", where every key is a `BulkString`. The reply is the
+ * estimated cardinality of the union of the HyperLogLogs as an `Integer`; missing keys count as empty.
+ *
+ * @param obj The parsed MESP object containing the PFCOUNT command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandlePfCount(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains at least one key
+    if (obj.arrayValue.size() < 2)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::string> keys;
+    keys.reserve(obj.arrayValue.size() - 1);
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if every key is of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        keys.push_back(obj.arrayValue[i].stringValue);
+    }
+
+    uint64_t count = probabilistic_cache_->HllCount(keys);
+
+    MESPObject resObj(MESPType::Integer, static_cast<long long>(count));
+    response = CommandParser::serializeResponse(resObj);
+}
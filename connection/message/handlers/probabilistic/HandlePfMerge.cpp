@@ -0,0 +1,42 @@
+#include "MessageProcessor.h"
+#include <iostream>
+
+/**
+ * @brief Handles the "PFMERGE" command by merging HyperLogLogs into another one.
+ *
+ * The expected command format is "PFMERGE destination source [source ...]", where every key is a `BulkString`.
+ * The destination is created if it does not exist and keeps its own elements. The reply is "SUCCESS".
+ *
+ * @param obj The parsed MESP object containing the PFMERGE command and its arguments.
+ * @param response The response string to be set.
+ */
+void MessageProcessor::HandlePfMerge(const MESPObject &obj, std::string &response)
+{
+    // Check if the command contains the destination and at least one source
+    if (obj.arrayValue.size() < 3)
+    {
+        HandleInvalidCommandFormat(response);
+        return;
+    }
+
+    std::vector<std::string> sources;
+    sources.reserve(obj.arrayValue.size() - 2);
+    for (size_t i = 1; i < obj.arrayValue.size(); ++i)
+    {
+        // Check if every key is of type BulkString
+        if (obj.arrayValue[i].type != MESPType::BulkString)
+        {
+            HandleInvalidCommandFormat(response);
+            return;
+        }
+        if (i > 1)
+        {
+            sources.push_back(obj.arrayValue[i].stringValue);
+        }
+    }
+
+    probabilistic_cache_->HllMerge(obj.arrayValue[1].stringValue, sources);
+
+    MESPObject resObj(MESPType::BulkString, "SUCCESS");
+    response = CommandParser::serializeResponse(resObj);
+}
@@ -7,6 +7,7 @@
 
 #include "Server.h"
 #include "ConnectionHandler.h"
+#include "ServerStats.h"
 #include "INIReader.h"
 
 
@@ -23,11 +24,15 @@
 Server::Server(std::shared_ptr<ICache> cache,
                std::shared_ptr<IGeoCache> geo_cache,
                std::shared_ptr<ITimeSeriesCache> time_series_cache,
+               std::shared_ptr<IProbabilisticCache> probabilistic_cache,
+               std::shared_ptr<ICollectionCache> collection_cache,
                uint16_t port
 )
     : cache_(std::move(cache)),
       geo_cache_(std::move(geo_cache)),
       time_series_cache_(std::move(time_series_cache)),
+      probabilistic_cache_(std::move(probabilistic_cache)),
+      collection_cache_(std::move(collection_cache)),
       port_(port),
       secret_key_("xyz"),
       running_(false)
@@ -98,6 +103,9 @@ void Server::Start()
 
     std::cout << "Memify is listening on port " << port_ << std::endl;
 
+    // INFO reports the uptime from the first use of the counters
+    ServerStats &stats = ServerStats::Instance();
+
     // Main loop to accept client connections.
     running_ = true;
     while (running_)
@@ -114,11 +122,12 @@ void Server::Start()
         }
 
         std::cout << "Client attempting to connect" << std::endl;
+        stats.Add(Stat::kConnectionsReceived);
 
         if(AuthenticateClient(client_fd))
         {
             std::cout << "Client authenticated and connected" << std::endl;
-            std::thread(&ConnectionHandler::HandleClient, ConnectionHandler(cache_, geo_cache_, time_series_cache_, client_fd, secret_key_)).detach();
+            std::thread(&ConnectionHandler::HandleClient, ConnectionHandler(cache_, geo_cache_, time_series_cache_, probabilistic_cache_, collection_cache_, client_fd, secret_key_)).detach();
         }
         else
         {
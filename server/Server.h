@@ -4,6 +4,8 @@
 #include "ICache.h"
 #include "IGeoCache.h"
 #include "ITimeSeriesCache.h"
+#include "IProbabilisticCache.h"
+#include "ICollectionCache.h"
 
 #include <cstdint>
 #include <memory>
@@ -27,12 +29,16 @@ public:
      * @brief Constructs a Server object with a given cache and port.
      *
      * @param cache A shared pointer to an `ICache` object, providing the caching mechanism.
+     * @param probabilistic_cache A shared pointer to the cache of Bloom filters, HyperLogLogs and count-min sketches.
+     * @param collection_cache A shared pointer to the cache of hashes, lists and sorted sets.
      * @param port The port number on which the server will listen for incoming connections.
      */
     Server(
         std::shared_ptr<ICache> cache,
         std::shared_ptr<IGeoCache> geo_cache,
         std::shared_ptr<ITimeSeriesCache> time_series_cache,
+        std::shared_ptr<IProbabilisticCache> probabilistic_cache,
+        std::shared_ptr<ICollectionCache> collection_cache,
         uint16_t port);
 
     /**
@@ -55,6 +61,8 @@ private:
     std::shared_ptr<ICache> cache_; ///< Shared pointer to a cache object for storing and retrieving data.
     std::shared_ptr<IGeoCache> geo_cache_; ///< Shared pointer to a cache object for storing and retrieving data.
     std::shared_ptr<ITimeSeriesCache> time_series_cache_; ///< Shared pointer to a cache object for storing and retrieving data.
+    std::shared_ptr<IProbabilisticCache> probabilistic_cache_; ///< Shared pointer to the cache of probabilistic data structures.
+    std::shared_ptr<ICollectionCache> collection_cache_; ///< Shared pointer to the cache of hashes, lists and sorted sets.
     uint16_t port_;                 ///< The port number on which the server listens for connections.
     std::string secret_key_;        ///< A secret key used for security purposes, such as HMAC validation.
     std::atomic<bool> running_;     ///< Atomic boolean flag to indicate the running state of the server.
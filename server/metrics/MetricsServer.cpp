@@ -0,0 +1,220 @@
+#include <iostream>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <poll.h>
+#include <cstring>
+#include <cerrno>
+#include <chrono>
+
+#include "MetricsServer.h"
+
+namespace
+{
+    /**
+     * @brief Waits until a socket is ready for `events` or the deadline passes.
+     *
+     * @return `true` if the socket became ready in time.
+     */
+    bool WaitReady(int fd, short events, std::chrono::steady_clock::time_point deadline)
+    {
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline -
+                                                                               std::chrono::steady_clock::now());
+        if (remaining.count() <= 0)
+        {
+            return false;
+        }
+        pollfd pfd{fd, events, 0};
+        return poll(&pfd, 1, static_cast<int>(remaining.count())) > 0;
+    }
+}
+
+/**
+ * @brief Constructs a MetricsServer over the caches it reports on.
+ *
+ * @param cache The key-value cache, for its memory accounting.
+ * @param geo_cache The geo-spatial cache, for its number of points.
+ * @param time_series_cache The time-series cache, for its number of points.
+ * @param port The port to listen on.
+ */
+MetricsServer::MetricsServer(std::shared_ptr<ICache> cache,
+                             std::shared_ptr<IGeoCache> geo_cache,
+                             std::shared_ptr<ITimeSeriesCache> time_series_cache,
+                             uint16_t port)
+    : cache_(std::move(cache)),
+      geo_cache_(std::move(geo_cache)),
+      time_series_cache_(std::move(time_series_cache)),
+      port_(port),
+      running_(false)
+{
+}
+
+/**
+ * @brief Stops the listener if it is running.
+ */
+MetricsServer::~MetricsServer()
+{
+    Stop();
+}
+
+/**
+ * @brief Binds the port and starts serving on a background thread.
+ *
+ * @return `true` if the listener is running, `false` if the socket could not be set up.
+ */
+bool MetricsServer::Start()
+{
+    listen_fd_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd_ < 0)
+    {
+        std::cerr << "Metrics socket creation failed" << std::endl;
+        return false;
+    }
+
+    int opt = 1;
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port_);
+    addr.sin_addr.s_addr = INADDR_ANY;
+    if (bind(listen_fd_, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listen_fd_, 16) < 0)
+    {
+        std::cerr << "Metrics bind failed on port " << port_ << std::endl;
+        close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+
+    running_ = true;
+    thread_ = std::thread(&MetricsServer::Serve, this);
+
+    std::cout << "Memify metrics are served on port " << port_ << std::endl;
+    return true;
+}
+
+/**
+ * @brief Stops serving and waits for the background thread to exit.
+ *
+ * Shutting the listening socket down wakes the thread from `accept`.
+ */
+void MetricsServer::Stop()
+{
+    if (!running_.exchange(false))
+    {
+        return;
+    }
+
+    shutdown(listen_fd_, SHUT_RDWR);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+    close(listen_fd_);
+    listen_fd_ = -1;
+}
+
+/**
+ * @brief Accepts connections and answers them one at a time until stopped.
+ *
+ * Scrapes are rare and cheap, so one thread is enough; `HandleRequest` bounds how long a slow client can hold it,
+ * and socket timeouts bound each single read and write. When `accept` fails for lack of descriptors or
+ * buffers, the thread backs off briefly rather than retrying at once.
+ */
+void MetricsServer::Serve()
+{
+    while (running_)
+    {
+        int client_fd = accept(listen_fd_, nullptr, nullptr);
+        if (client_fd < 0)
+        {
+            // A signal or an aborted connection is retried at once; anything else, such as EMFILE, would spin
+            if (running_ && errno != EINTR && errno != ECONNABORTED)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            continue;
+        }
+
+        timeval timeout{};
+        timeout.tv_sec = 2;
+        setsockopt(client_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(client_fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        HandleRequest(client_fd);
+        close(client_fd);
+    }
+}
+
+/**
+ * @brief Reads one HTTP request from a connection and answers it.
+ *
+ * Only the request line is looked at: "GET /metrics" gets the metrics, any other path 404 and any other method 405.
+ * The whole exchange, reading the request and sending the response, must finish within `kRequestTimeout`, so a
+ * client trickling bytes in either direction cannot hold the thread. The connection is closed after the response.
+ *
+ * @param client_fd The connection's socket.
+ */
+void MetricsServer::HandleRequest(int client_fd)
+{
+    // Read until the end of the headers; the request has no body
+    auto deadline = std::chrono::steady_clock::now() + kRequestTimeout;
+    std::string request;
+    char chunk[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192)
+    {
+        if (!WaitReady(client_fd, POLLIN, deadline))
+        {
+            return;
+        }
+
+        ssize_t received = recv(client_fd, chunk, sizeof(chunk), 0);
+        if (received <= 0)
+        {
+            return;
+        }
+        request.append(chunk, static_cast<size_t>(received));
+    }
+
+    std::string request_line = request.substr(0, request.find("\r\n"));
+    std::string status = "200 OK";
+    std::string content_type = "text/plain; version=0.0.4; charset=utf-8";
+    std::string body;
+    if (request_line.compare(0, 4, "GET ") != 0)
+    {
+        status = "405 Method Not Allowed";
+        content_type = "text/plain";
+        body = "Method Not Allowed\n";
+    }
+    else if (request_line.compare(4, 9, "/metrics ") != 0 && request_line.compare(4, 9, "/metrics?") != 0)
+    {
+        status = "404 Not Found";
+        content_type = "text/plain";
+        body = "Not Found\n";
+    }
+    else
+    {
+        body = RenderMetrics();
+    }
+
+    std::string response = "HTTP/1.1 " + status + "\r\n" +
+                           "Content-Type: " + content_type + "\r\n" +
+                           "Content-Length: " + std::to_string(body.size()) + "\r\n" +
+                           "Connection: close\r\n\r\n" + body;
+
+    size_t sent = 0;
+    while (sent < response.size())
+    {
+        if (!WaitReady(client_fd, POLLOUT, deadline))
+        {
+            return;
+        }
+        ssize_t n = send(client_fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0)
+        {
+            return;
+        }
+        sent += static_cast<size_t>(n);
+    }
+}
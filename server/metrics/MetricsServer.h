@@ -0,0 +1,86 @@
+#ifndef METRICS_SERVER_H
+#define METRICS_SERVER_H
+
+#include "ICache.h"
+#include "IGeoCache.h"
+#include "ITimeSeriesCache.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+/**
+ * @class MetricsServer
+ * @brief A minimal HTTP listener that serves the server's metrics in the Prometheus text exposition format.
+ *
+ * Runs on a port of its own, apart from the authenticated client protocol, and answers "GET /metrics" on one
+ * background thread, one request per connection. Every value it serves is read from atomics or from the merged
+ * per-thread statistics, so a scrape never takes a cache lock and never delays a command.
+ */
+class MetricsServer
+{
+public:
+    /**
+     * @brief Constructs a MetricsServer over the caches it reports on.
+     *
+     * @param cache The key-value cache, for its memory accounting.
+     * @param geo_cache The geo-spatial cache, for its number of points.
+     * @param time_series_cache The time-series cache, for its number of points.
+     * @param port The port to listen on.
+     */
+    MetricsServer(
+        std::shared_ptr<ICache> cache,
+        std::shared_ptr<IGeoCache> geo_cache,
+        std::shared_ptr<ITimeSeriesCache> time_series_cache,
+        uint16_t port);
+
+    /**
+     * @brief Stops the listener if it is running.
+     */
+    ~MetricsServer();
+
+    /**
+     * @brief Binds the port and starts serving on a background thread.
+     *
+     * @return `true` if the listener is running.
+     */
+    bool Start();
+
+    /**
+     * @brief Stops serving and waits for the background thread to exit.
+     */
+    void Stop();
+
+    /**
+     * @brief Renders every metric in the Prometheus text exposition format.
+     */
+    std::string RenderMetrics() const;
+
+private:
+    static constexpr std::chrono::seconds kRequestTimeout{2}; ///< The longest a client may take to scrape.
+
+    std::shared_ptr<ICache> cache_; ///< The key-value cache.
+    std::shared_ptr<IGeoCache> geo_cache_; ///< The geo-spatial cache.
+    std::shared_ptr<ITimeSeriesCache> time_series_cache_; ///< The time-series cache.
+    uint16_t port_;                 ///< The port to listen on.
+    int listen_fd_ = -1;            ///< The listening socket, or -1 when not running.
+    std::atomic<bool> running_;     ///< Whether the listener should keep accepting.
+    std::thread thread_;            ///< The thread accepting and answering scrapes.
+
+    /**
+     * @brief Accepts connections and answers them one at a time until stopped.
+     */
+    void Serve();
+
+    /**
+     * @brief Reads one HTTP request from a connection and answers it.
+     *
+     * @param client_fd The connection's socket, closed by the caller.
+     */
+    void HandleRequest(int client_fd);
+};
+
+#endif // METRICS_SERVER_H
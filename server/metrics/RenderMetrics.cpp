@@ -0,0 +1,172 @@
+#include <cstdio>
+#include <sstream>
+
+#include "MetricsServer.h"
+#include "ServerStats.h"
+#include "LatencyTracker.h"
+
+namespace
+{
+    /**
+     * @brief How a `ServerStats` counter is exported.
+     */
+    struct CounterMetric
+    {
+        Stat stat;        ///< The counter.
+        const char *name; ///< The metric's name.
+        const char *type; ///< "counter", or "gauge" for a value that also goes down.
+        const char *help; ///< The metric's description.
+    };
+
+    const CounterMetric kCounterMetrics[] = {
+        {Stat::kKeyspaceHits, "memify_keyspace_hits_total", "counter", "Key-value reads that found their key."},
+        {Stat::kKeyspaceMisses, "memify_keyspace_misses_total", "counter", "Key-value reads that did not."},
+        {Stat::kSets, "memify_keyspace_sets_total", "counter", "Key-value entries stored."},
+        {Stat::kEvictions, "memify_evicted_keys_total", "counter", "Key-value entries evicted to make room."},
+        {Stat::kExpirations, "memify_expired_keys_total", "counter", "Key-value entries removed by their TTL."},
+        {Stat::kGeoHits, "memify_geo_hits_total", "counter", "Geo lookups that found their point."},
+        {Stat::kGeoMisses, "memify_geo_misses_total", "counter", "Geo lookups that did not."},
+        {Stat::kGeoSets, "memify_geo_sets_total", "counter", "Geo points stored."},
+        {Stat::kGeoEvictions, "memify_geo_evicted_keys_total", "counter", "Geo keys evicted to make room."},
+        {Stat::kTimeSeriesPoints, "memify_timeseries_points_added_total", "counter", "Time-series points added."},
+        {Stat::kTimeSeriesEvictions, "memify_timeseries_points_evicted_total", "counter",
+         "Time-series points dropped to keep a series within its limit."},
+        {Stat::kConnectionsReceived, "memify_connections_received_total", "counter", "Client connections accepted."},
+        {Stat::kConnectedClients, "memify_connected_clients", "gauge", "Client connections currently open."},
+        {Stat::kCommandsProcessed, "memify_commands_processed_total", "counter", "Messages processed."},
+        {Stat::kNetInputBytes, "memify_net_input_bytes_total", "counter", "Bytes received from clients."},
+        {Stat::kNetOutputBytes, "memify_net_output_bytes_total", "counter", "Bytes sent to clients."},
+    };
+
+    /**
+     * @brief A quantile of the latency summaries, as labelled and as a percentile.
+     */
+    struct Quantile
+    {
+        const char *label;
+        double percentile;
+    };
+
+    const Quantile kQuantiles[] = {{"0.5", 50.0}, {"0.9", 90.0}, {"0.99", 99.0}, {"0.999", 99.9}};
+
+    /**
+     * @brief Writes the HELP and TYPE lines of a metric.
+     */
+    void WriteHeader(std::ostringstream &out, const char *name, const char *type, const char *help)
+    {
+        out << "# HELP " << name << " " << help << "\n";
+        out << "# TYPE " << name << " " << type << "\n";
+    }
+
+    /**
+     * @brief Writes one sample of a metric without labels.
+     */
+    void WriteMetric(std::ostringstream &out, const char *name, const char *type, const char *help, uint64_t value)
+    {
+        WriteHeader(out, name, type, help);
+        out << name << " " << value << "\n";
+    }
+
+    /**
+     * @brief Escapes a label value as the exposition format requires.
+     */
+    std::string EscapeLabel(const std::string &value)
+    {
+        std::string escaped;
+        for (char c : value)
+        {
+            if (c == '\\' || c == '"')
+            {
+                escaped += '\\';
+                escaped += c;
+            }
+            else if (c == '\n')
+            {
+                escaped += "\\n";
+            }
+            else
+            {
+                escaped += c;
+            }
+        }
+        return escaped;
+    }
+
+    /**
+     * @brief Formats a duration in nanoseconds as seconds, the base unit Prometheus expects.
+     */
+    std::string Seconds(uint64_t nanoseconds)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.9f", static_cast<double>(nanoseconds) / 1e9);
+        return buffer;
+    }
+}
+
+/**
+ * @brief Renders every metric in the Prometheus text exposition format.
+ *
+ * Reports the operation counters of `ServerStats`, each command's calls and latency quantiles from
+ * `LatencyTracker`, the key-value cache's memory accounting and the sizes of the geo-spatial and time-series
+ * caches. None of these take a cache lock: the counters and sizes are atomics, and the latency histograms are
+ * merged from their per-thread copies. Per-command rates, such as operations per second, are left to PromQL's
+ * `rate()` over the call counters. Latencies are totals since the server started and ignore LATENCY RESET, so that
+ * the counters never go down.
+ *
+ * @return The metrics, one sample per line.
+ */
+std::string MetricsServer::RenderMetrics() const
+{
+    std::ostringstream out;
+    ServerStats &stats = ServerStats::Instance();
+
+    WriteMetric(out, "memify_uptime_seconds", "gauge", "Seconds since the server started.", stats.UptimeSeconds());
+    for (const CounterMetric &metric : kCounterMetrics)
+    {
+        WriteMetric(out, metric.name, metric.type, metric.help, stats.Load(metric.stat));
+    }
+
+    // Per-command calls and latency, from the per-thread histograms
+    auto latencies = LatencyTracker::Instance().Totals();
+    WriteHeader(out, "memify_command_calls_total", "counter", "Commands run, by command.");
+    for (const auto &entry : latencies)
+    {
+        out << "memify_command_calls_total{command=\"" << EscapeLabel(entry.first) << "\"} " << entry.second.count
+            << "\n";
+    }
+    WriteHeader(out, "memify_command_latency_seconds", "summary",
+                "Latency from parsing a command to sending its response, by command, since the server started.");
+    for (const auto &entry : latencies)
+    {
+        std::string command = EscapeLabel(entry.first);
+        for (const Quantile &quantile : kQuantiles)
+        {
+            out << "memify_command_latency_seconds{command=\"" << command << "\",quantile=\"" << quantile.label
+                << "\"} " << Seconds(entry.second.ValueAtPercentile(quantile.percentile)) << "\n";
+        }
+        out << "memify_command_latency_seconds_sum{command=\"" << command << "\"} " << Seconds(entry.second.sum)
+            << "\n";
+        out << "memify_command_latency_seconds_count{command=\"" << command << "\"} " << entry.second.count << "\n";
+    }
+
+    // Memory accounting of the key-value cache, kept in atomics
+    CacheMemoryStats memory = cache_->MemoryStats();
+    WriteMetric(out, "memify_used_memory_bytes", "gauge", "Bytes accounted to key-value entries.", memory.used_memory);
+    WriteMetric(out, "memify_max_memory_bytes", "gauge", "The key-value byte budget, 0 if unlimited.",
+                memory.max_memory);
+    WriteMetric(out, "memify_allocated_memory_bytes", "gauge", "Bytes the key-value allocator holds from the system.",
+                memory.allocated_memory);
+    WriteMetric(out, "memify_lazy_free_pending_bytes", "gauge", "Bytes of removed values waiting to be freed.",
+                memory.lazy_free_pending);
+    WriteMetric(out, "memify_keys", "gauge", "Key-value entries stored.", memory.keys);
+    WriteMetric(out, "memify_max_keys", "gauge", "The key-value entry limit.", memory.max_keys);
+    WriteMetric(out, "memify_spilled_keys", "gauge", "Key-value entries held by the disk tier.", memory.spilled_keys);
+    WriteMetric(out, "memify_spilled_bytes", "gauge", "Key and value bytes held by the disk tier.",
+                memory.spilled_bytes);
+
+    // Sizes of the other caches, mirrored in atomics
+    WriteMetric(out, "memify_geo_points", "gauge", "Geo-spatial points stored.", geo_cache_->Size());
+    WriteMetric(out, "memify_timeseries_points", "gauge", "Time-series points stored.", time_series_cache_->Size());
+
+    return out.str();
+}
@@ -1,30 +1,104 @@
 #include "Server.h"
 #include <memory>
+#include <iostream>
+#include <stdexcept>
+#include <cstdint>
 
 #include "Cache.h"
+#include "EpochCache.h"
 #include "GeoCache.h"
 #include "TimeSeriesCache.h"
+#include "ProbabilisticCache.h"
+#include "CollectionCache.h"
+#include "INIReader.h"
+#include "RequestTiming.h"
+#include "SlowLog.h"
+#include "MetricsServer.h"
 
 /**
  * @brief The entry point of the application.
  *
  * This main function initializes the necessary components for running the server.
  * It sets up a shared cache, creates a server instance, and starts the server
- * to listen for incoming client connections.
+ * to listen for incoming client connections. The key-value cache is sized and
+ * configured from the `[cache]` section of 'config.ini' when it is available.
  *
  * @return int Returns 0 on successful execution, or a non-zero value in case of an error.
  */
 int main()
 {
+    // Read the cache settings. Missing values (or a missing file) fall back to the defaults.
+    INIReader reader("../config.ini");
+    std::string engine = reader.Get("cache", "engine", "locked");
+    size_t max_size = reader.GetUnsigned("cache", "max_size", 1000);
+    std::string eviction_policy = reader.Get("cache", "eviction_policy", "lru");
+    uint64_t max_memory = reader.GetUnsigned64("cache", "maxmemory", 0);
+    uint64_t lazy_free_threshold = reader.GetUnsigned64("cache", "lazyfree_threshold",
+                                                        Cache::kDefaultLazyFreeThreshold);
+    bool ordered_index = reader.GetBoolean("cache", "ordered_index", false);
+    std::string spill_path = reader.Get("cache", "spill_path", "");
+    uint64_t spill_max_bytes = reader.GetUnsigned64("cache", "spill_max_bytes", Cache::kDefaultSpillBytes);
+    unsigned long hotkeys_sample_rate = reader.GetUnsigned("cache", "hotkeys_sample_rate", 0);
+    uint64_t probabilistic_max_memory = reader.GetUnsigned64("probabilistic", "maxmemory",
+                                                             ProbabilisticCache::kDefaultMaxMemory);
+    RequestTiming::SetEnabled(reader.GetBoolean("settings", "stage_timing", false));
+    SlowLog::Instance().SetThreshold(reader.GetUnsigned64("settings", "slowlog_threshold_us", 10000) * 1000);
+    unsigned long metrics_port = reader.GetUnsigned("settings", "metrics_port", 0);
+    if (metrics_port > UINT16_MAX)
+    {
+        std::cerr << "metrics_port must be between 1 and 65535, or 0 to disable the metrics listener" << std::endl;
+        return 1;
+    }
+
     // Initialize a shared pointer to the Cache object.
     // This cache will be shared across multiple client connections to store and retrieve data efficiently.
-    auto cache = std::make_shared<Cache>();
+    // An unknown engine or eviction policy, or an unusable spill file, is a configuration error, so refuse to start.
+    std::shared_ptr<ICache> cache;
+    try
+    {
+        if (engine == "epoch")
+        {
+            cache = std::make_shared<EpochCache>(max_size, max_memory);
+        }
+        else if (engine == "locked")
+        {
+            cache = std::make_shared<Cache>(max_size, eviction_policy, max_memory, lazy_free_threshold,
+                                            ordered_index, spill_path, spill_max_bytes);
+        }
+        else
+        {
+            throw std::invalid_argument("unknown cache engine '" + engine + "'");
+        }
+        if (hotkeys_sample_rate != 0)
+        {
+            cache->ConfigureHotKeys(static_cast<uint32_t>(hotkeys_sample_rate));
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
     auto geo_cache = std::make_shared<GeoCache>();
     auto time_series_cache = std::make_shared<TimeSeriesCache>();
+    auto probabilistic_cache = std::make_shared<ProbabilisticCache>(10000, probabilistic_max_memory);
+    auto collection_cache = std::make_shared<CollectionCache>();
 
     // Create a Server object, passing the shared cache and specifying the port number.
     // The server is set to listen on port 8080 by default.
-    Server server(cache, geo_cache, time_series_cache, 8080);
+    Server server(cache, geo_cache, time_series_cache, probabilistic_cache, collection_cache, 8080);
+
+    // Serve Prometheus metrics on a side port, if one is configured
+    std::unique_ptr<MetricsServer> metrics;
+    if (metrics_port != 0)
+    {
+        metrics = std::make_unique<MetricsServer>(cache, geo_cache, time_series_cache,
+                                                  static_cast<uint16_t>(metrics_port));
+        if (!metrics->Start())
+        {
+            std::cerr << "Failed to start the metrics listener on port " << metrics_port << std::endl;
+        }
+    }
 
     // Start the server to begin listening for incoming connections.
     // This method will block the main thread as it runs the server loop to handle clients.
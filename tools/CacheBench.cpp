@@ -0,0 +1,149 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Cache.h"
+#include "EpochCache.h"
+#include "LoggerManager.h"
+#include "EvictionPolicyFactory.h"
+
+/**
+ * @struct BenchResult
+ * @brief The outcome of one benchmark run.
+ */
+struct BenchResult
+{
+    double ops_per_sec; ///< Completed operations per second across all threads.
+    double hit_ratio;   ///< Fraction of GETs that found their key.
+};
+
+/**
+ * @brief Runs a mixed GET/SET workload against a cache.
+ *
+ * The cache is first filled to capacity. Worker threads then pick keys uniformly from a key space slightly larger
+ * than the cache, so that a small fraction of reads miss and some writes evict, and issue a GET with probability
+ * `read_ratio` or a SET otherwise.
+ *
+ * @param policy The eviction policy under test, or "epoch" for an `EpochCache`.
+ * @param threads The number of worker threads.
+ * @param capacity The cache capacity in entries.
+ * @param read_ratio The fraction of operations that are GETs.
+ * @param duration How long the workers run.
+ * @return The measured throughput and hit ratio.
+ */
+static BenchResult RunWorkload(const std::string &policy,
+                               size_t threads,
+                               size_t capacity,
+                               double read_ratio,
+                               std::chrono::seconds duration)
+{
+    std::unique_ptr<ICache> cache_under_test;
+    if (policy == "epoch")
+    {
+        cache_under_test = std::make_unique<EpochCache>(capacity);
+    }
+    else
+    {
+        cache_under_test = std::make_unique<Cache>(capacity, policy);
+    }
+    ICache &cache = *cache_under_test;
+
+    // The cache registers a DEBUG file logger; per-operation logging would dominate the measurement
+    LoggerManager::getInstance().setLogLevel(ILogger::LogLevel::WARNING);
+
+    const size_t key_space = capacity + capacity / 4;
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        cache.Set("key:" + std::to_string(i), "value:" + std::to_string(i), std::chrono::hours(1));
+    }
+
+    std::atomic<bool> running{true};
+    std::atomic<uint64_t> total_ops{0};
+    std::atomic<uint64_t> total_gets{0};
+    std::atomic<uint64_t> total_hits{0};
+
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]
+                             {
+            std::mt19937_64 rng(t + 1);
+            std::uniform_int_distribution<size_t> key_dist(0, key_space - 1);
+            std::uniform_real_distribution<double> op_dist(0.0, 1.0);
+            std::string value;
+            uint64_t ops = 0, gets = 0, hits = 0;
+
+            while (running.load(std::memory_order_relaxed))
+            {
+                std::string key = "key:" + std::to_string(key_dist(rng));
+                if (op_dist(rng) < read_ratio)
+                {
+                    ++gets;
+                    if (cache.Get(key, value))
+                    {
+                        ++hits;
+                    }
+                }
+                else
+                {
+                    cache.Set(key, "value", std::chrono::hours(1));
+                }
+                ++ops;
+            }
+
+            total_ops += ops;
+            total_gets += gets;
+            total_hits += hits; });
+    }
+
+    std::this_thread::sleep_for(duration);
+    running = false;
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    BenchResult result;
+    result.ops_per_sec = static_cast<double>(total_ops) / duration.count();
+    result.hit_ratio = total_gets ? static_cast<double>(total_hits) / total_gets : 0.0;
+    return result;
+}
+
+/**
+ * @brief Compares the eviction policies, and the `EpochCache` whose reads take no lock, on a read-heavy workload.
+ *
+ * Usage: MemifyBench [threads] [capacity] [seconds] [read_ratio]
+ *
+ * Defaults to the hardware concurrency, 100000 entries, 5 seconds per policy and a 99% read workload.
+ */
+int main(int argc, char *argv[])
+{
+    size_t threads = argc > 1 ? std::stoul(argv[1]) : std::max(1u, std::thread::hardware_concurrency());
+    size_t capacity = argc > 2 ? std::stoul(argv[2]) : 100000;
+    std::chrono::seconds duration(argc > 3 ? std::stol(argv[3]) : 5);
+    double read_ratio = argc > 4 ? std::stod(argv[4]) : 0.99;
+
+    std::cout << "threads=" << threads << " capacity=" << capacity
+              << " seconds=" << duration.count() << " read_ratio=" << read_ratio << std::endl;
+
+    std::vector<std::string> policies = EvictionPolicyNames();
+    policies.push_back("epoch");
+
+    for (const auto &policy : policies)
+    {
+        // The cache echoes every operation to stdout; silence it while the workload runs
+        std::cout.setstate(std::ios::badbit);
+        BenchResult result = RunWorkload(policy, threads, capacity, read_ratio, duration);
+        std::cout.clear();
+
+        std::cout << policy << ": " << static_cast<uint64_t>(result.ops_per_sec) << " ops/sec, hit ratio "
+                  << result.hit_ratio << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unistd.h>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "CacheItem.h"
+#include "SwissIndex.h"
+
+/**
+ * @struct IndexResult
+ * @brief The outcome of benchmarking one index.
+ */
+struct IndexResult
+{
+    double bytes_per_key; ///< Resident memory added per key, including the entries.
+    double hit_ns;        ///< Mean latency of a lookup that finds its key.
+    double miss_ns;       ///< Mean latency of a lookup for an absent key.
+};
+
+/**
+ * @brief Returns the resident set size of this process in bytes.
+ */
+static size_t ResidentBytes()
+{
+    long pages = 0, resident = 0;
+    FILE *statm = std::fopen("/proc/self/statm", "r");
+    if (statm != nullptr)
+    {
+        if (std::fscanf(statm, "%ld %ld", &pages, &resident) != 2)
+        {
+            resident = 0;
+        }
+        std::fclose(statm);
+    }
+    return static_cast<size_t>(resident) * sysconf(_SC_PAGESIZE);
+}
+
+/**
+ * @brief Returns freed heap memory to the OS so the next measurement starts from a clean baseline.
+ */
+static void TrimHeap()
+{
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+}
+
+/**
+ * @brief Times `lookup` over `probes` and returns the mean nanoseconds per call.
+ */
+template <typename Lookup>
+static double TimeLookups(const std::vector<std::string> &probes, Lookup lookup)
+{
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &key : probes)
+    {
+        found += lookup(key);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+    // Keep the lookups observable so they are not optimized away
+    if (found == size_t(-1))
+    {
+        std::cout << found << std::endl;
+    }
+    return elapsed.count() / probes.size();
+}
+
+/**
+ * @brief Benchmarks a node-based `std::unordered_map` from keys to values, the cache's original layout.
+ */
+static IndexResult BenchUnorderedMap(const std::vector<std::string> &keys,
+                                     const std::vector<std::string> &hits,
+                                     const std::vector<std::string> &misses)
+{
+    IndexResult result;
+    TrimHeap();
+    size_t before = ResidentBytes();
+    {
+        std::unordered_map<std::string, std::string> items;
+        for (const auto &key : keys)
+        {
+            items[key] = "1";
+        }
+        result.bytes_per_key = static_cast<double>(ResidentBytes() - before) / keys.size();
+
+        auto lookup = [&](const std::string &key)
+        { return items.find(key) != items.end() ? 1 : 0; };
+        result.hit_ns = TimeLookups(hits, lookup);
+        result.miss_ns = TimeLookups(misses, lookup);
+    }
+    return result;
+}
+
+/**
+ * @brief Benchmarks `SwissIndex` over slab-allocated entry records, as the cache uses it.
+ */
+static IndexResult BenchSwissIndex(const std::vector<std::string> &keys,
+                                   const std::vector<std::string> &hits,
+                                   const std::vector<std::string> &misses)
+{
+    IndexResult result;
+    TrimHeap();
+    size_t before = ResidentBytes();
+    {
+        SlabAllocator slabs;
+        SwissIndex items;
+        for (const auto &key : keys)
+        {
+            CacheItem *item = CacheItem::Create(slabs, key, "1");
+            item->hash = SwissIndex::Hash(key);
+            items.Insert(item);
+        }
+        result.bytes_per_key = static_cast<double>(ResidentBytes() - before) / keys.size();
+
+        auto lookup = [&](const std::string &key)
+        { return items.Find(key, SwissIndex::Hash(key)) != nullptr ? 1 : 0; };
+        result.hit_ns = TimeLookups(hits, lookup);
+        result.miss_ns = TimeLookups(misses, lookup);
+
+        for (size_t slot = 0; slot < items.SlotCount(); ++slot)
+        {
+            if (CacheItem *item = items.At(slot))
+            {
+                CacheItem::Destroy(slabs, item);
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Compares GET lookup latency and memory per key of the cache's key index and entry records against a
+ *        `std::unordered_map` of strings.
+ *
+ * Usage: MemifyIndexBench [keys] [lookups]
+ *
+ * Defaults to 10000000 keys and 10000000 random lookups each for present and absent keys.
+ */
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::stoul(argv[1]) : 10000000;
+    size_t lookups = argc > 2 ? std::stoul(argv[2]) : 10000000;
+
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        keys.push_back("key:" + std::to_string(i));
+    }
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<size_t> pick(0, count - 1);
+    std::vector<std::string> hits, misses;
+    hits.reserve(lookups);
+    misses.reserve(lookups);
+    for (size_t i = 0; i < lookups; ++i)
+    {
+        hits.push_back(keys[pick(rng)]);
+        misses.push_back("miss:" + std::to_string(pick(rng)));
+    }
+
+    std::cout << "keys=" << count << " lookups=" << lookups << " sizeof(CacheItem)=" << sizeof(CacheItem)
+              << std::endl;
+
+    IndexResult map = BenchUnorderedMap(keys, hits, misses);
+    std::cout << "unordered_map: " << map.bytes_per_key << " bytes/key, GET hit " << map.hit_ns << " ns, miss "
+              << map.miss_ns << " ns" << std::endl;
+
+    IndexResult swiss = BenchSwissIndex(keys, hits, misses);
+    std::cout << "swiss index:   " << swiss.bytes_per_key << " bytes/key, GET hit " << swiss.hit_ns << " ns, miss "
+              << swiss.miss_ns << " ns" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Cache.h"
+#include "LoggerManager.h"
+#include "EvictionPolicyFactory.h"
+
+/**
+ * @brief Loads a key trace into memory.
+ *
+ * Each non-empty line holds one key. A line may also be prefixed with an operation, as in "GET key" or
+ * "SET key"; the operation is ignored since every request is replayed as a read-through lookup.
+ *
+ * @param path The trace file.
+ * @param keys Receives the keys in trace order.
+ * @return false if the file cannot be opened.
+ */
+static bool LoadTrace(const std::string &path, std::vector<std::string> &keys)
+{
+    std::ifstream in(path);
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line);
+        std::string first, second;
+        if (!(fields >> first))
+        {
+            continue;
+        }
+        keys.push_back(fields >> second ? second : first);
+    }
+    return true;
+}
+
+/**
+ * @struct ReplayResult
+ * @brief The outcome of replaying a trace against one policy.
+ */
+struct ReplayResult
+{
+    double hit_ratio;   ///< Fraction of requests that hit.
+    double ops_per_sec; ///< Requests replayed per second.
+};
+
+/**
+ * @brief Replays a trace against a fresh cache using the given policy.
+ *
+ * Every request is a GET; a miss is followed by a SET of the key, like a read-through cache in front of a backing
+ * service.
+ *
+ * @param policy The eviction policy name.
+ * @param capacity The cache capacity in entries.
+ * @param keys The trace.
+ * @return The hit ratio and throughput.
+ * @throws std::invalid_argument If the policy name is unknown.
+ */
+static ReplayResult Replay(const std::string &policy, size_t capacity, const std::vector<std::string> &keys)
+{
+    Cache cache(capacity, policy);
+
+    // The cache registers a DEBUG file logger; per-operation logging would dominate the measurement
+    LoggerManager::getInstance().setLogLevel(ILogger::LogLevel::WARNING);
+
+    std::string value;
+    size_t hits = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &key : keys)
+    {
+        if (cache.Get(key, value))
+        {
+            ++hits;
+        }
+        else
+        {
+            cache.Set(key, key, std::chrono::hours(24));
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    ReplayResult result;
+    result.hit_ratio = keys.empty() ? 0.0 : static_cast<double>(hits) / keys.size();
+    result.ops_per_sec = elapsed.count() > 0 ? keys.size() / elapsed.count() : 0.0;
+    return result;
+}
+
+/**
+ * @brief Replays recorded key traces against each eviction policy and reports hit ratio and throughput.
+ *
+ * Usage: MemifyTraceReplay <trace-file> <capacity> [policy...]
+ *
+ * The trace is loaded before timing starts, so the reported ops/sec only covers cache work. All policies are
+ * replayed when none is named.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <trace-file> <capacity> [policy...]" << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> keys;
+    if (!LoadTrace(argv[1], keys))
+    {
+        std::cerr << "Can't open trace '" << argv[1] << "'" << std::endl;
+        return 1;
+    }
+    size_t capacity = std::stoul(argv[2]);
+
+    std::vector<std::string> policies(argv + 3, argv + argc);
+    if (policies.empty())
+    {
+        policies = EvictionPolicyNames();
+    }
+
+    std::cout << "requests=" << keys.size() << " capacity=" << capacity << std::endl;
+
+    for (const auto &policy : policies)
+    {
+        // The cache echoes every operation to stdout; silence it while replaying
+        std::cout.setstate(std::ios::badbit);
+        ReplayResult result;
+        try
+        {
+            result = Replay(policy, capacity, keys);
+        }
+        catch (const std::invalid_argument &e)
+        {
+            std::cout.clear();
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        std::cout.clear();
+
+        std::cout << policy << ": hit ratio " << result.hit_ratio << ", "
+                  << static_cast<uint64_t>(result.ops_per_sec) << " ops/sec" << std::endl;
+    }
+
+    return 0;
+}
@@ -36,13 +36,12 @@ FileLogger::~FileLogger()
  *
  * @param level The new log level to be set. Messages with a severity lower than this level will be ignored.
  *
- * Updates the internal log level to the specified value. The operation is performed inside a mutex lock to ensure
- * thread safety, preventing race conditions in a multi-threaded environment.
+ * Updates the internal log level to the specified value. The level is atomic, so it can be read by `log` without
+ * taking the mutex.
  */
 void FileLogger::setLogLevel(LogLevel level)
 {
-    std::lock_guard<std::mutex> lock(mutex_);
-    logLevel_ = level;
+    logLevel_.store(level, std::memory_order_relaxed);
 }
 
 /**
@@ -54,12 +53,17 @@ void FileLogger::setLogLevel(LogLevel level)
  * Checks if the provided log level is greater than or equal to the currently set log level. If so, the message
  * is written to the log file and the file is flushed to ensure that the message is immediately written to disk.
  * The logging operation is protected by a mutex to ensure that multiple threads do not interfere with each other's
- * logging operations.
+ * logging operations. Messages below the log level are dropped before the mutex is taken.
  */
 void FileLogger::log(LogLevel level, const std::string &message)
 {
+    if (level < logLevel_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
-    if (level >= logLevel_ && logFile_.is_open())
+    if (logFile_.is_open())
     {
         logFile_ << formatLogMessage(level, message);
         logFile_.flush();
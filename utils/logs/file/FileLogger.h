@@ -3,6 +3,7 @@
 #include "ILogger.h"
 #include <fstream>
 #include <mutex>
+#include <atomic>
 
 /**
  * @brief FileLogger is an implementation of the ILogger interface that logs messages to a file.
@@ -47,12 +48,13 @@ public:
      *
      * This method writes the provided message to the log file if its severity level is greater than or equal
      * to the currently set log level. The logging operation is protected by a mutex to ensure that multiple
-     * threads do not interfere with each other's logging operations.
+     * threads do not interfere with each other's logging operations. Filtered messages return before taking
+     * the mutex, so disabled log levels cost no contention.
      */
     void log(LogLevel level, const std::string &message) override;
 
 private:
     std::mutex mutex_;      ///< Mutex to ensure thread-safe logging.
     std::ofstream logFile_; ///< Output file stream for writing log messages.
-    LogLevel logLevel_;     ///< The current log level for filtering messages.
+    std::atomic<LogLevel> logLevel_; ///< The current log level for filtering messages.
 };
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "GlobMatch.h"
+
+/**
+ * @brief Matches one byte against the bracket expression starting after the `[` at `pattern[pos]`.
+ *
+ * @param pattern The pattern.
+ * @param pos The position after the opening bracket; on return, the position after the closing one.
+ * @param c The byte to match.
+ * @return `true` if the byte is in the set, taking negation into account.
+ */
+static bool MatchClass(std::string_view pattern, size_t &pos, unsigned char c)
+{
+    bool negate = pos < pattern.size() && (pattern[pos] == '^' || pattern[pos] == '!');
+    if (negate)
+    {
+        ++pos;
+    }
+
+    bool matched = false;
+    bool first = true;
+    while (pos < pattern.size() && (pattern[pos] != ']' || first))
+    {
+        first = false;
+        unsigned char low = static_cast<unsigned char>(pattern[pos]);
+        if (low == '\\' && pos + 1 < pattern.size())
+        {
+            low = static_cast<unsigned char>(pattern[++pos]);
+        }
+        ++pos;
+
+        unsigned char high = low;
+        if (pos + 1 < pattern.size() && pattern[pos] == '-' && pattern[pos + 1] != ']')
+        {
+            high = static_cast<unsigned char>(pattern[pos + 1]);
+            if (high == '\\' && pos + 2 < pattern.size())
+            {
+                high = static_cast<unsigned char>(pattern[pos + 2]);
+                ++pos;
+            }
+            pos += 2;
+            if (low > high)
+            {
+                unsigned char swap = low;
+                low = high;
+                high = swap;
+            }
+        }
+
+        if (c >= low && c <= high)
+        {
+            matched = true;
+        }
+    }
+
+    // Skip the closing bracket; an unterminated class runs to the end of the pattern
+    if (pos < pattern.size())
+    {
+        ++pos;
+    }
+    return matched != negate;
+}
+
+bool GlobMatch(std::string_view pattern, std::string_view text)
+{
+    size_t p = 0;
+    size_t t = 0;
+
+    // Where to resume after the most recent `*` if the rest of the pattern fails to match
+    size_t star_p = std::string_view::npos;
+    size_t star_t = 0;
+
+    while (t < text.size())
+    {
+        if (p < pattern.size())
+        {
+            char c = pattern[p];
+            if (c == '*')
+            {
+                // Collapse runs of stars, then first try matching the star against nothing
+                while (p < pattern.size() && pattern[p] == '*')
+                {
+                    ++p;
+                }
+                if (p == pattern.size())
+                {
+                    return true;
+                }
+                star_p = p;
+                star_t = t;
+                continue;
+            }
+
+            size_t next = p + 1;
+            bool matched;
+            if (c == '?')
+            {
+                matched = true;
+            }
+            else if (c == '[')
+            {
+                matched = MatchClass(pattern, next, static_cast<unsigned char>(text[t]));
+            }
+            else
+            {
+                if (c == '\\' && next < pattern.size())
+                {
+                    c = pattern[next++];
+                }
+                matched = c == text[t];
+            }
+
+            if (matched)
+            {
+                p = next;
+                ++t;
+                continue;
+            }
+        }
+
+        // Mismatch: let the last star absorb one more byte, or fail if there is none
+        if (star_p == std::string_view::npos)
+        {
+            return false;
+        }
+        p = star_p;
+        t = ++star_t;
+    }
+
+    // The text is consumed; only stars may remain in the pattern
+    while (p < pattern.size() && pattern[p] == '*')
+    {
+        ++p;
+    }
+    return p == pattern.size();
+}
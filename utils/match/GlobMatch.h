@@ -0,0 +1,24 @@
+#ifndef GLOB_MATCH_H
+#define GLOB_MATCH_H
+
+#include <string_view>
+
+/**
+ * @brief Matches a string against a glob-style pattern, as used by the SCAN command's MATCH option.
+ *
+ * Supported syntax:
+ *  - `*` matches any sequence of bytes, including the empty one.
+ *  - `?` matches any single byte.
+ *  - `[abc]`, `[a-z]` match one byte from the set or range; `[^abc]` and `[!abc]` match one byte not in it.
+ *  - `\` makes the next byte literal, also inside brackets.
+ *
+ * Matching is byte-wise and case-sensitive. It backtracks only to the most recent `*`, so it runs in
+ * O(pattern * text) time in the worst case and never recurses.
+ *
+ * @param pattern The pattern.
+ * @param text The string to match.
+ * @return `true` if the whole string matches the pattern.
+ */
+bool GlobMatch(std::string_view pattern, std::string_view text);
+
+#endif // GLOB_MATCH_H
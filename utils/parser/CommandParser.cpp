@@ -3,6 +3,8 @@
 #include <sstream>
 #include <iostream>
 
+#include "RequestTiming.h"
+
 // Parses an input string into an MESPObject based on its type.
 // The input string is expected to start with a character that indicates the MESP type:
 // '+' for SimpleString, '-' for Error, ':' for Integer, '$' for BulkString, and '*' for Array.
@@ -56,6 +58,9 @@ MESPObject CommandParser::parse(std::string &input)
 // @throws std::runtime_error If the MESPObject has an unknown type.
 std::string CommandParser::serializeResponse(const MESPObject &obj)
 {
+    // Charge the serialization to the current request's serialize stage; nested arrays are not counted twice
+    RequestTiming::Scope scope(Stage::kSerialize);
+
     switch (obj.type)
     {
     case MESPType::SimpleString:
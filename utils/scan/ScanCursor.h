@@ -0,0 +1,36 @@
+#ifndef SCAN_CURSOR_H
+#define SCAN_CURSOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Reverses the bits of a 64-bit word.
+ */
+inline uint64_t ReverseBits(uint64_t v)
+{
+    v = ((v >> 1) & 0x5555555555555555ULL) | ((v & 0x5555555555555555ULL) << 1);
+    v = ((v >> 2) & 0x3333333333333333ULL) | ((v & 0x3333333333333333ULL) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((v & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return __builtin_bswap64(v);
+}
+
+/**
+ * @brief Advances a stateless scan cursor over a power-of-two table, incrementing it in reversed bit order.
+ *
+ * The high bucket bits advance first. When the table doubles, each bucket splits into two whose indexes share its
+ * low bits, so a scan that spans the resize still visits every key that exists throughout, possibly twice.
+ *
+ * @param cursor The bucket just visited.
+ * @param mask The number of buckets minus one.
+ * @return The next bucket to visit, or 0 once every bucket has been visited.
+ */
+inline size_t NextReverseCursor(size_t cursor, size_t mask)
+{
+    uint64_t next = cursor | ~static_cast<uint64_t>(mask);
+    next = ReverseBits(next);
+    ++next;
+    return static_cast<size_t>(ReverseBits(next));
+}
+
+#endif // SCAN_CURSOR_H
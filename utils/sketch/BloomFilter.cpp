@@ -0,0 +1,70 @@
+#include "BloomFilter.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    /**
+     * @brief Derives the two base hashes for double hashing; the second is odd, so probes never repeat a stride of
+     *        zero.
+     */
+    inline void BaseHashes(uint64_t hash, uint64_t &h1, uint64_t &h2)
+    {
+        h1 = hash * 0x9e3779b97f4a7c15ULL;
+        h1 ^= h1 >> 29;
+        h2 = ((hash >> 32) | (hash << 32)) * 0xc2b2ae3d27d4eb4fULL;
+        h2 = (h2 ^ (h2 >> 31)) | 1;
+    }
+}
+
+BloomFilter::BloomFilter(size_t expected_keys)
+{
+    size_t bits = BitsFor(expected_keys);
+    words_.assign(bits / 64, 0);
+    bit_mask_ = bits - 1;
+}
+
+size_t BloomFilter::BitsFor(size_t expected_keys)
+{
+    // Saturate instead of overflowing, and stop doubling before the top bit so the loop always ends
+    const size_t max_bits = (std::numeric_limits<size_t>::max() >> 1) + 1;
+    size_t wanted = expected_keys > max_bits / kBitsPerKey ? max_bits : expected_keys * kBitsPerKey;
+    size_t bits = 64;
+    while (bits < wanted && bits < max_bits)
+    {
+        bits <<= 1;
+    }
+    return bits;
+}
+
+void BloomFilter::Add(uint64_t hash)
+{
+    uint64_t h1, h2;
+    BaseHashes(hash, h1, h2);
+    for (size_t i = 0; i < kProbes; ++i)
+    {
+        size_t bit = static_cast<size_t>(h1 + i * h2) & bit_mask_;
+        words_[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+}
+
+bool BloomFilter::MayContain(uint64_t hash) const
+{
+    uint64_t h1, h2;
+    BaseHashes(hash, h1, h2);
+    for (size_t i = 0; i < kProbes; ++i)
+    {
+        size_t bit = static_cast<size_t>(h1 + i * h2) & bit_mask_;
+        if ((words_[bit >> 6] & (uint64_t(1) << (bit & 63))) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void BloomFilter::Clear()
+{
+    std::fill(words_.begin(), words_.end(), 0);
+}
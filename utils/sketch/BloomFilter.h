@@ -0,0 +1,73 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class BloomFilter
+ * @brief A set of key hashes that answers "maybe present" or "definitely absent".
+ *
+ * Sized for about 1% false positives at the expected number of keys: ten bits and seven probes per key. Probe
+ * positions are derived from the key's 64-bit hash by double hashing, so keys are never rehashed. Keys cannot be
+ * removed; the owner clears the filter and adds the remaining keys again when too many are stale.
+ *
+ * @note The filter is not synchronized.
+ */
+class BloomFilter
+{
+public:
+    static constexpr size_t kBitsPerKey = 10; ///< Bits allotted to each expected key.
+    static constexpr size_t kProbes = 7;      ///< Bits set per key; optimal for `kBitsPerKey`.
+    static constexpr size_t kMaxExpectedKeys = size_t(1) << 28; ///< The largest capacity clients may reserve; 512 MiB.
+
+    /**
+     * @brief Creates an empty filter for about `expected_keys` keys, rounded up to a power-of-two number of bits.
+     *
+     * The size is computed without overflow, but callers should bound `expected_keys`, for example by
+     * `kMaxExpectedKeys`, since the bits are allocated up front.
+     */
+    explicit BloomFilter(size_t expected_keys);
+
+    /**
+     * @brief Adds a key.
+     *
+     * @param hash The key's hash.
+     */
+    void Add(uint64_t hash);
+
+    /**
+     * @brief Checks whether a key may have been added.
+     *
+     * @param hash The key's hash.
+     * @return `false` only if the key was never added since the last `Clear`.
+     */
+    bool MayContain(uint64_t hash) const;
+
+    /**
+     * @brief Removes every key.
+     */
+    void Clear();
+
+    /**
+     * @brief Returns the bytes allocated for the bits.
+     */
+    size_t MemoryBytes() const { return words_.size() * sizeof(uint64_t); }
+
+    /**
+     * @brief Returns the bytes a filter for `expected_keys` keys allocates, without creating it.
+     */
+    static size_t MemoryBytesFor(size_t expected_keys) { return BitsFor(expected_keys) / 8; }
+
+private:
+    std::vector<uint64_t> words_; ///< The bits, 64 per word.
+    size_t bit_mask_;             ///< The number of bits minus one.
+
+    /**
+     * @brief Returns the number of bits of a filter for `expected_keys` keys: a power of two of at least 64.
+     */
+    static size_t BitsFor(size_t expected_keys);
+};
+
+#endif // BLOOM_FILTER_H
@@ -0,0 +1,79 @@
+#include "CountMinSketch.h"
+
+CountMinSketch::CountMinSketch(size_t width)
+    : width_(1)
+{
+    while (width_ < width)
+    {
+        width_ <<= 1;
+    }
+    table_.reset(new std::atomic<uint32_t>[kDepth * width_]);
+    Clear();
+}
+
+/**
+ * @brief Derives a per-row counter index by remixing the key hash with a row-specific seed.
+ */
+size_t CountMinSketch::RowIndex(uint64_t hash, size_t row, size_t mask)
+{
+    static const uint64_t kSeeds[kDepth] = {
+        0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+
+    uint64_t h = (hash + kSeeds[row]) * 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 32;
+    return static_cast<size_t>(h) & mask;
+}
+
+std::atomic<uint32_t> &CountMinSketch::Counter(uint64_t hash, size_t row) const
+{
+    return table_[row * width_ + RowIndex(hash, row, width_ - 1)];
+}
+
+/**
+ * @brief Adds to the key's counter in every row, saturating at `UINT32_MAX`, and returns the smallest result.
+ *
+ * A wrapped counter would make the key look rare, so counters stop at their maximum instead.
+ */
+uint32_t CountMinSketch::Add(uint64_t hash, uint32_t count)
+{
+    uint32_t estimate = UINT32_MAX;
+    for (size_t row = 0; row < kDepth; ++row)
+    {
+        std::atomic<uint32_t> &counter = Counter(hash, row);
+        uint32_t value = counter.load(std::memory_order_relaxed);
+        uint32_t updated;
+        do
+        {
+            updated = value > UINT32_MAX - count ? UINT32_MAX : value + count;
+        } while (!counter.compare_exchange_weak(value, updated, std::memory_order_relaxed));
+        estimate = updated < estimate ? updated : estimate;
+    }
+    return estimate;
+}
+
+uint32_t CountMinSketch::Estimate(uint64_t hash) const
+{
+    uint32_t estimate = UINT32_MAX;
+    for (size_t row = 0; row < kDepth; ++row)
+    {
+        uint32_t value = Counter(hash, row).load(std::memory_order_relaxed);
+        estimate = value < estimate ? value : estimate;
+    }
+    return estimate;
+}
+
+void CountMinSketch::Halve()
+{
+    for (size_t i = 0; i < kDepth * width_; ++i)
+    {
+        table_[i].store(table_[i].load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+}
+
+void CountMinSketch::Clear()
+{
+    for (size_t i = 0; i < kDepth * width_; ++i)
+    {
+        table_[i].store(0, std::memory_order_relaxed);
+    }
+}
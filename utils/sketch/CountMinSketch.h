@@ -0,0 +1,80 @@
+#ifndef COUNT_MIN_SKETCH_H
+#define COUNT_MIN_SKETCH_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @class CountMinSketch
+ * @brief A count-min sketch of 32-bit counters that can be updated concurrently.
+ *
+ * Each key hash maps to one counter in each of `kDepth` rows; the estimate is the minimum of those counters, which
+ * never underestimates and overestimates by at most `2N / width` with high probability, where N is the total count.
+ * Counters are relaxed atomics, so any number of threads can add and estimate without a lock; `Halve` running
+ * concurrently with additions may lose a few of them, which only makes the estimate slightly lower. Counters
+ * saturate at `UINT32_MAX` rather than wrap.
+ */
+class CountMinSketch
+{
+public:
+    static constexpr size_t kDepth = 4; ///< Number of rows (hash functions).
+
+    /**
+     * @brief Creates a sketch with `width` counters per row, rounded up to a power of two.
+     */
+    explicit CountMinSketch(size_t width);
+
+    /**
+     * @brief Records `count` occurrences of a key.
+     *
+     * @param hash The key's hash.
+     * @param count The number of occurrences.
+     * @return The key's estimate after the addition, at most `UINT32_MAX`.
+     */
+    uint32_t Add(uint64_t hash, uint32_t count = 1);
+
+    /**
+     * @brief Estimates how often a key occurred.
+     */
+    uint32_t Estimate(uint64_t hash) const;
+
+    /**
+     * @brief Halves every counter, so the sketch reflects recent occurrences rather than all-time counts.
+     */
+    void Halve();
+
+    /**
+     * @brief Resets every counter to zero.
+     */
+    void Clear();
+
+    /**
+     * @brief Returns the number of counters per row.
+     */
+    size_t Width() const { return width_; }
+
+    /**
+     * @brief Returns the counter index of a key hash in the given row of a count-min sketch.
+     *
+     * Shared with other count-min layouts, such as the packed TinyLFU admission filter, so the hashing is tuned in
+     * one place.
+     *
+     * @param hash The key's hash.
+     * @param row The row, less than `kDepth`.
+     * @param mask The number of counters per row, a power of two, minus one.
+     */
+    static size_t RowIndex(uint64_t hash, size_t row, size_t mask);
+
+private:
+    size_t width_;                                  ///< Counters per row, a power of two.
+    std::unique_ptr<std::atomic<uint32_t>[]> table_; ///< `kDepth` rows of `width_` counters.
+
+    /**
+     * @brief Returns the counter of a hash in the given row.
+     */
+    std::atomic<uint32_t> &Counter(uint64_t hash, size_t row) const;
+};
+
+#endif // COUNT_MIN_SKETCH_H
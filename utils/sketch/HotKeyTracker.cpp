@@ -0,0 +1,134 @@
+#include <algorithm>
+
+#include "HotKeyTracker.h"
+
+namespace
+{
+    /**
+     * @brief Orders heap entries so that `std::push_heap` and friends keep the smallest count at the front.
+     */
+    template <typename Entry>
+    bool GreaterCount(const Entry &a, const Entry &b)
+    {
+        return a.count > b.count;
+    }
+}
+
+HotKeyTracker::HotKeyTracker(size_t capacity, size_t sketch_width)
+    : capacity_(capacity), sketch_(sketch_width)
+{
+    heap_.reserve(capacity_);
+}
+
+/**
+ * @brief Draws from a per-thread xorshift generator, so threads never contend and periodic access patterns do not
+ *        alias with the sampling.
+ */
+bool HotKeyTracker::Sampled(uint32_t rate)
+{
+    thread_local uint32_t state = 0x9e3779b9u ^ static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&state));
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return rate == 1 || state % rate == 0;
+}
+
+void HotKeyTracker::RecordSample(std::string_view key, uint64_t hash)
+{
+    uint32_t estimate = sketch_.Add(hash);
+
+    // Only the sample that reaches the window's end ages the counts, so concurrent samplers halve them once
+    if (samples_.fetch_add(1, std::memory_order_relaxed) + 1 == 10 * sketch_.Width())
+    {
+        Age();
+        return;
+    }
+
+    // Most samples are of cold keys that cannot enter a full heap; skip the lock for them
+    if (estimate <= admit_threshold_.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto existing = std::find_if(heap_.begin(), heap_.end(), [&](const Entry &entry)
+                                 { return entry.hash == hash && entry.key == key; });
+    if (existing != heap_.end())
+    {
+        existing->count = estimate;
+        std::make_heap(heap_.begin(), heap_.end(), GreaterCount<Entry>);
+    }
+    else if (heap_.size() < capacity_)
+    {
+        heap_.push_back(Entry{std::string(key), hash, estimate});
+        std::push_heap(heap_.begin(), heap_.end(), GreaterCount<Entry>);
+    }
+    else if (estimate > heap_.front().count)
+    {
+        std::pop_heap(heap_.begin(), heap_.end(), GreaterCount<Entry>);
+        heap_.back() = Entry{std::string(key), hash, estimate};
+        std::push_heap(heap_.begin(), heap_.end(), GreaterCount<Entry>);
+    }
+
+    if (heap_.size() == capacity_)
+    {
+        admit_threshold_.store(heap_.front().count, std::memory_order_relaxed);
+    }
+}
+
+void HotKeyTracker::Age()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    samples_.store(0, std::memory_order_relaxed);
+    sketch_.Halve();
+    for (auto &entry : heap_)
+    {
+        entry.count /= 2;
+    }
+    if (heap_.size() == capacity_)
+    {
+        admit_threshold_.store(heap_.front().count, std::memory_order_relaxed);
+    }
+}
+
+void HotKeyTracker::SetSampleRate(uint32_t sample_rate)
+{
+    sample_rate_.store(sample_rate, std::memory_order_relaxed);
+    Reset();
+}
+
+void HotKeyTracker::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    sketch_.Clear();
+    samples_.store(0, std::memory_order_relaxed);
+    heap_.clear();
+    admit_threshold_.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Copies the heap under its mutex and sorts the copy, so callers never hold up recording for long.
+ */
+std::vector<HotKey> HotKeyTracker::Top(size_t count) const
+{
+    std::vector<Entry> entries;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries = heap_;
+    }
+
+    std::sort(entries.begin(), entries.end(), GreaterCount<Entry>);
+    if (entries.size() > count)
+    {
+        entries.resize(count);
+    }
+
+    uint64_t scale = std::max<uint32_t>(SampleRate(), 1);
+    std::vector<HotKey> result;
+    result.reserve(entries.size());
+    for (auto &entry : entries)
+    {
+        result.push_back(HotKey{std::move(entry.key), entry.count * scale});
+    }
+    return result;
+}
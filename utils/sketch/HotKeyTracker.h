@@ -0,0 +1,127 @@
+#ifndef HOT_KEY_TRACKER_H
+#define HOT_KEY_TRACKER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CountMinSketch.h"
+
+/**
+ * @struct HotKey
+ * @brief A frequently accessed key, as reported by the HOTKEYS command.
+ */
+struct HotKey
+{
+    std::string key; ///< The key.
+    uint64_t count;  ///< The estimated number of accesses since the counts were last aged or reset.
+};
+
+/**
+ * @class HotKeyTracker
+ * @brief Finds the most frequently accessed keys from a sample of the accesses.
+ *
+ * One access in `sample_rate` (chosen at random per thread) is counted in a `CountMinSketch`. The sampled key then
+ * competes for a place in a min-heap of the `capacity` keys with the highest estimates. After `10 * width` samples,
+ * the sketch and the heap counts are halved, so the ranking follows the current traffic rather than all-time
+ * totals. Reported counts are scaled back up by the sample rate.
+ *
+ * With sampling disabled, `Record` costs one relaxed atomic load. With it enabled, an unsampled access costs a few
+ * arithmetic operations on thread-local state. A sampled one adds a compare-and-swap on one counter per sketch row,
+ * which saturates rather than wraps, and an increment of the sample count; it takes the heap's mutex only when the
+ * key's estimate beats the smallest count in a full heap. One sample per window also pays for the aging: it takes
+ * the mutex and halves every sketch counter and heap count.
+ */
+class HotKeyTracker
+{
+public:
+    static constexpr size_t kDefaultCapacity = 64;      ///< Keys kept in the top-K heap.
+    static constexpr size_t kDefaultSketchWidth = 4096; ///< Counters per sketch row.
+
+    /**
+     * @brief Creates a tracker with sampling disabled.
+     *
+     * @param capacity The number of hot keys kept.
+     * @param sketch_width The counters per sketch row.
+     */
+    explicit HotKeyTracker(size_t capacity = kDefaultCapacity, size_t sketch_width = kDefaultSketchWidth);
+
+    /**
+     * @brief Records an access to a key, if it is sampled.
+     *
+     * @param key The key.
+     * @param hash The key's hash.
+     */
+    void Record(std::string_view key, uint64_t hash)
+    {
+        uint32_t rate = sample_rate_.load(std::memory_order_relaxed);
+        if (rate != 0 && Sampled(rate))
+        {
+            RecordSample(key, hash);
+        }
+    }
+
+    /**
+     * @brief Sets the sample rate and forgets the counts so far.
+     *
+     * @param sample_rate Count one access in `sample_rate`; 1 counts every access and 0 disables tracking.
+     */
+    void SetSampleRate(uint32_t sample_rate);
+
+    /**
+     * @brief Returns the sample rate, 0 if tracking is disabled.
+     */
+    uint32_t SampleRate() const { return sample_rate_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Forgets the counts so far.
+     */
+    void Reset();
+
+    /**
+     * @brief Returns the hottest keys, by decreasing estimated access count.
+     *
+     * @param count The most keys to return.
+     */
+    std::vector<HotKey> Top(size_t count) const;
+
+private:
+    /**
+     * @brief An entry of the top-K heap.
+     */
+    struct Entry
+    {
+        std::string key;
+        uint64_t hash;
+        uint32_t count;
+    };
+
+    std::atomic<uint32_t> sample_rate_{0}; ///< One access in this many is counted, or 0 if disabled.
+    size_t capacity_;                       ///< The most entries in `heap_`.
+    CountMinSketch sketch_;                 ///< Sampled access counts.
+    std::atomic<uint64_t> samples_{0};      ///< Samples since the counts were last halved.
+    std::atomic<uint32_t> admit_threshold_{0}; ///< The smallest count in a full heap; 0 while it is not full.
+    mutable std::mutex mutex_;              ///< Protects `heap_`.
+    std::vector<Entry> heap_;               ///< The hottest keys, a min-heap by count.
+
+    /**
+     * @brief Decides whether the calling thread's current access is sampled.
+     */
+    static bool Sampled(uint32_t rate);
+
+    /**
+     * @brief Counts a sampled access and updates the heap.
+     */
+    void RecordSample(std::string_view key, uint64_t hash);
+
+    /**
+     * @brief Halves the sketch and the heap counts.
+     */
+    void Age();
+};
+
+#endif // HOT_KEY_TRACKER_H
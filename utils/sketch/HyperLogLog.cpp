@@ -0,0 +1,89 @@
+#include "HyperLogLog.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+HyperLogLog::HyperLogLog() : registers_(new uint8_t[kRegisters]())
+{
+}
+
+HyperLogLog::HyperLogLog(const HyperLogLog &other) : registers_(new uint8_t[kRegisters])
+{
+    std::memcpy(registers_.get(), other.registers_.get(), kRegisters);
+}
+
+HyperLogLog &HyperLogLog::operator=(const HyperLogLog &other)
+{
+    std::memcpy(registers_.get(), other.registers_.get(), kRegisters);
+    return *this;
+}
+
+bool HyperLogLog::Add(uint64_t hash)
+{
+    size_t index = static_cast<size_t>(hash >> (64 - kPrecision));
+
+    // The sentinel bit caps the run at the 64 - kPrecision bits that are left
+    uint64_t rest = (hash << kPrecision) | (uint64_t(1) << (kPrecision - 1));
+    uint8_t rank = static_cast<uint8_t>(__builtin_clzll(rest) + 1);
+
+    if (rank > registers_[index])
+    {
+        registers_[index] = rank;
+        return true;
+    }
+    return false;
+}
+
+void HyperLogLog::Merge(const HyperLogLog &other)
+{
+    uint8_t *dst = registers_.get();
+    const uint8_t *src = other.registers_.get();
+#ifdef __SSE2__
+    for (size_t i = 0; i < kRegisters; i += 16)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_max_epu8(a, b));
+    }
+#else
+    for (size_t i = 0; i < kRegisters; ++i)
+    {
+        dst[i] = std::max(dst[i], src[i]);
+    }
+#endif
+}
+
+/**
+ * @brief Sums a histogram of register values rather than each register's `2^-value`, so the floating-point work
+ *        is proportional to the number of distinct values, not of registers.
+ */
+uint64_t HyperLogLog::Count() const
+{
+    uint32_t histogram[65] = {};
+    for (size_t i = 0; i < kRegisters; ++i)
+    {
+        ++histogram[registers_[i]];
+    }
+
+    double sum = 0.0;
+    for (int value = 64; value >= 0; --value)
+    {
+        sum = sum * 0.5 + histogram[value];
+    }
+
+    const double m = static_cast<double>(kRegisters);
+    const double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double estimate = alpha * m * m / sum;
+
+    // Small cardinalities leave many registers empty, where linear counting is more accurate
+    if (estimate <= 2.5 * m && histogram[0] != 0)
+    {
+        estimate = m * std::log(m / histogram[0]);
+    }
+    return static_cast<uint64_t>(estimate + 0.5);
+}
@@ -0,0 +1,110 @@
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Adds the histogram's values to a snapshot.
+ *
+ * The fields are read one at a time while the writer may still be recording, so the snapshot can miss a value's
+ * sum but not its bucket, or the reverse; each field on its own only ever grows.
+ *
+ * @param snapshot The snapshot to add to.
+ */
+void LatencyHistogram::AddTo(LatencySnapshot &snapshot) const
+{
+    if (snapshot.counts.empty())
+    {
+        snapshot.counts.assign(kBuckets, 0);
+    }
+
+    for (size_t i = 0; i < kBuckets; ++i)
+    {
+        uint64_t count = counts_[i].load(std::memory_order_relaxed);
+        snapshot.counts[i] += count;
+        snapshot.count += count;
+    }
+    snapshot.sum += sum_.load(std::memory_order_relaxed);
+    snapshot.max = std::max(snapshot.max, max_.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Returns the largest value recorded in a bucket.
+ *
+ * @param index The bucket, below `kBuckets`.
+ * @return The bucket's upper bound in nanoseconds.
+ */
+uint64_t LatencyHistogram::BucketUpperBound(size_t index)
+{
+    if (index < kSubBuckets)
+    {
+        return index;
+    }
+
+    size_t offset = index - kSubBuckets;
+    unsigned shift = static_cast<unsigned>(offset / (kSubBuckets / 2)) + 1;
+    uint64_t sub_bucket = offset % (kSubBuckets / 2) + kSubBuckets / 2;
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+/**
+ * @brief Removes the values of an earlier snapshot of the same histograms, as if they were never recorded.
+ *
+ * Histograms only grow, so every bucket of the baseline is at most the matching bucket here. The largest value
+ * recorded since the baseline is not known exactly; it is bounded by the highest bucket still holding a value.
+ *
+ * @param baseline The earlier snapshot.
+ */
+void LatencySnapshot::Subtract(const LatencySnapshot &baseline)
+{
+    if (baseline.counts.empty() || counts.empty())
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+        counts[i] -= std::min(counts[i], baseline.counts[i]);
+    }
+    count -= std::min(count, baseline.count);
+    sum -= std::min(sum, baseline.sum);
+
+    size_t highest = counts.size();
+    while (highest > 0 && counts[highest - 1] == 0)
+    {
+        --highest;
+    }
+    max = highest == 0 ? 0 : std::min(max, LatencyHistogram::BucketUpperBound(highest - 1));
+}
+
+/**
+ * @brief Returns the value below or at which a percentage of the recorded values fall.
+ *
+ * The value is the upper bound of the bucket holding the value of that rank, capped by the largest value recorded,
+ * so it overstates the exact percentile by at most the histogram's relative error.
+ *
+ * @param percentile The percentage, from 0 to 100.
+ * @return The value in nanoseconds, or 0 if nothing was recorded.
+ */
+uint64_t LatencySnapshot::ValueAtPercentile(double percentile) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count)));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+        {
+            return std::min(LatencyHistogram::BucketUpperBound(i), max);
+        }
+    }
+    return max;
+}
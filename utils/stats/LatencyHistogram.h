@@ -0,0 +1,116 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief A merged, non-atomic copy of one or more `LatencyHistogram`s that percentiles are computed from.
+ */
+struct LatencySnapshot
+{
+    std::vector<uint64_t> counts; ///< The number of values recorded in each bucket; empty until something is added.
+    uint64_t count = 0;           ///< The number of values recorded.
+    uint64_t sum = 0;             ///< The sum of the values recorded.
+    uint64_t max = 0;             ///< The largest value recorded.
+
+    /**
+     * @brief Removes the values of an earlier snapshot of the same histograms, as if they were never recorded.
+     */
+    void Subtract(const LatencySnapshot &baseline);
+
+    /**
+     * @brief Returns the value below or at which a percentage of the recorded values fall.
+     */
+    uint64_t ValueAtPercentile(double percentile) const;
+
+    /**
+     * @brief Returns the mean of the recorded values, or 0 if none was.
+     */
+    uint64_t Mean() const
+    {
+        return count == 0 ? 0 : sum / count;
+    }
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief A fixed-size histogram of durations in nanoseconds with a bounded relative error, as in HdrHistogram.
+ *
+ * Values below `kSubBuckets` get a bucket each. Above, every power-of-two range is split into `kSubBuckets / 2`
+ * equal buckets, so a value is known to within 1/64 of itself, that is about 1.6%, whatever its magnitude. Values
+ * from 2^`kMaxBits` ns, about 68 seconds, are recorded in the last bucket.
+ *
+ * A histogram has a single writer, so `Record` is a plain load and store on each field rather than a locked add;
+ * the fields are atomic only so that other threads can read them while it records.
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr unsigned kSubBucketBits = 7;                    ///< Bits of each value kept exactly.
+    static constexpr size_t kSubBuckets = size_t(1) << kSubBucketBits; ///< Buckets for the values below 128.
+    static constexpr unsigned kMaxBits = 36;                         ///< Values from 2^36 ns share the last bucket.
+    static constexpr size_t kBuckets = kSubBuckets + (kMaxBits - kSubBucketBits) * (kSubBuckets / 2); ///< Buckets.
+
+    /**
+     * @brief Records one value; must only be called by the histogram's writer.
+     *
+     * @param value The duration in nanoseconds.
+     */
+    void Record(uint64_t value)
+    {
+        Increment(counts_[BucketIndex(value)], 1);
+        Increment(sum_, value);
+        if (value > max_.load(std::memory_order_relaxed))
+        {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Adds the histogram's values to a snapshot; may be called by any thread.
+     */
+    void AddTo(LatencySnapshot &snapshot) const;
+
+    /**
+     * @brief Returns the bucket a value is recorded in.
+     */
+    static size_t BucketIndex(uint64_t value)
+    {
+        if (value < kSubBuckets)
+        {
+            return static_cast<size_t>(value);
+        }
+        if (value >= (uint64_t(1) << kMaxBits))
+        {
+            return kBuckets - 1;
+        }
+
+        // Keep the top kSubBucketBits - 1 bits below the leading one
+        unsigned shift = 63 - __builtin_clzll(value) - (kSubBucketBits - 1);
+        return kSubBuckets + (shift - 1) * (kSubBuckets / 2) + static_cast<size_t>((value >> shift) - kSubBuckets / 2);
+    }
+
+    /**
+     * @brief Returns the largest value recorded in a bucket.
+     */
+    static uint64_t BucketUpperBound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, kBuckets> counts_{}; ///< The number of values recorded in each bucket.
+    std::atomic<uint64_t> sum_{0};                         ///< The sum of the values recorded.
+    std::atomic<uint64_t> max_{0};                         ///< The largest value recorded.
+
+    /**
+     * @brief Adds to a field with a load and a store, which is enough with a single writer.
+     */
+    static void Increment(std::atomic<uint64_t> &field, uint64_t amount)
+    {
+        field.store(field.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+};
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,344 @@
+#include "LatencyTracker.h"
+
+#include <algorithm>
+
+/**
+ * @brief Creates the tracker with "UNKNOWN" as the command of id 0.
+ */
+LatencyTracker::LatencyTracker()
+{
+    names_.push_back("UNKNOWN");
+    ids_.emplace("UNKNOWN", 0);
+    baselines_.resize(kMaxCommands);
+    stage_baselines_.resize(kMaxCommands);
+}
+
+/**
+ * @brief Returns the process-wide tracker.
+ *
+ * The tracker is never destroyed, so threads that exit after `main` returns can still hand back their slots.
+ */
+LatencyTracker &LatencyTracker::Instance()
+{
+    static LatencyTracker *instance = new LatencyTracker();
+    return *instance;
+}
+
+/**
+ * @brief Records the duration of one command.
+ *
+ * The command's histogram for the calling thread is allocated the first time the thread runs the command.
+ *
+ * @param command The command's name.
+ * @param nanoseconds The command's duration.
+ */
+void LatencyTracker::Record(const std::string &command, uint64_t nanoseconds)
+{
+    size_t id = CommandId(command);
+    std::atomic<LatencyHistogram *> &slot = LocalSlot()->histograms[id];
+
+    LatencyHistogram *histogram = slot.load(std::memory_order_relaxed);
+    if (histogram == nullptr)
+    {
+        histogram = new LatencyHistogram();
+        slot.store(histogram, std::memory_order_release);
+    }
+    histogram->Record(nanoseconds);
+}
+
+/**
+ * @brief Records the per-stage times of one request.
+ *
+ * @param command The command's name.
+ * @param durations The time spent in each stage, indexed by `Stage`.
+ */
+void LatencyTracker::RecordStages(const std::string &command,
+                                  const std::array<uint64_t, RequestTiming::kStages> &durations)
+{
+    size_t id = CommandId(command);
+    std::atomic<StageTotals *> &slot = LocalSlot()->stages[id];
+
+    StageTotals *totals = slot.load(std::memory_order_relaxed);
+    if (totals == nullptr)
+    {
+        totals = new StageTotals();
+        slot.store(totals, std::memory_order_release);
+    }
+
+    // A single writer, so a load and a store rather than a locked add
+    for (size_t i = 0; i < RequestTiming::kStages; ++i)
+    {
+        totals->nanoseconds[i].store(totals->nanoseconds[i].load(std::memory_order_relaxed) + durations[i],
+                                     std::memory_order_relaxed);
+    }
+    totals->requests.store(totals->requests.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Returns the id of a command name, interning it on first use.
+ *
+ * Each thread caches the ids it has looked up, so the tracker's lock is only taken the first time a thread sees a
+ * command. Ids are never reassigned, so the cache never goes stale.
+ *
+ * @param command The command's name.
+ * @return The command's id, or 0 ("UNKNOWN") if every id is taken.
+ */
+size_t LatencyTracker::CommandId(const std::string &command)
+{
+    thread_local std::unordered_map<std::string, size_t> cached;
+
+    auto it = cached.find(command);
+    if (it != cached.end())
+    {
+        return it->second;
+    }
+
+    size_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto known = ids_.find(command);
+        if (known != ids_.end())
+        {
+            id = known->second;
+        }
+        else if (names_.size() < kMaxCommands)
+        {
+            id = names_.size();
+            names_.push_back(command);
+            ids_.emplace(command, id);
+        }
+    }
+
+    cached.emplace(command, id);
+    return id;
+}
+
+/**
+ * @brief Returns the calling thread's slot, claiming one on first use.
+ *
+ * A slot released by an exited thread is reused, histograms included, before a new one is allocated, so there are
+ * only as many slots as the most threads that have recorded at the same time.
+ *
+ * @return The slot, owned by the calling thread until it exits.
+ */
+LatencyTracker::ThreadSlot *LatencyTracker::LocalSlot()
+{
+    /**
+     * @brief Hands the slot back when its thread exits.
+     */
+    struct Owner
+    {
+        ThreadSlot *slot = nullptr;
+
+        ~Owner()
+        {
+            if (slot != nullptr)
+            {
+                // Release, so that the next owner's plain increments follow this thread's
+                slot->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+    thread_local Owner owner;
+
+    if (owner.slot != nullptr)
+    {
+        return owner.slot;
+    }
+
+    for (ThreadSlot *slot = slots_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+    {
+        bool expected = false;
+        if (!slot->in_use.load(std::memory_order_relaxed) &&
+            slot->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire))
+        {
+            owner.slot = slot;
+            return slot;
+        }
+    }
+
+    ThreadSlot *slot = new ThreadSlot();
+    slot->in_use.store(true, std::memory_order_relaxed);
+    slot->next = slots_.load(std::memory_order_relaxed);
+    while (!slots_.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+    owner.slot = slot;
+    return slot;
+}
+
+/**
+ * @brief Merges the histograms of every thread for one command id.
+ *
+ * @param id The command's id.
+ * @return The durations recorded since the tracker started, baseline not subtracted.
+ */
+LatencySnapshot LatencyTracker::Merge(size_t id) const
+{
+    LatencySnapshot snapshot;
+    for (ThreadSlot *slot = slots_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+    {
+        const LatencyHistogram *histogram = slot->histograms[id].load(std::memory_order_acquire);
+        if (histogram != nullptr)
+        {
+            histogram->AddTo(snapshot);
+        }
+    }
+    return snapshot;
+}
+
+/**
+ * @brief Sums the per-stage times of every thread for one command id.
+ *
+ * @param id The command's id.
+ * @return The stage times since the tracker started, baseline not subtracted.
+ */
+StageBreakdown LatencyTracker::MergeStages(size_t id) const
+{
+    StageBreakdown breakdown;
+    for (ThreadSlot *slot = slots_.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+    {
+        const StageTotals *totals = slot->stages[id].load(std::memory_order_acquire);
+        if (totals != nullptr)
+        {
+            breakdown.requests += totals->requests.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < RequestTiming::kStages; ++i)
+            {
+                breakdown.nanoseconds[i] += totals->nanoseconds[i].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    return breakdown;
+}
+
+/**
+ * @brief Returns the merged histogram of every command that ran since the last reset.
+ *
+ * Takes the tracker's lock, which recording threads only take to intern a new command name.
+ *
+ * @return One snapshot per command with at least one duration recorded, by command name in order of first use.
+ */
+std::vector<std::pair<std::string, LatencySnapshot>> LatencyTracker::Snapshot()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::pair<std::string, LatencySnapshot>> snapshots;
+    for (size_t id = 0; id < names_.size(); ++id)
+    {
+        LatencySnapshot snapshot = Merge(id);
+        snapshot.Subtract(baselines_[id]);
+        if (snapshot.count > 0)
+        {
+            snapshots.emplace_back(names_[id], std::move(snapshot));
+        }
+    }
+    return snapshots;
+}
+
+/**
+ * @brief Returns the merged histogram of one command since the last reset.
+ *
+ * @param command The command's name.
+ * @param snapshot Receives the merged histogram.
+ * @return `true` if the command has ever run.
+ */
+bool LatencyTracker::Snapshot(const std::string &command, LatencySnapshot &snapshot)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = ids_.find(command);
+    if (it == ids_.end())
+    {
+        return false;
+    }
+
+    snapshot = Merge(it->second);
+    snapshot.Subtract(baselines_[it->second]);
+    return true;
+}
+
+/**
+ * @brief Returns the merged histogram of every command that ever ran, ignoring resets.
+ *
+ * For exporters whose counters must never go down, such as the Prometheus endpoint.
+ *
+ * @return One snapshot per command with at least one duration recorded, by command name in order of first use.
+ */
+std::vector<std::pair<std::string, LatencySnapshot>> LatencyTracker::Totals()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::pair<std::string, LatencySnapshot>> snapshots;
+    for (size_t id = 0; id < names_.size(); ++id)
+    {
+        LatencySnapshot snapshot = Merge(id);
+        if (snapshot.count > 0)
+        {
+            snapshots.emplace_back(names_[id], std::move(snapshot));
+        }
+    }
+    return snapshots;
+}
+
+/**
+ * @brief Returns the summed per-stage times of every command timed since the last reset.
+ *
+ * @return One breakdown per command with at least one request timed, by command name in order of first use.
+ */
+std::vector<std::pair<std::string, StageBreakdown>> LatencyTracker::Stages()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::pair<std::string, StageBreakdown>> breakdowns;
+    for (size_t id = 0; id < names_.size(); ++id)
+    {
+        StageBreakdown breakdown = MergeStages(id);
+        const StageBreakdown &baseline = stage_baselines_[id];
+        breakdown.requests -= std::min(breakdown.requests, baseline.requests);
+        for (size_t i = 0; i < RequestTiming::kStages; ++i)
+        {
+            breakdown.nanoseconds[i] -= std::min(breakdown.nanoseconds[i], baseline.nanoseconds[i]);
+        }
+        if (breakdown.requests > 0)
+        {
+            breakdowns.emplace_back(names_[id], breakdown);
+        }
+    }
+    return breakdowns;
+}
+
+/**
+ * @brief Forgets the durations and stage times recorded so far, for every command.
+ */
+void LatencyTracker::Reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (size_t id = 0; id < names_.size(); ++id)
+    {
+        baselines_[id] = Merge(id);
+        stage_baselines_[id] = MergeStages(id);
+    }
+}
+
+/**
+ * @brief Forgets the durations and stage times recorded so far for one command.
+ *
+ * @param command The command's name.
+ * @return `true` if the command has ever run.
+ */
+bool LatencyTracker::Reset(const std::string &command)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = ids_.find(command);
+    if (it == ids_.end())
+    {
+        return false;
+    }
+
+    baselines_[it->second] = Merge(it->second);
+    stage_baselines_[it->second] = MergeStages(it->second);
+    return true;
+}
@@ -0,0 +1,149 @@
+#ifndef LATENCY_TRACKER_H
+#define LATENCY_TRACKER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "LatencyHistogram.h"
+#include "RequestTiming.h"
+
+/**
+ * @brief The time requests of one command spent in each stage, summed over the requests.
+ */
+struct StageBreakdown
+{
+    uint64_t requests = 0;                                   ///< The number of requests timed.
+    std::array<uint64_t, RequestTiming::kStages> nanoseconds{}; ///< The time spent in each stage, indexed by `Stage`.
+};
+
+/**
+ * @class LatencyTracker
+ * @brief Process-wide latency histograms per command, recorded per thread and merged when read.
+ *
+ * Each thread records into histograms of its own, so recording takes no lock and writes no cache line another
+ * thread writes: it costs a thread-local lookup of the command's id and a few plain stores. Reading merges the
+ * histograms of every thread. Resetting does not touch the histograms, which their writers own; it keeps the
+ * merged counts as a baseline that later reads subtract.
+ *
+ * Alongside the histograms, the tracker sums the per-stage times of the requests that stage timing was enabled for
+ * (see `RequestTiming`), in the same per-thread way.
+ *
+ * Command names are interned into at most `kMaxCommands` ids; once they are used up, further names are counted
+ * as "UNKNOWN". The histograms of a thread that exits are kept and reused by the next thread to start recording.
+ */
+class LatencyTracker
+{
+public:
+    static constexpr size_t kMaxCommands = 128; ///< The most command names tracked, "UNKNOWN" included.
+
+    /**
+     * @brief Returns the process-wide tracker.
+     */
+    static LatencyTracker &Instance();
+
+    /**
+     * @brief Records the duration of one command.
+     *
+     * @param command The command's name.
+     * @param nanoseconds The command's duration.
+     */
+    void Record(const std::string &command, uint64_t nanoseconds);
+
+    /**
+     * @brief Records the per-stage times of one request.
+     *
+     * @param command The command's name.
+     * @param durations The time spent in each stage, indexed by `Stage`.
+     */
+    void RecordStages(const std::string &command, const std::array<uint64_t, RequestTiming::kStages> &durations);
+
+    /**
+     * @brief Returns the merged histogram of every command that ran since the last reset, by command name.
+     */
+    std::vector<std::pair<std::string, LatencySnapshot>> Snapshot();
+
+    /**
+     * @brief Returns the merged histogram of one command since the last reset.
+     */
+    bool Snapshot(const std::string &command, LatencySnapshot &snapshot);
+
+    /**
+     * @brief Returns the merged histogram of every command that ever ran, ignoring resets, by command name.
+     */
+    std::vector<std::pair<std::string, LatencySnapshot>> Totals();
+
+    /**
+     * @brief Returns the summed per-stage times of every command timed since the last reset, by command name.
+     */
+    std::vector<std::pair<std::string, StageBreakdown>> Stages();
+
+    /**
+     * @brief Forgets the durations and stage times recorded so far, for every command.
+     */
+    void Reset();
+
+    /**
+     * @brief Forgets the durations and stage times recorded so far for one command.
+     */
+    bool Reset(const std::string &command);
+
+private:
+    /**
+     * @brief One command's per-stage times on one thread, with the thread as the single writer.
+     */
+    struct StageTotals
+    {
+        std::array<std::atomic<uint64_t>, RequestTiming::kStages> nanoseconds{}; ///< The time spent in each stage.
+        std::atomic<uint64_t> requests{0};                                       ///< The number of requests timed.
+    };
+
+    /**
+     * @brief One thread's histograms. Slots are never freed; a slot released by an exiting thread is reused.
+     */
+    struct alignas(64) ThreadSlot
+    {
+        std::array<std::atomic<LatencyHistogram *>, kMaxCommands> histograms{}; ///< Per command id; null until used.
+        std::array<std::atomic<StageTotals *>, kMaxCommands> stages{};           ///< Per command id; null until used.
+        std::atomic<bool> in_use{false}; ///< Whether a live thread owns the slot.
+        ThreadSlot *next = nullptr;      ///< The next slot; set once, before the slot is published.
+    };
+
+    std::atomic<ThreadSlot *> slots_{nullptr}; ///< Every slot, newest first.
+
+    std::mutex mutex_;                               ///< Guards the names, the ids and the baselines.
+    std::vector<std::string> names_;                 ///< The command name of each id.
+    std::unordered_map<std::string, size_t> ids_;    ///< The id of each command name.
+    std::vector<LatencySnapshot> baselines_;         ///< Per command id, the counts as of the last reset.
+    std::vector<StageBreakdown> stage_baselines_;    ///< Per command id, the stage times as of the last reset.
+
+    LatencyTracker();
+
+    /**
+     * @brief Returns the id of a command name, interning it on first use.
+     */
+    size_t CommandId(const std::string &command);
+
+    /**
+     * @brief Returns the calling thread's slot, claiming one on first use.
+     */
+    ThreadSlot *LocalSlot();
+
+    /**
+     * @brief Merges the histograms of every thread for one command id.
+     */
+    LatencySnapshot Merge(size_t id) const;
+
+    /**
+     * @brief Sums the per-stage times of every thread for one command id.
+     */
+    StageBreakdown MergeStages(size_t id) const;
+};
+
+#endif // LATENCY_TRACKER_H
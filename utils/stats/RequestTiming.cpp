@@ -0,0 +1,120 @@
+#include "RequestTiming.h"
+
+std::atomic<bool> RequestTiming::enabled_{false};
+thread_local RequestTiming *RequestTiming::current_ = nullptr;
+
+/**
+ * @brief Makes the request the thread's current request, and starts timing its stages if stage timing is enabled.
+ *
+ * The clock is only read when the stages are timed.
+ */
+RequestTiming::RequestTiming() : active_(Enabled()), previous_(current_)
+{
+    if (active_)
+    {
+        last_ = Now();
+    }
+    current_ = this;
+}
+
+/**
+ * @brief Stops being the thread's current request.
+ */
+RequestTiming::~RequestTiming()
+{
+    current_ = previous_;
+}
+
+/**
+ * @brief Closes a stage, charging it the time since the previous stamp less the nested stages meanwhile.
+ *
+ * @param stage The stage that just ended.
+ */
+void RequestTiming::Stamp(Stage stage)
+{
+    if (!active_)
+    {
+        return;
+    }
+
+    uint64_t now = Now();
+    uint64_t elapsed = now - last_;
+    durations_[static_cast<size_t>(stage)] += elapsed > nested_ ? elapsed - nested_ : 0;
+    last_ = now;
+    nested_ = 0;
+}
+
+/**
+ * @brief Charges a nested stage of the thread's current request, if any, whether or not its stages are timed.
+ *
+ * The time is taken out of the stage that encloses it when that stage is stamped.
+ *
+ * @param stage The nested stage.
+ * @param nanoseconds The time to charge.
+ */
+void RequestTiming::AddCurrent(Stage stage, uint64_t nanoseconds)
+{
+    if (current_ != nullptr)
+    {
+        current_->durations_[static_cast<size_t>(stage)] += nanoseconds;
+        current_->nested_ += nanoseconds;
+    }
+}
+
+/**
+ * @brief Starts timing a nested stage for the thread's current request if its stages are timed, unless an enclosing
+ *        scope already has.
+ *
+ * @param stage The nested stage.
+ */
+RequestTiming::Scope::Scope(Stage stage)
+    : timing_(current_ != nullptr && current_->active_ ? current_ : nullptr), stage_(stage)
+{
+    if (timing_ != nullptr && timing_->depth_[static_cast<size_t>(stage)]++ == 0)
+    {
+        start_ = Now();
+    }
+}
+
+/**
+ * @brief Charges the nested stage when the outermost scope ends.
+ */
+RequestTiming::Scope::~Scope()
+{
+    if (timing_ != nullptr && --timing_->depth_[static_cast<size_t>(stage_)] == 0)
+    {
+        uint64_t elapsed = Now() - start_;
+        timing_->durations_[static_cast<size_t>(stage_)] += elapsed;
+        timing_->nested_ += elapsed;
+    }
+}
+
+/**
+ * @brief Returns the name LATENCY STAGES reports a stage under.
+ *
+ * @param stage The stage.
+ * @return The name, without unit.
+ */
+const char *RequestTiming::Name(Stage stage)
+{
+    switch (stage)
+    {
+    case Stage::kFraming:
+        return "framing";
+    case Stage::kVerify:
+        return "verify";
+    case Stage::kParse:
+        return "parse";
+    case Stage::kExecute:
+        return "execute";
+    case Stage::kLockWait:
+        return "lock_wait";
+    case Stage::kSerialize:
+        return "serialize";
+    case Stage::kSend:
+        return "send";
+    case Stage::kCount:
+        break;
+    }
+    return "unknown";
+}
@@ -0,0 +1,172 @@
+#ifndef REQUEST_TIMING_H
+#define REQUEST_TIMING_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief The stages a request goes through, in order; `kLockWait` and `kSerialize` happen during `kExecute`.
+ */
+enum class Stage : size_t
+{
+    kFraming,   ///< Extracting the message and its signature from the connection's buffer.
+    kVerify,    ///< Checking the message's HMAC signature.
+    kParse,     ///< Parsing the payload into a MESP object.
+    kExecute,   ///< Running the command's handler, less the lock waits and serialization below.
+    kLockWait,  ///< Waiting for a contended cache lock.
+    kSerialize, ///< Serializing the response.
+    kSend,      ///< Writing the response to the socket.
+    kCount      ///< The number of stages.
+};
+
+/**
+ * @class RequestTiming
+ * @brief Stamps the stages of one request as it goes through them, when stage timing is enabled.
+ *
+ * The connection's thread creates one per request. While it lives, it is the thread's current request, so code deep
+ * in the call, such as a cache lock or the serializer, can charge time to it without it being passed down.
+ * `Stamp` closes a stage: the time since the previous stamp, less the nested stages charged meanwhile, goes to it.
+ *
+ * Stage timing is off by default. While it is off, a request's timing is inactive and every call below is a
+ * thread-local load and a branch, except that waits on contended cache locks are still charged, for SLOWLOG: they
+ * only read the clock when a lock could not be taken at once. Times come from `std::chrono::steady_clock`, which
+ * reads the TSC through the vDSO on Linux without the calibration and cross-core drift of reading the TSC directly.
+ */
+class RequestTiming
+{
+public:
+    static constexpr size_t kStages = static_cast<size_t>(Stage::kCount); ///< The number of stages.
+
+    /**
+     * @brief Times a nested stage, such as serialization, for the thread's current request if any.
+     *
+     * Only the outermost scope of a recursion is timed.
+     */
+    class Scope
+    {
+    public:
+        explicit Scope(Stage stage);
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+    private:
+        RequestTiming *timing_; ///< The request timed, or null.
+        Stage stage_;           ///< The stage timed.
+        uint64_t start_ = 0;    ///< When the scope began, in nanoseconds.
+    };
+
+    /**
+     * @brief Makes the request the thread's current request, and starts timing its stages if stage timing is enabled.
+     */
+    RequestTiming();
+
+    /**
+     * @brief Stops being the thread's current request.
+     */
+    ~RequestTiming();
+
+    RequestTiming(const RequestTiming &) = delete;
+    RequestTiming &operator=(const RequestTiming &) = delete;
+
+    /**
+     * @brief Returns whether the request is being timed.
+     */
+    bool Active() const
+    {
+        return active_;
+    }
+
+    /**
+     * @brief Closes a stage, charging it the time since the previous stamp less the nested stages meanwhile.
+     */
+    void Stamp(Stage stage);
+
+    /**
+     * @brief Closes a stage of the thread's current request, if any.
+     */
+    static void StampCurrent(Stage stage)
+    {
+        if (current_ != nullptr)
+        {
+            current_->Stamp(stage);
+        }
+    }
+
+    /**
+     * @brief Returns whether the thread is handling a request, so that callers can skip reading the clock.
+     */
+    static bool Tracking()
+    {
+        return current_ != nullptr;
+    }
+
+    /**
+     * @brief Charges a nested stage of the thread's current request, if any.
+     */
+    static void AddCurrent(Stage stage, uint64_t nanoseconds);
+
+    /**
+     * @brief Returns the time spent waiting for contended cache locks, in nanoseconds, even while inactive.
+     */
+    uint64_t LockWait() const
+    {
+        return durations_[static_cast<size_t>(Stage::kLockWait)];
+    }
+
+    /**
+     * @brief Returns the time charged to each stage, in nanoseconds, indexed by `Stage`.
+     */
+    const std::array<uint64_t, kStages> &Durations() const
+    {
+        return durations_;
+    }
+
+    /**
+     * @brief Enables or disables stage timing for the requests that start from now on.
+     */
+    static void SetEnabled(bool enabled)
+    {
+        enabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns whether stage timing is enabled.
+     */
+    static bool Enabled()
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the name LATENCY STAGES reports a stage under.
+     */
+    static const char *Name(Stage stage);
+
+    /**
+     * @brief Returns the current time in nanoseconds on the clock stages are timed with.
+     */
+    static uint64_t Now()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+private:
+    static std::atomic<bool> enabled_;               ///< Whether new requests are timed.
+    static thread_local RequestTiming *current_;     ///< The request the thread is handling, or null.
+
+    bool active_;                                    ///< Whether the request's stages are being timed.
+    RequestTiming *previous_;                        ///< The thread's current request before this one.
+    uint64_t last_ = 0;                              ///< When the previous stage closed, in nanoseconds.
+    uint64_t nested_ = 0;                            ///< Time charged to nested stages since the last stamp.
+    std::array<unsigned, kStages> depth_{};          ///< Open scopes per stage.
+    std::array<uint64_t, kStages> durations_{};      ///< Time charged to each stage.
+};
+
+#endif // REQUEST_TIMING_H
@@ -0,0 +1,87 @@
+#include "ServerStats.h"
+
+/**
+ * @brief Returns the process-wide counters.
+ *
+ * The counters are never destroyed, so threads still running while the process exits can keep counting.
+ */
+ServerStats &ServerStats::Instance()
+{
+    static ServerStats *instance = new ServerStats();
+    return *instance;
+}
+
+/**
+ * @brief Returns the sum of a counter's shards.
+ *
+ * Takes no lock; threads keep counting while the shards are summed.
+ *
+ * @param stat The counter.
+ * @return The counter's value.
+ */
+uint64_t ServerStats::Load(Stat stat) const
+{
+    uint64_t total = 0;
+    for (const Shard &shard : shards_)
+    {
+        total += shard.counters[static_cast<size_t>(stat)].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+/**
+ * @brief Returns the name INFO reports a counter under.
+ *
+ * @param stat The counter.
+ * @return The name, following Redis's INFO field names where one exists.
+ */
+const char *ServerStats::Name(Stat stat)
+{
+    switch (stat)
+    {
+    case Stat::kKeyspaceHits:
+        return "keyspace_hits";
+    case Stat::kKeyspaceMisses:
+        return "keyspace_misses";
+    case Stat::kSets:
+        return "keyspace_sets";
+    case Stat::kEvictions:
+        return "evicted_keys";
+    case Stat::kExpirations:
+        return "expired_keys";
+    case Stat::kGeoHits:
+        return "geo_hits";
+    case Stat::kGeoMisses:
+        return "geo_misses";
+    case Stat::kGeoSets:
+        return "geo_sets";
+    case Stat::kGeoEvictions:
+        return "geo_evicted_keys";
+    case Stat::kTimeSeriesPoints:
+        return "timeseries_points_added";
+    case Stat::kTimeSeriesEvictions:
+        return "timeseries_points_evicted";
+    case Stat::kConnectionsReceived:
+        return "total_connections_received";
+    case Stat::kConnectedClients:
+        return "connected_clients";
+    case Stat::kCommandsProcessed:
+        return "total_commands_processed";
+    case Stat::kNetInputBytes:
+        return "total_net_input_bytes";
+    case Stat::kNetOutputBytes:
+        return "total_net_output_bytes";
+    case Stat::kCount:
+        break;
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Returns the seconds since the counters were created, that is, since the server started.
+ */
+uint64_t ServerStats::UptimeSeconds() const
+{
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(elapsed).count());
+}
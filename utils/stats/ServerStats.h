@@ -0,0 +1,112 @@
+#ifndef SERVER_STATS_H
+#define SERVER_STATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief The counters kept by `ServerStats`, in the order INFO reports them.
+ */
+enum class Stat : size_t
+{
+    kKeyspaceHits,        ///< Key-value reads that found their key.
+    kKeyspaceMisses,      ///< Key-value reads that did not.
+    kSets,                ///< Key-value entries stored by SET, MSET, GETSET and CAS.
+    kEvictions,           ///< Key-value entries evicted to make room.
+    kExpirations,         ///< Key-value entries removed because their TTL ran out.
+    kGeoHits,             ///< Geo lookups that found their point.
+    kGeoMisses,           ///< Geo lookups that did not.
+    kGeoSets,             ///< Geo points stored.
+    kGeoEvictions,        ///< Geo keys evicted to make room.
+    kTimeSeriesPoints,    ///< Time-series points added.
+    kTimeSeriesEvictions, ///< Time-series points dropped to keep a series within its limit.
+    kConnectionsReceived, ///< Client connections accepted.
+    kConnectedClients,    ///< Client connections currently open; incremented and decremented.
+    kCommandsProcessed,   ///< Messages processed, valid or not.
+    kNetInputBytes,       ///< Bytes received from clients.
+    kNetOutputBytes,      ///< Bytes sent to clients.
+    kCount                ///< The number of counters.
+};
+
+/**
+ * @class ServerStats
+ * @brief Process-wide operation counters that threads update without contending with each other.
+ *
+ * Each counter is split into `kShards` relaxed atomics, one per shard, and each thread is assigned a shard the first
+ * time it counts something. A thread's counters sit on cache lines no other thread writes unless there are more
+ * threads than shards, so counting costs one uncontended atomic add. Reading a counter sums its shards; the total is
+ * not a snapshot across counters, but each counter is exact once the threads updating it have stopped.
+ *
+ * A gauge such as `kConnectedClients` is a counter that is also decremented: unsigned wrap-around makes the sum
+ * correct even when a thread decrements a shard it did not increment.
+ */
+class ServerStats
+{
+public:
+    static constexpr size_t kShards = 32; ///< Shards per counter.
+
+    /**
+     * @brief Returns the process-wide counters.
+     */
+    static ServerStats &Instance();
+
+    /**
+     * @brief Adds to a counter.
+     */
+    void Add(Stat stat, uint64_t amount = 1)
+    {
+        LocalShard().counters[static_cast<size_t>(stat)].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Subtracts from a counter.
+     */
+    void Subtract(Stat stat, uint64_t amount = 1)
+    {
+        LocalShard().counters[static_cast<size_t>(stat)].fetch_sub(amount, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the sum of a counter's shards.
+     */
+    uint64_t Load(Stat stat) const;
+
+    /**
+     * @brief Returns the name INFO reports a counter under.
+     */
+    static const char *Name(Stat stat);
+
+    /**
+     * @brief Returns the seconds since the counters were created, that is, since the server started.
+     */
+    uint64_t UptimeSeconds() const;
+
+private:
+    /**
+     * @brief One shard of every counter, on cache lines of its own.
+     */
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(Stat::kCount)> counters{};
+    };
+
+    std::array<Shard, kShards> shards_;       ///< The shards.
+    std::atomic<size_t> next_shard_{0};       ///< The shard the next new thread is assigned.
+    std::chrono::steady_clock::time_point start_ = std::chrono::steady_clock::now(); ///< When the counters started.
+
+    ServerStats() = default;
+
+    /**
+     * @brief Returns the calling thread's shard, assigning one round-robin on first use.
+     */
+    Shard &LocalShard()
+    {
+        thread_local size_t shard = next_shard_.fetch_add(1, std::memory_order_relaxed) % kShards;
+        return shards_[shard];
+    }
+};
+
+#endif // SERVER_STATS_H
@@ -0,0 +1,165 @@
+#include "SlowLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+/**
+ * @brief Returns the process-wide slow log.
+ *
+ * The log is never destroyed, so threads still running while the process exits can keep recording.
+ */
+SlowLog &SlowLog::Instance()
+{
+    static SlowLog *instance = new SlowLog();
+    return *instance;
+}
+
+/**
+ * @brief Records a slow command, overwriting the oldest entry once the ring is full.
+ *
+ * Never blocks: if the slot is still being written by a writer a full lap behind, the entry is dropped. So is an
+ * entry whose writer stalled long enough for a newer entry to claim the slot first, so the newest entry is kept.
+ *
+ * @param command The command and its arguments; only the first `kTextBytes` bytes are kept.
+ * @param duration_ns The command's latency.
+ * @param lock_wait_ns The part of it spent waiting for contended cache locks.
+ * @param client_fd The socket of the client that sent the command.
+ */
+void SlowLog::Record(const std::string &command, uint64_t duration_ns, uint64_t lock_wait_ns, int client_fd)
+{
+    uint64_t id = next_id_.fetch_add(1, std::memory_order_relaxed);
+    Slot &slot = slots_[id % kCapacity];
+
+    // Claim the slot, marking it as being written, unless it is being written or already holds a newer entry
+    uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    if ((sequence & 1) != 0 || sequence >= 2 * id + 2 ||
+        !slot.sequence.compare_exchange_strong(sequence, 2 * id + 1, std::memory_order_relaxed))
+    {
+        return;
+    }
+    // Order the claim before the writes below, as seen by a reader that checks the sequence after copying
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    slot.timestamp.store(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(now).count()),
+                         std::memory_order_relaxed);
+    slot.duration_ns.store(duration_ns, std::memory_order_relaxed);
+    slot.lock_wait_ns.store(lock_wait_ns, std::memory_order_relaxed);
+    slot.client_fd.store(client_fd, std::memory_order_relaxed);
+
+    size_t length = std::min(command.size(), kTextBytes);
+    slot.length.store(length, std::memory_order_relaxed);
+    for (size_t i = 0; i * sizeof(uint64_t) < length; ++i)
+    {
+        uint64_t word = 0;
+        size_t offset = i * sizeof(uint64_t);
+        std::memcpy(&word, command.data() + offset, std::min(sizeof(uint64_t), length - offset));
+        slot.text[i].store(word, std::memory_order_relaxed);
+    }
+
+    // Publish the entry
+    slot.sequence.store(2 * id + 2, std::memory_order_release);
+}
+
+/**
+ * @brief Copies a slot's entry if it is completely written.
+ *
+ * @param slot The slot.
+ * @param entry Receives the entry.
+ * @return `true` if the slot held a complete entry that no writer changed while it was copied.
+ */
+bool SlowLog::Read(const Slot &slot, SlowLogEntry &entry) const
+{
+    uint64_t before = slot.sequence.load(std::memory_order_acquire);
+    if (before == 0 || (before & 1) != 0)
+    {
+        return false;
+    }
+
+    entry.id = before / 2 - 1;
+    entry.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+    entry.duration_ns = slot.duration_ns.load(std::memory_order_relaxed);
+    entry.lock_wait_ns = slot.lock_wait_ns.load(std::memory_order_relaxed);
+    entry.client_fd = static_cast<int>(slot.client_fd.load(std::memory_order_relaxed));
+
+    size_t length = std::min<size_t>(slot.length.load(std::memory_order_relaxed), kTextBytes);
+    std::array<uint64_t, kTextWords> words;
+    for (size_t i = 0; i < kTextWords; ++i)
+    {
+        words[i] = slot.text[i].load(std::memory_order_relaxed);
+    }
+
+    // Order the copy before the second check of the sequence
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.sequence.load(std::memory_order_relaxed) != before)
+    {
+        return false;
+    }
+
+    entry.command.assign(reinterpret_cast<const char *>(words.data()), length);
+    return true;
+}
+
+/**
+ * @brief Returns the most recent entries recorded since the last reset, newest first.
+ *
+ * Entries being written while the ring is read are skipped.
+ *
+ * @param count The most entries to return.
+ * @return The entries.
+ */
+std::vector<SlowLogEntry> SlowLog::Get(size_t count) const
+{
+    uint64_t first = first_id_.load(std::memory_order_relaxed);
+
+    std::vector<SlowLogEntry> entries;
+    for (const Slot &slot : slots_)
+    {
+        SlowLogEntry entry;
+        if (Read(slot, entry) && entry.id >= first)
+        {
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const SlowLogEntry &a, const SlowLogEntry &b) { return a.id > b.id; });
+    if (entries.size() > count)
+    {
+        entries.resize(count);
+    }
+    return entries;
+}
+
+/**
+ * @brief Returns the number of entries recorded since the last reset that the ring still holds.
+ *
+ * Counts the slots holding a complete entry, as `Get` would return them, so entries that were dropped, overwritten
+ * or are still being written are not counted.
+ */
+size_t SlowLog::Length() const
+{
+    uint64_t first = first_id_.load(std::memory_order_relaxed);
+
+    size_t length = 0;
+    for (const Slot &slot : slots_)
+    {
+        uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        if (sequence != 0 && (sequence & 1) == 0 && sequence / 2 - 1 >= first)
+        {
+            ++length;
+        }
+    }
+    return length;
+}
+
+/**
+ * @brief Forgets the entries recorded so far.
+ *
+ * The entries stay in the ring, hidden by their ids, until they are overwritten.
+ */
+void SlowLog::Reset()
+{
+    first_id_.store(next_id_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
@@ -0,0 +1,123 @@
+#ifndef SLOW_LOG_H
+#define SLOW_LOG_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One command recorded by `SlowLog`.
+ */
+struct SlowLogEntry
+{
+    uint64_t id = 0;           ///< The entry's number; entries are numbered from 0 in the order they were recorded.
+    uint64_t timestamp = 0;    ///< When the command completed, in seconds since the Unix epoch.
+    uint64_t duration_ns = 0;  ///< The command's latency from parsing to sending.
+    uint64_t lock_wait_ns = 0; ///< The part of it spent waiting for contended cache locks.
+    int client_fd = -1;        ///< The socket of the client that sent it.
+    std::string command;       ///< The command and its arguments, truncated.
+};
+
+/**
+ * @class SlowLog
+ * @brief A fixed-size, lock-free ring of the most recent commands slower than a threshold.
+ *
+ * Checking a command against the threshold is one relaxed load and a compare, so fast commands cost nothing more.
+ * A slow command claims the next slot with an atomic increment and writes its entry under the slot's sequence
+ * number, as in a seqlock: the number is odd while the entry is written, and readers copy the entry and keep it
+ * only if the number was even and unchanged throughout. Every field, the text included, is stored in atomic words,
+ * so a reader racing a writer never reads a torn value it would keep. A writer that finds its slot still being
+ * written by a writer one lap behind drops its entry rather than wait.
+ *
+ * The ring is process-wide and holds the last `kCapacity` entries; older entries are overwritten.
+ */
+class SlowLog
+{
+public:
+    static constexpr size_t kCapacity = 128;  ///< The most entries kept.
+    static constexpr size_t kTextBytes = 128; ///< The most bytes of command text kept per entry.
+
+    /**
+     * @brief Returns the process-wide slow log.
+     */
+    static SlowLog &Instance();
+
+    /**
+     * @brief Returns whether a command that took this long should be recorded.
+     */
+    bool IsSlow(uint64_t duration_ns) const
+    {
+        return duration_ns >= threshold_ns_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records a slow command, overwriting the oldest entry once the ring is full.
+     */
+    void Record(const std::string &command, uint64_t duration_ns, uint64_t lock_wait_ns, int client_fd);
+
+    /**
+     * @brief Returns the most recent entries recorded since the last reset, newest first.
+     */
+    std::vector<SlowLogEntry> Get(size_t count) const;
+
+    /**
+     * @brief Returns the number of entries recorded since the last reset that the ring still holds, as `Get` with
+     *        a large enough count would return them, unless entries are being written meanwhile.
+     */
+    size_t Length() const;
+
+    /**
+     * @brief Forgets the entries recorded so far.
+     */
+    void Reset();
+
+    /**
+     * @brief Sets the latency from which commands are recorded.
+     */
+    void SetThreshold(uint64_t threshold_ns)
+    {
+        threshold_ns_.store(threshold_ns, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Returns the latency from which commands are recorded, in nanoseconds.
+     */
+    uint64_t Threshold() const
+    {
+        return threshold_ns_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t kTextWords = kTextBytes / sizeof(uint64_t); ///< Words of command text per entry.
+
+    /**
+     * @brief One entry, with every field atomic so that readers can copy it while it is rewritten.
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<uint64_t> sequence{0};   ///< 2 * id + 1 while written, 2 * id + 2 once written; 0 if never used.
+        std::atomic<uint64_t> timestamp{0};
+        std::atomic<uint64_t> duration_ns{0};
+        std::atomic<uint64_t> lock_wait_ns{0};
+        std::atomic<int64_t> client_fd{-1};
+        std::atomic<uint64_t> length{0};     ///< The bytes of command text.
+        std::array<std::atomic<uint64_t>, kTextWords> text{}; ///< The command text, packed 8 bytes per word.
+    };
+
+    std::array<Slot, kCapacity> slots_;             ///< The ring.
+    std::atomic<uint64_t> next_id_{0};              ///< The id of the next entry.
+    std::atomic<uint64_t> first_id_{0};             ///< Entries with a lower id were reset.
+    std::atomic<uint64_t> threshold_ns_{10000000};  ///< Commands at least this slow are recorded; 10 ms by default.
+
+    SlowLog() = default;
+
+    /**
+     * @brief Copies a slot's entry if it is completely written.
+     */
+    bool Read(const Slot &slot, SlowLogEntry &entry) const;
+};
+
+#endif // SLOW_LOG_H
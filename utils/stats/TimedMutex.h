@@ -0,0 +1,83 @@
+#ifndef TIMED_MUTEX_H
+#define TIMED_MUTEX_H
+
+#include <mutex>
+#include <shared_mutex>
+
+#include "RequestTiming.h"
+
+/**
+ * @class WaitTimedMutex
+ * @brief A mutex that charges the time its callers wait for it to the lock-wait stage of their request.
+ *
+ * Locking first tries without blocking, so an uncontended lock costs what the wrapped mutex costs. Only a caller
+ * that must wait, and that is handling a request (see `RequestTiming`), reads the clock around the wait.
+ *
+ * @tparam Mutex `std::mutex` or `std::shared_mutex`; the shared members are only usable with the latter.
+ */
+template <typename Mutex>
+class WaitTimedMutex
+{
+public:
+    void lock()
+    {
+        if (mutex_.try_lock())
+        {
+            return;
+        }
+        if (!RequestTiming::Tracking())
+        {
+            mutex_.lock();
+            return;
+        }
+
+        uint64_t start = RequestTiming::Now();
+        mutex_.lock();
+        RequestTiming::AddCurrent(Stage::kLockWait, RequestTiming::Now() - start);
+    }
+
+    bool try_lock()
+    {
+        return mutex_.try_lock();
+    }
+
+    void unlock()
+    {
+        mutex_.unlock();
+    }
+
+    void lock_shared()
+    {
+        if (mutex_.try_lock_shared())
+        {
+            return;
+        }
+        if (!RequestTiming::Tracking())
+        {
+            mutex_.lock_shared();
+            return;
+        }
+
+        uint64_t start = RequestTiming::Now();
+        mutex_.lock_shared();
+        RequestTiming::AddCurrent(Stage::kLockWait, RequestTiming::Now() - start);
+    }
+
+    bool try_lock_shared()
+    {
+        return mutex_.try_lock_shared();
+    }
+
+    void unlock_shared()
+    {
+        mutex_.unlock_shared();
+    }
+
+private:
+    Mutex mutex_; ///< The wrapped mutex.
+};
+
+using TimedMutex = WaitTimedMutex<std::mutex>;              ///< An exclusive mutex whose waits are timed.
+using TimedSharedMutex = WaitTimedMutex<std::shared_mutex>; ///< A reader-writer mutex whose waits are timed.
+
+#endif // TIMED_MUTEX_H